@@ -45,7 +45,9 @@ foreach (CMAKE_OPTION IN ITEMS ${CMAKE_OPTIONS})
         endif ()
 
         if (CMAKE_OPTION STREQUAL "AE_COMPILE_OPTION_SSE")
-            if (${CMAKE_OPTION} STREQUAL "ON")
+            # При выборе ядер во время выполнения глобальные флаги не добавляются,
+            # варианты ядер собираются с помощью атрибута target.
+            if (${CMAKE_OPTION} STREQUAL "ON" AND NOT AE_LIBRARY_OPTION_RUNTIME_DISPATCH)
                 if (CMAKE_C_COMPILER_ID STREQUAL "GNU")
                     list(APPEND AE_TARGET_PRIVATE_COMPILE_OPTIONS -msse)
                 elseif (CMAKE_C_COMPILER_ID STREQUAL "Clang")
@@ -62,7 +64,7 @@ foreach (CMAKE_OPTION IN ITEMS ${CMAKE_OPTIONS})
         endif ()
 
         if (CMAKE_OPTION STREQUAL "AE_COMPILE_OPTION_AVX")
-            if (${CMAKE_OPTION} STREQUAL "ON")
+            if (${CMAKE_OPTION} STREQUAL "ON" AND NOT AE_LIBRARY_OPTION_RUNTIME_DISPATCH)
                 if (CMAKE_C_COMPILER_ID STREQUAL "GNU")
                     list(APPEND AE_TARGET_PRIVATE_COMPILE_OPTIONS -mavx)
                 elseif (CMAKE_C_COMPILER_ID STREQUAL "Clang")
@@ -75,7 +77,7 @@ foreach (CMAKE_OPTION IN ITEMS ${CMAKE_OPTIONS})
         endif ()
 
         if (CMAKE_OPTION STREQUAL "AE_COMPILE_OPTION_AVX2")
-            if (${CMAKE_OPTION} STREQUAL "ON")
+            if (${CMAKE_OPTION} STREQUAL "ON" AND NOT AE_LIBRARY_OPTION_RUNTIME_DISPATCH)
                 if (CMAKE_C_COMPILER_ID STREQUAL "GNU")
                     list(APPEND AE_TARGET_PRIVATE_COMPILE_OPTIONS -mavx2)
                 elseif (CMAKE_C_COMPILER_ID STREQUAL "Clang")
@@ -87,14 +89,17 @@ foreach (CMAKE_OPTION IN ITEMS ${CMAKE_OPTIONS})
             continue()
         endif ()
 
-        if (AE_COMPILE_OPTION_AVX512)
-            if (CMAKE_C_COMPILER_ID STREQUAL "GNU")
-                list(APPEND AE_TARGET_PRIVATE_COMPILE_OPTIONS -mavx512f)
-            elseif (CMAKE_C_COMPILER_ID STREQUAL "Clang")
-                list(APPEND AE_TARGET_PRIVATE_COMPILE_OPTIONS -mavx512f)
-            elseif (CMAKE_C_COMPILER_ID STREQUAL "MSVC")
-                list(APPEND AE_TARGET_PRIVATE_COMPILE_OPTIONS /arch:AVX512)
+        if (CMAKE_OPTION STREQUAL "AE_COMPILE_OPTION_AVX512")
+            if (${CMAKE_OPTION} STREQUAL "ON" AND NOT AE_LIBRARY_OPTION_RUNTIME_DISPATCH)
+                if (CMAKE_C_COMPILER_ID STREQUAL "GNU")
+                    list(APPEND AE_TARGET_PRIVATE_COMPILE_OPTIONS -mavx512f -mavx512bw)
+                elseif (CMAKE_C_COMPILER_ID STREQUAL "Clang")
+                    list(APPEND AE_TARGET_PRIVATE_COMPILE_OPTIONS -mavx512f -mavx512bw)
+                elseif (CMAKE_C_COMPILER_ID STREQUAL "MSVC")
+                    list(APPEND AE_TARGET_PRIVATE_COMPILE_OPTIONS /arch:AVX512)
+                endif ()
             endif ()
+            continue()
         endif ()
 
         if (CMAKE_OPTION STREQUAL "AE_COMPILE_OPTION_LTO")
@@ -51,4 +51,52 @@ list(APPEND AE_TARGET_PUBLIC_COMPILE_DEFINITIONS
         # В обоих случаях, при расчете нового размера памяти, не потребуется использование типа `float`,
         # что уменьшит возможные ошибки, связанные с точностью или производительностью.
         AE_DYNAMIC_BLOCK_GROWTH_FACTOR=1500
+
+        # Макрос AE_MEMORY_RAW_NON_TEMPORAL_THRESHOLD задает размер области памяти в байтах,
+        # начиная с которого функции копирования и заполнения памяти используют невременные
+        # (non-temporal) инструкции записи, минуя кэш процессора.
+        #
+        # Для очень больших областей это предотвращает вытеснение из кэша полезных данных
+        # и снижает нагрузку на шину памяти (не требуется чтение строк кэша перед записью).
+        # Для небольших областей обычная запись быстрее, так как данные остаются в кэше.
+        #
+        # По умолчанию порог равен размеру кэша последнего уровня, определенному
+        # во время выполнения, а это значение используется, только если размер кэша
+        # определить не удалось. Порог можно изменить функцией
+        # `ae_memory_raw_set_non_temporal_threshold`.
+        AE_MEMORY_RAW_NON_TEMPORAL_THRESHOLD=4194304
+
+        # Макрос AE_MEMORY_RAW_PREFETCH_DISTANCE задает расстояние в байтах,
+        # на которое опережает предвыборка исходных данных при копировании
+        # больших блоков невременными инструкциями записи.
+        #
+        # Значение должно покрывать задержку доступа к памяти: слишком малое
+        # не успевает скрыть задержку, слишком большое вытесняет еще не прочитанные данные.
+        AE_MEMORY_RAW_PREFETCH_DISTANCE=512
+
+        # Макрос AE_MEMORY_RAW_PARALLEL_THRESHOLD задает размер области памяти в байтах,
+        # начиная с которого параллельные функции копирования, заполнения и сравнения
+        # распределяют работу между потоками пула.
+        #
+        # Для меньших областей затраты на пробуждение потоков сопоставимы со временем
+        # самой операции, поэтому она выполняется вызывающим потоком.
+        AE_MEMORY_RAW_PARALLEL_THRESHOLD=16777216
+
+        # Макрос AE_WORKER_POOL_MAX_SIZE задает максимальное число участников
+        # пула рабочих потоков (включая вызывающий поток).
+        #
+        # Пропускная способность памяти насыщается небольшим числом ядер,
+        # поэтому большее число потоков только увеличивает затраты на синхронизацию.
+        AE_WORKER_POOL_MAX_SIZE=16
+
+        # Макрос AE_ARENA_ALLOCATOR_CHUNK_SIZE задает размер в байтах первого фрагмента,
+        # который арена запрашивает у родительского аллокатора, если размер
+        # не указан при инициализации. Каждый следующий фрагмент вдвое больше предыдущего.
+        AE_ARENA_ALLOCATOR_CHUNK_SIZE=65536
+
+        # Макрос AE_POOL_ALLOCATOR_SLAB_SIZE задает размер в байтах слэба, из которого
+        # пул нарезает блоки одного класса размеров. Слэбы выравниваются по своему размеру,
+        # чтобы класс блока определялся по его адресу, поэтому значение должно быть
+        # степенью двойки и не меньше удвоенного наибольшего класса (4096 байт).
+        AE_POOL_ALLOCATOR_SLAB_SIZE=65536
 )
\ No newline at end of file
@@ -216,4 +216,66 @@ option(AE_LIBRARY_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE
 #     и требований вашего приложения.
 #
 option(AE_LIBRARY_OPTION_THREAD_LOCAL_VARIABLES
-        "Все статические переменные используют модификатор thread_local." ON)
\ No newline at end of file
+        "Все статические переменные используют модификатор thread_local." ON)
+
+# Опция:
+#
+#     AE_LIBRARY_OPTION_RUNTIME_DISPATCH
+#
+# Описание:
+#
+#     Опция CMake AE_LIBRARY_OPTION_RUNTIME_DISPATCH определяет,
+#     выбираются ли SIMD-ядра низкоуровневых функций работы с памятью
+#     во время выполнения в зависимости от возможностей процессора.
+#
+#     Установка этой опции в значение ON (по умолчанию) приводит к тому,
+#     что все варианты ядер (SSE2, AVX, AVX2, AVX-512) собираются с помощью
+#     атрибута `target`, без глобальных флагов `-msse`/`-mavx*`, а при загрузке
+#     библиотеки по результату инструкции CPUID выбирается наилучший доступный вариант.
+#     Один и тот же бинарный файл безопасно работает на процессорах без AVX2 или AVX-512
+#     и при этом использует их на процессорах, которые их поддерживают.
+#
+# Использование:
+#
+#     ON: Собирает все варианты ядер и выбирает их во время выполнения.
+#         Опции AE_COMPILE_OPTION_SSE/AVX/AVX2/AVX512 не добавляют глобальных флагов.
+#     OFF: Набор ядер определяется опциями AE_COMPILE_OPTION_SSE/AVX/AVX2/AVX512,
+#          которые также добавляют соответствующие глобальные флаги компилятора.
+#
+# Примечание:
+#
+#     Выбор ядра выполняется один раз при загрузке библиотеки,
+#     поэтому накладные расходы ограничиваются одним косвенным вызовом.
+#     Отключите эту опцию, если библиотека собирается под заранее известный процессор.
+#
+option(AE_LIBRARY_OPTION_RUNTIME_DISPATCH
+        "Выбор SIMD-ядер во время выполнения по возможностям процессора." ON)
+
+# Опция:
+#
+#     AE_LIBRARY_OPTION_WORKER_POOL
+#
+# Описание:
+#
+#     Опция CMake AE_LIBRARY_OPTION_WORKER_POOL определяет,
+#     используют ли параллельные функции работы с памятью
+#     (например, `ae_memory_raw_copy_parallel`) внутренний пул рабочих потоков.
+#
+#     Установка этой опции в значение ON (по умолчанию) подключает к библиотеке
+#     системную библиотеку потоков (pthreads или Win32), а пул создается
+#     при первом вызове параллельной функции.
+#
+# Использование:
+#
+#     ON: Параллельные функции распределяют работу между потоками пула.
+#     OFF: Параллельные функции выполняются вызывающим потоком,
+#          библиотека не зависит от библиотеки потоков.
+#
+# Примечание:
+#
+#     Один поток редко насыщает пропускную способность памяти, поэтому
+#     пул ускоряет обработку блоков размером в сотни мегабайт.
+#     Отключите эту опцию для однопоточных сред или сред без поддержки потоков.
+#
+option(AE_LIBRARY_OPTION_WORKER_POOL
+        "Параллельные функции работы с памятью используют пул рабочих потоков." ON)
@@ -0,0 +1,195 @@
+/**
+ * @file arena_allocator.h
+ * @brief Арена: аллокатор, выделяющий память последовательно из крупных фрагментов.
+ *
+ * Данный файл содержит структуру `ae_arena_allocator_t`, которая получает фрагменты
+ * памяти у родительского аллокатора и выделяет из них блоки простым смещением
+ * указателя с учетом выравнивания. Отдельные блоки не освобождаются: вся память
+ * арены возвращается разом функциями `ae_arena_allocator_reset`,
+ * `ae_arena_allocator_rewind` или `ae_arena_allocator_clear`.
+ *
+ * Арена подключается везде, где ожидается `ae_memory_allocator_t`, через
+ * `ae_arena_allocator_get_allocator`. Например, ее можно временно установить
+ * аллокатором времени выполнения, чтобы все временные блоки обработки запроса
+ * освобождались одним вызовом `ae_arena_allocator_reset`.
+ *
+ * @see ae_arena_allocator_init
+ * @see ae_arena_allocator_get_allocator
+ */
+
+#ifndef AE_ARENA_ALLOCATOR_H
+#define AE_ARENA_ALLOCATOR_H
+
+#include "memory_allocator.h"
+#include "attribute.h"
+#include "size.h"
+
+/**
+ * @brief Отметка состояния арены.
+ *
+ * Возвращается функцией `ae_arena_allocator_mark` и позволяет функцией
+ * `ae_arena_allocator_rewind` освободить все блоки, выделенные после нее.
+ */
+typedef struct ae_arena_allocator_marker
+{
+    /**
+     * @brief Фрагмент, текущий на момент отметки.
+     */
+    struct ae_arena_allocator_chunk *chunk;
+
+    /**
+     * @brief Положение указателя выделения на момент отметки.
+     */
+    void *ptr;
+} ae_arena_allocator_marker_t;
+
+/**
+ * @brief Арена памяти.
+ *
+ * Структура содержит интерфейс аллокатора, контекстом которого является сама арена,
+ * поэтому после инициализации арену нельзя перемещать или копировать.
+ */
+typedef struct ae_arena_allocator
+{
+    /**
+     * @brief Интерфейс аллокатора, выделяющего память из арены.
+     */
+    ae_memory_allocator_t allocator;
+
+    /**
+     * @brief Родительский аллокатор, у которого запрашиваются фрагменты.
+     */
+    const ae_memory_allocator_t *parent;
+
+    /**
+     * @brief Текущий фрагмент; предыдущие фрагменты связаны в список через заголовки.
+     */
+    struct ae_arena_allocator_chunk *chunk;
+
+    /**
+     * @brief Указатель на начало свободной части текущего фрагмента.
+     */
+    void *ptr;
+
+    /**
+     * @brief Указатель на конец текущего фрагмента.
+     */
+    void *end;
+
+    /**
+     * @brief Начало последнего выделенного блока, который можно продлить на месте.
+     */
+    void *last;
+
+    /**
+     * @brief Размер первого фрагмента в байтах.
+     *
+     * Каждый следующий фрагмент вдвое больше текущего. Когда все фрагменты
+     * освобождены, рост снова начинается с этого размера.
+     */
+    ae_usize_t chunk_size;
+} ae_arena_allocator_t;
+
+AE_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Инициализирует пустую арену.
+ *
+ * Память у родительского аллокатора запрашивается при первом выделении.
+ * Каждый следующий фрагмент вдвое больше предыдущего, но не меньше,
+ * чем требуется для выделяемого блока.
+ *
+ * @param self Указатель на арену.
+ * @param parent Указатель на родительский аллокатор, который должен оставаться
+ *               доступным все время использования арены.
+ * @param chunk_size Размер первого фрагмента в байтах; если равен 0,
+ *                   используется `AE_ARENA_ALLOCATOR_CHUNK_SIZE`.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c self или @c parent является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+void
+ae_arena_allocator_init(ae_arena_allocator_t        *self,
+                        const ae_memory_allocator_t *parent,
+                        ae_usize_t                   chunk_size);
+
+/**
+ * @brief Возвращает интерфейс аллокатора, выделяющего память из арены.
+ *
+ * Функции освобождения интерфейса не возвращают память, кроме последнего
+ * выделенного блока; изменение размера последнего блока выполняется на месте.
+ *
+ * @param self Указатель на арену.
+ *
+ * @return Указатель на интерфейс аллокатора, действительный до перемещения арены.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c self является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+const ae_memory_allocator_t *
+ae_arena_allocator_get_allocator(const ae_arena_allocator_t *self);
+
+/**
+ * @brief Запоминает текущее состояние арены.
+ *
+ * @param self Указатель на арену.
+ *
+ * @return Отметка для функции `ae_arena_allocator_rewind`.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c self является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+ae_arena_allocator_marker_t
+ae_arena_allocator_mark(const ae_arena_allocator_t *self);
+
+/**
+ * @brief Освобождает все блоки, выделенные после отметки.
+ *
+ * Фрагменты, полученные после отметки, возвращаются родительскому аллокатору.
+ * Время работы не зависит от количества выделенных блоков.
+ *
+ * @param self Указатель на арену.
+ * @param marker Отметка, полученная от этой арены и еще не освобожденная
+ *               более ранним откатом, сбросом или очисткой.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c self является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+void
+ae_arena_allocator_rewind(ae_arena_allocator_t *self, ae_arena_allocator_marker_t marker);
+
+/**
+ * @brief Освобождает все блоки арены, сохраняя последний (наибольший) фрагмент.
+ *
+ * Остальные фрагменты возвращаются родительскому аллокатору, поэтому
+ * при повторяющейся нагрузке после первого цикла арена работает в одном
+ * фрагменте и не обращается к родительскому аллокатору.
+ *
+ * @param self Указатель на арену.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c self является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+void
+ae_arena_allocator_reset(ae_arena_allocator_t *self);
+
+/**
+ * @brief Освобождает все блоки арены и возвращает все фрагменты родительскому аллокатору.
+ *
+ * @param self Указатель на арену.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c self является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+void
+ae_arena_allocator_clear(ae_arena_allocator_t *self);
+
+AE_COMPILER(EXTERN_C_END)
+
+#endif // AE_ARENA_ALLOCATOR_H
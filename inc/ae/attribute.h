@@ -16,6 +16,7 @@
 #include "attribute_symbol.h"
 #include "attribute_target.h"
 #include "attribute_thread_local.h"
+#include "attribute_no_sanitize_address.h"
 
 /**
  * @def AE_ATTRIBUTE(N)
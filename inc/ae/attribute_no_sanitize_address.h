@@ -0,0 +1,31 @@
+/**
+ * @file attribute_no_sanitize_address.h
+ * @brief Заголовочный файл, который содержит макрос `AE_ATTRIBUTE_NO_SANITIZE_ADDRESS`,
+ *        оборачивающий макрос `AE_COMPILER_ATTRIBUTE_NO_SANITIZE_ADDRESS`.
+ *
+ * Макрос используется функциями, которые читают память блоками,
+ * выровненными внутри страницы, и поэтому могут затрагивать байты
+ * за пределами объекта, не выходя за пределы доступной памяти.
+ *
+ * Пример использования:
+ * @code
+ * AE_ATTRIBUTE(NO_SANITIZE_ADDRESS)
+ * static const ae_u8_t *find_terminator(const ae_u8_t *str);
+ * @endcode
+ *
+ * @see AE_COMPILER_ATTRIBUTE_NO_SANITIZE_ADDRESS
+ */
+
+#ifndef AE_ATTRIBUTE_NO_SANITIZE_ADDRESS_H
+#define AE_ATTRIBUTE_NO_SANITIZE_ADDRESS_H
+
+#include "compiler.h"
+
+/**
+ * @def AE_ATTRIBUTE_NO_SANITIZE_ADDRESS
+ * @brief Обертка для макроса `AE_COMPILER_ATTRIBUTE_NO_SANITIZE_ADDRESS`,
+ *        исключающего функцию из инструментирования AddressSanitizer.
+ */
+#define AE_ATTRIBUTE_NO_SANITIZE_ADDRESS AE_COMPILER_ATTRIBUTE_NO_SANITIZE_ADDRESS
+
+#endif // AE_ATTRIBUTE_NO_SANITIZE_ADDRESS_H
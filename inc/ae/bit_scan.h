@@ -0,0 +1,111 @@
+/**
+ * @file bit_scan.h
+ * @brief Функции поиска младшего и старшего установленного бита.
+ *
+ * Этот файл содержит встраиваемые функции, которые возвращают индекс
+ * младшего (`ae_bit_scan_forward*`) или старшего (`ae_bit_scan_reverse*`)
+ * установленного бита. Они используются SIMD-ядрами для преобразования
+ * масок сравнения в смещение найденного элемента.
+ *
+ * Для GCC и Clang используются встроенные функции `__builtin_ctz`/`__builtin_clz`,
+ * для MSVC — интринсики `_BitScanForward`/`_BitScanReverse`.
+ *
+ * @warning Результат не определен, если значение равно нулю.
+ */
+
+#ifndef AE_BIT_SCAN_H
+#define AE_BIT_SCAN_H
+
+#include "numeric_fixed_types.h"
+#include "compiler.h"
+
+#if (AE_COMPILER_TYPE == AE_COMPILER_TYPE_MSVC)
+#    include <intrin.h>
+#endif
+
+/**
+ * @brief Возвращает индекс младшего установленного бита 32-битного значения.
+ *
+ * @param value Ненулевое значение.
+ * @return Индекс бита от 0 до 31.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_u32_t
+ae_bit_scan_forward32(ae_u32_t value)
+{
+#if (AE_COMPILER_TYPE == AE_COMPILER_TYPE_GCC) || (AE_COMPILER_TYPE == AE_COMPILER_TYPE_CLANG)
+    return (ae_u32_t)__builtin_ctz(value);
+#elif (AE_COMPILER_TYPE == AE_COMPILER_TYPE_MSVC)
+    unsigned long index;
+    _BitScanForward(&index, value);
+    return (ae_u32_t)index;
+#else
+    ae_u32_t index = 0;
+    while (!(value & 1u))
+    {
+        value >>= 1;
+        index++;
+    }
+    return index;
+#endif
+}
+
+/**
+ * @brief Возвращает индекс младшего установленного бита 64-битного значения.
+ *
+ * @param value Ненулевое значение.
+ * @return Индекс бита от 0 до 63.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_u32_t
+ae_bit_scan_forward64(ae_u64_t value)
+{
+#if (AE_COMPILER_TYPE == AE_COMPILER_TYPE_GCC) || (AE_COMPILER_TYPE == AE_COMPILER_TYPE_CLANG)
+    return (ae_u32_t)__builtin_ctzll(value);
+#else
+    const ae_u32_t low = (ae_u32_t)value;
+    return low ? ae_bit_scan_forward32(low) : 32 + ae_bit_scan_forward32((ae_u32_t)(value >> 32));
+#endif
+}
+
+/**
+ * @brief Возвращает индекс старшего установленного бита 32-битного значения.
+ *
+ * @param value Ненулевое значение.
+ * @return Индекс бита от 0 до 31.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_u32_t
+ae_bit_scan_reverse32(ae_u32_t value)
+{
+#if (AE_COMPILER_TYPE == AE_COMPILER_TYPE_GCC) || (AE_COMPILER_TYPE == AE_COMPILER_TYPE_CLANG)
+    return 31u - (ae_u32_t)__builtin_clz(value);
+#elif (AE_COMPILER_TYPE == AE_COMPILER_TYPE_MSVC)
+    unsigned long index;
+    _BitScanReverse(&index, value);
+    return (ae_u32_t)index;
+#else
+    ae_u32_t index = 0;
+    while (value >>= 1)
+    {
+        index++;
+    }
+    return index;
+#endif
+}
+
+/**
+ * @brief Возвращает индекс старшего установленного бита 64-битного значения.
+ *
+ * @param value Ненулевое значение.
+ * @return Индекс бита от 0 до 63.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_u32_t
+ae_bit_scan_reverse64(ae_u64_t value)
+{
+#if (AE_COMPILER_TYPE == AE_COMPILER_TYPE_GCC) || (AE_COMPILER_TYPE == AE_COMPILER_TYPE_CLANG)
+    return 63u - (ae_u32_t)__builtin_clzll(value);
+#else
+    const ae_u32_t high = (ae_u32_t)(value >> 32);
+    return high ? 32 + ae_bit_scan_reverse32(high) : ae_bit_scan_reverse32((ae_u32_t)value);
+#endif
+}
+
+#endif // AE_BIT_SCAN_H
@@ -0,0 +1,109 @@
+/**
+ * @file byte_class.h
+ * @brief Множество байт (класс байт) для векторного поиска.
+ *
+ * Данный файл содержит структуру `ae_byte_class_t`, которая описывает
+ * произвольное подмножество из 256 возможных значений байта
+ * (например, пробельные символы, разделители или кавычки).
+ *
+ * Помимо битовой карты класс хранит две таблицы по 16 байт, индексируемые
+ * младшей тетрадой байта. Бит `n` элемента таблицы `low` установлен,
+ * если в класс входит байт `(n << 4) | index`, а таблица `high` описывает
+ * аналогично байты от 0x80 до 0xFF. Такое представление позволяет
+ * проверять принадлежность сразу 16, 32 или 64 байт с помощью
+ * инструкции `pshufb` (см. `ae_memory_raw_find_class`).
+ *
+ * @see ae_byte_class_init
+ * @see ae_byte_class_add
+ * @see ae_byte_class_add_range
+ * @see ae_byte_class_contains
+ */
+
+#ifndef AE_BYTE_CLASS_H
+#define AE_BYTE_CLASS_H
+
+#include "attribute.h"
+#include "numeric_fixed_types.h"
+#include "bool.h"
+
+/**
+ * @brief Класс байт.
+ */
+typedef struct ae_byte_class
+{
+    /**
+     * @brief Битовая карта класса: байт @c b входит в класс,
+     *        если установлен бит `b & 7` элемента `bitmap[b >> 3]`.
+     */
+    ae_u8_t bitmap[32];
+
+    /**
+     * @brief Таблица для байт от 0x00 до 0x7F, индексируемая младшей тетрадой.
+     */
+    ae_u8_t low[16];
+
+    /**
+     * @brief Таблица для байт от 0x80 до 0xFF, индексируемая младшей тетрадой.
+     */
+    ae_u8_t high[16];
+} ae_byte_class_t;
+
+AE_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Инициализирует пустой класс байт.
+ *
+ * @param self Указатель на класс байт.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c self является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+void
+ae_byte_class_init(ae_byte_class_t *self);
+
+/**
+ * @brief Добавляет байт в класс.
+ *
+ * @param self Указатель на класс байт.
+ * @param value Добавляемый байт.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c self является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+void
+ae_byte_class_add(ae_byte_class_t *self, ae_u8_t value);
+
+/**
+ * @brief Добавляет в класс все байты из блока памяти.
+ *
+ * @param self Указатель на класс байт.
+ * @param begin Указатель на начало блока памяти.
+ * @param end Указатель на конец блока памяти.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c self или @c begin является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+void
+ae_byte_class_add_range(ae_byte_class_t *self, const void *begin, const void *end);
+
+/**
+ * @brief Проверяет, входит ли байт в класс.
+ *
+ * @param self Указатель на класс байт.
+ * @param value Проверяемый байт.
+ *
+ * @return `true`, если байт входит в класс, иначе `false`.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c self является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+bool
+ae_byte_class_contains(const ae_byte_class_t *self, ae_u8_t value);
+
+AE_COMPILER(EXTERN_C_END)
+
+#endif // AE_BYTE_CLASS_H
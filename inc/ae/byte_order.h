@@ -6,12 +6,31 @@
  * используемого в текущей системе. Он определяет, является ли
  * порядок байтов "слева направо" (big-endian) или "справа налево" (little-endian).
  *
+ * Кроме того, файл содержит функции перестановки байтов:
+ * - `ae_byte_order_swap16/32/64` - перестановка байтов одного значения
+ *   (компилируется в инструкцию `bswap`/`rol`);
+ * - `ae_byte_order_to_big*`, `ae_byte_order_from_big*` и аналогичные макросы
+ *   для little-endian - преобразование между порядком байтов системы
+ *   и заданным порядком (сетевой порядок байтов - big-endian);
+ * - `ae_byte_order_swap`, `ae_byte_order_swap_copy` и `ae_byte_order_convert_big*` -
+ *   преобразование массивов 16-, 32- и 64-битных значений, в том числе
+ *   при копировании. На x86 используются инструкции `pshufb`/`vpshufb`.
+ *
  * @note Используйте макрос AE_BYTE_ORDER для проверки порядка байтов.
  */
 
 #ifndef AE_BYTE_ORDER_H
 #define AE_BYTE_ORDER_H
 
+#include "numeric_fixed_types.h"
+#include "attribute.h"
+#include "compiler.h"
+#include "size.h"
+
+#if (AE_COMPILER_TYPE == AE_COMPILER_TYPE_MSVC)
+#    include <stdlib.h>
+#endif
+
 /**
  * @def AE_BYTE_ORDER_BIG_ENDIAN
  * @brief Значение, указывающее, что порядок байтов "слева направо".
@@ -49,4 +68,211 @@
 #    define AE_BYTE_ORDER AE_BYTE_ORDER_LITTLE_ENDIAN
 #endif
 
+/**
+ * @brief Переставляет байты 16-битного значения в обратном порядке.
+ *
+ * @param value Значение.
+ * @return Значение с обратным порядком байтов.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_u16_t
+ae_byte_order_swap16(ae_u16_t value)
+{
+#if (AE_COMPILER_TYPE == AE_COMPILER_TYPE_GCC) || (AE_COMPILER_TYPE == AE_COMPILER_TYPE_CLANG)
+    return __builtin_bswap16(value);
+#elif (AE_COMPILER_TYPE == AE_COMPILER_TYPE_MSVC)
+    return _byteswap_ushort(value);
+#else
+    return (ae_u16_t)((value >> 8) | (value << 8));
+#endif
+}
+
+/**
+ * @brief Переставляет байты 32-битного значения в обратном порядке.
+ *
+ * @param value Значение.
+ * @return Значение с обратным порядком байтов.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_u32_t
+ae_byte_order_swap32(ae_u32_t value)
+{
+#if (AE_COMPILER_TYPE == AE_COMPILER_TYPE_GCC) || (AE_COMPILER_TYPE == AE_COMPILER_TYPE_CLANG)
+    return __builtin_bswap32(value);
+#elif (AE_COMPILER_TYPE == AE_COMPILER_TYPE_MSVC)
+    return _byteswap_ulong(value);
+#else
+    return ((value >> 24) & 0x000000FF) | ((value >> 8) & 0x0000FF00) |
+           ((value << 8) & 0x00FF0000) | ((value << 24) & 0xFF000000);
+#endif
+}
+
+/**
+ * @brief Переставляет байты 64-битного значения в обратном порядке.
+ *
+ * @param value Значение.
+ * @return Значение с обратным порядком байтов.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_u64_t
+ae_byte_order_swap64(ae_u64_t value)
+{
+#if (AE_COMPILER_TYPE == AE_COMPILER_TYPE_GCC) || (AE_COMPILER_TYPE == AE_COMPILER_TYPE_CLANG)
+    return __builtin_bswap64(value);
+#elif (AE_COMPILER_TYPE == AE_COMPILER_TYPE_MSVC)
+    return _byteswap_uint64(value);
+#else
+    return ((ae_u64_t)ae_byte_order_swap32((ae_u32_t)value) << 32) |
+           ae_byte_order_swap32((ae_u32_t)(value >> 32));
+#endif
+}
+
+#if AE_BYTE_ORDER == AE_BYTE_ORDER_LITTLE_ENDIAN
+/** @brief Преобразует 16-битное значение из порядка байтов системы в big-endian. */
+#    define ae_byte_order_to_big16(x) ae_byte_order_swap16(x)
+/** @brief Преобразует 32-битное значение из порядка байтов системы в big-endian. */
+#    define ae_byte_order_to_big32(x) ae_byte_order_swap32(x)
+/** @brief Преобразует 64-битное значение из порядка байтов системы в big-endian. */
+#    define ae_byte_order_to_big64(x) ae_byte_order_swap64(x)
+/** @brief Преобразует 16-битное значение из порядка байтов системы в little-endian. */
+#    define ae_byte_order_to_little16(x) ((ae_u16_t)(x))
+/** @brief Преобразует 32-битное значение из порядка байтов системы в little-endian. */
+#    define ae_byte_order_to_little32(x) ((ae_u32_t)(x))
+/** @brief Преобразует 64-битное значение из порядка байтов системы в little-endian. */
+#    define ae_byte_order_to_little64(x) ((ae_u64_t)(x))
+#else
+#    define ae_byte_order_to_big16(x) ((ae_u16_t)(x))
+#    define ae_byte_order_to_big32(x) ((ae_u32_t)(x))
+#    define ae_byte_order_to_big64(x) ((ae_u64_t)(x))
+#    define ae_byte_order_to_little16(x) ae_byte_order_swap16(x)
+#    define ae_byte_order_to_little32(x) ae_byte_order_swap32(x)
+#    define ae_byte_order_to_little64(x) ae_byte_order_swap64(x)
+#endif // AE_BYTE_ORDER == AE_BYTE_ORDER_LITTLE_ENDIAN
+
+/** @brief Преобразует 16-битное значение из big-endian в порядок байтов системы. */
+#define ae_byte_order_from_big16(x) ae_byte_order_to_big16(x)
+/** @brief Преобразует 32-битное значение из big-endian в порядок байтов системы. */
+#define ae_byte_order_from_big32(x) ae_byte_order_to_big32(x)
+/** @brief Преобразует 64-битное значение из big-endian в порядок байтов системы. */
+#define ae_byte_order_from_big64(x) ae_byte_order_to_big64(x)
+/** @brief Преобразует 16-битное значение из little-endian в порядок байтов системы. */
+#define ae_byte_order_from_little16(x) ae_byte_order_to_little16(x)
+/** @brief Преобразует 32-битное значение из little-endian в порядок байтов системы. */
+#define ae_byte_order_from_little32(x) ae_byte_order_to_little32(x)
+/** @brief Преобразует 64-битное значение из little-endian в порядок байтов системы. */
+#define ae_byte_order_from_little64(x) ae_byte_order_to_little64(x)
+
+AE_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Выбирает варианты ядер функций модуля.
+ *
+ * Аналогична `ae_memory_raw_dispatch`: при загрузке библиотеки вызывается
+ * автоматически со значением `AE_CPU_FEATURE_ALL`.
+ *
+ * @param features Битовая маска значений `ae_cpu_feature_t`.
+ *
+ * @note Функция не является потокобезопасной и должна вызываться
+ *       до использования функций модуля из других потоков.
+ */
+AE_ATTRIBUTE(SYMBOL)
+void
+ae_byte_order_dispatch(ae_u32_t features);
+
+/**
+ * @brief Переставляет байты каждого элемента массива в обратном порядке.
+ *
+ * Обрабатываются только полные элементы; байты после последнего
+ * полного элемента не изменяются.
+ *
+ * @param begin Указатель на начало массива.
+ * @param end Указатель на конец массива.
+ * @param width Размер элемента в байтах: 2, 4 или 8.
+ *
+ * @return Указатель на конец обработанных элементов.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c begin является NULL.
+ * @throw AE_RUNTIME_ERROR_INVALID_ARGUMENT
+ *        Если @c width не равен 2, 4 или 8.
+ */
+AE_ATTRIBUTE(SYMBOL)
+void *
+ae_byte_order_swap(void *begin, const void *end, ae_usize_t width);
+
+/**
+ * @brief Копирует массив, переставляя байты каждого элемента в обратном порядке.
+ *
+ * Копируется столько полных элементов, сколько помещается в меньший из буферов.
+ * Буферы могут совпадать; частичное перекрытие допускается,
+ * только если целевой буфер начинается не позже источника.
+ *
+ * @param dst Указатель на целевой буфер.
+ * @param dst_end Указатель на конец целевого буфера.
+ * @param src Указатель на исходный буфер.
+ * @param src_end Указатель на конец исходного буфера.
+ * @param width Размер элемента в байтах: 2, 4 или 8.
+ *
+ * @return Указатель на конец скопированных элементов в целевом буфере.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c dst или @c src является NULL.
+ * @throw AE_RUNTIME_ERROR_INVALID_ARGUMENT
+ *        Если @c width не равен 2, 4 или 8.
+ */
+AE_ATTRIBUTE(SYMBOL)
+void *
+ae_byte_order_swap_copy(void       *dst,
+                        const void *dst_end,
+                        const void *src,
+                        const void *src_end,
+                        ae_usize_t  width);
+
+/**
+ * @brief Преобразует массив между порядком байтов системы и big-endian (сетевым).
+ *
+ * На little-endian системах равносильна `ae_byte_order_swap`,
+ * на big-endian системах данные не изменяются.
+ *
+ * @param begin Указатель на начало массива.
+ * @param end Указатель на конец массива.
+ * @param width Размер элемента в байтах: 2, 4 или 8.
+ *
+ * @return Указатель на конец обработанных элементов.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c begin является NULL.
+ * @throw AE_RUNTIME_ERROR_INVALID_ARGUMENT
+ *        Если @c width не равен 2, 4 или 8.
+ */
+AE_ATTRIBUTE(SYMBOL)
+void *
+ae_byte_order_convert_big(void *begin, const void *end, ae_usize_t width);
+
+/**
+ * @brief Копирует массив, преобразуя его между порядком байтов системы и big-endian.
+ *
+ * На little-endian системах равносильна `ae_byte_order_swap_copy`,
+ * на big-endian системах выполняет копирование без перестановки байтов.
+ *
+ * @param dst Указатель на целевой буфер.
+ * @param dst_end Указатель на конец целевого буфера.
+ * @param src Указатель на исходный буфер.
+ * @param src_end Указатель на конец исходного буфера.
+ * @param width Размер элемента в байтах: 2, 4 или 8.
+ *
+ * @return Указатель на конец скопированных элементов в целевом буфере.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c dst или @c src является NULL.
+ * @throw AE_RUNTIME_ERROR_INVALID_ARGUMENT
+ *        Если @c width не равен 2, 4 или 8.
+ */
+AE_ATTRIBUTE(SYMBOL)
+void *
+ae_byte_order_convert_big_copy(void       *dst,
+                               const void *dst_end,
+                               const void *src,
+                               const void *src_end,
+                               ae_usize_t  width);
+
+AE_COMPILER(EXTERN_C_END)
+
 #endif // AE_BYTE_ORDER_H
\ No newline at end of file
@@ -13,6 +13,7 @@
  * - `compiler_extern_c.h`: Управляет линковкой C для совместимости с C++.
  * - `compiler_attribute.h`: Предоставляет различные атрибуты компилятора.
  * - `compiler_bit_depth.h`: Определяет разрядность системы (32 или 64 бита).
+ * - `compiler_arch.h`: Определяет семейство целевой архитектуры процессора.
  * - `compiler_destructor.h`: Определяет атрибуты для вызова деструкторов.
  * - `compiler_constructor.h`: Определяет атрибуты для вызова конструкторов.
  * - `compiler_std_version.h`: Определяет используемую версию стандарта C.
@@ -28,6 +29,7 @@
 #include "compiler_extern_c.h"
 #include "compiler_attribute.h"
 #include "compiler_bit_depth.h"
+#include "compiler_arch.h"
 #include "compiler_destructor.h"
 #include "compiler_constructor.h"
 #include "compiler_std_version.h"
@@ -0,0 +1,41 @@
+/**
+ * @file compiler_arch.h
+ * @brief Определение макросов для определения целевой архитектуры процессора.
+ *
+ * Этот файл предоставляет макрос `AE_COMPILER_ARCH_X86`,
+ * который указывает, что код компилируется для семейства x86 (32 или 64 бита).
+ *
+ * Макрос используется для условной компиляции архитектурно-зависимого кода,
+ * например, SIMD-ядер на основе инструкций SSE/AVX и определения
+ * возможностей процессора через инструкцию CPUID.
+ *
+ * Поддерживаемые компиляторы:
+ * - GCC и Clang (`__x86_64__`, `__i386__`)
+ * - MSVC (`_M_X64`, `_M_IX86`)
+ *
+ * @note На остальных архитектурах макрос определяется как 0,
+ *       и используются переносимые реализации.
+ */
+
+#ifndef AE_COMPILER_ARCH_H
+#define AE_COMPILER_ARCH_H
+
+#if defined(__x86_64__) || defined(__x86_64) || defined(__amd64__) || defined(__amd64) ||          \
+    defined(_M_X64) || defined(_M_AMD64) || defined(__i386__) || defined(__i386) ||                \
+    defined(_M_IX86)
+/**
+ * @def AE_COMPILER_ARCH_X86
+ * @brief Макрос, указывающий, что целевая архитектура
+ *        относится к семейству x86 (x86 или x86-64).
+ */
+#    define AE_COMPILER_ARCH_X86 1
+#else
+/**
+ * @def AE_COMPILER_ARCH_X86
+ * @brief Макрос, указывающий, что целевая архитектура
+ *        не относится к семейству x86.
+ */
+#    define AE_COMPILER_ARCH_X86 0
+#endif
+
+#endif // AE_COMPILER_ARCH_H
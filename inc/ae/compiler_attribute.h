@@ -16,6 +16,8 @@
  *    Атрибуты для пометки неиспользуемых переменных и функций.
  * - `compiler_attribute_thread_local.h`:
  *    Атрибуты для поддержки потоковой локальности.
+ * - `compiler_attribute_no_sanitize_address.h`:
+ *    Атрибуты для исключения функций из проверок AddressSanitizer.
  *
  * @note Этот заголовок упрощает управление атрибутами компилятора,
  *       делая код более переносимым и единообразным
@@ -30,5 +32,6 @@
 #include "compiler_attribute_unused.h"
 #include "compiler_attribute_target.h"
 #include "compiler_attribute_thread_local.h"
+#include "compiler_attribute_no_sanitize_address.h"
 
 #endif // AE_COMPILER_ATTRIBUTE_H
@@ -0,0 +1,43 @@
+/**
+ * @file compiler_attribute_no_sanitize_address.h
+ * @brief Определение макроса для отключения проверок AddressSanitizer в функции.
+ *
+ * Этот файл предоставляет макрос `AE_COMPILER_ATTRIBUTE_NO_SANITIZE_ADDRESS`,
+ * который исключает функцию из инструментирования AddressSanitizer.
+ *
+ * Атрибут необходим функциям, которые намеренно читают память за пределами
+ * объекта, но в пределах той же страницы памяти (например, векторный поиск
+ * нулевого терминатора строки неизвестной длины). Такое чтение безопасно,
+ * но AddressSanitizer сообщает о нем как об ошибке.
+ *
+ * Макрос поддерживает разные реализации в зависимости от компилятора:
+ * - GCC и Clang: атрибут `__attribute__((no_sanitize_address))`
+ * - MSVC: спецификатор `__declspec(no_sanitize_address)`
+ */
+
+#ifndef AE_COMPILER_ATTRIBUTE_NO_SANITIZE_ADDRESS_H
+#define AE_COMPILER_ATTRIBUTE_NO_SANITIZE_ADDRESS_H
+
+#include "compiler_type.h"
+
+#if (AE_COMPILER_TYPE == AE_COMPILER_TYPE_GCC) || (AE_COMPILER_TYPE == AE_COMPILER_TYPE_CLANG)
+/**
+ * @def AE_COMPILER_ATTRIBUTE_NO_SANITIZE_ADDRESS
+ * @brief Исключает функцию из инструментирования AddressSanitizer в GCC/Clang.
+ */
+#    define AE_COMPILER_ATTRIBUTE_NO_SANITIZE_ADDRESS __attribute__((no_sanitize_address))
+#elif (AE_COMPILER_TYPE == AE_COMPILER_TYPE_MSVC)
+/**
+ * @def AE_COMPILER_ATTRIBUTE_NO_SANITIZE_ADDRESS
+ * @brief Исключает функцию из инструментирования AddressSanitizer в MSVC.
+ */
+#    define AE_COMPILER_ATTRIBUTE_NO_SANITIZE_ADDRESS __declspec(no_sanitize_address)
+#else
+/**
+ * @def AE_COMPILER_ATTRIBUTE_NO_SANITIZE_ADDRESS
+ * @brief Заглушка для компиляторов без поддержки AddressSanitizer.
+ */
+#    define AE_COMPILER_ATTRIBUTE_NO_SANITIZE_ADDRESS
+#endif
+
+#endif // AE_COMPILER_ATTRIBUTE_NO_SANITIZE_ADDRESS_H
@@ -0,0 +1,184 @@
+/**
+ * @file cpu_feature.h
+ * @brief Определение возможностей процессора во время выполнения.
+ *
+ * Этот файл содержит перечисление `ae_cpu_feature_t` с наборами инструкций,
+ * которые используются SIMD-ядрами библиотеки, и функции для их определения.
+ *
+ * На архитектуре x86 возможности определяются с помощью инструкции CPUID,
+ * а для расширений AVX и AVX-512 дополнительно проверяется (через XGETBV),
+ * что операционная система сохраняет соответствующие регистры при переключении контекста.
+ * На остальных архитектурах набор возможностей всегда пуст.
+ *
+ * Кроме того, определяется размер кэша последнего уровня, по которому
+ * выбираются пороги для операций с большими блоками памяти.
+ *
+ * Результат определения вычисляется один раз при загрузке библиотеки
+ * и далее возвращается из кэша.
+ *
+ * @see ae_cpu_feature_get
+ * @see ae_cpu_feature_has
+ * @see ae_cpu_feature_cache_size
+ */
+
+#ifndef AE_CPU_FEATURE_H
+#define AE_CPU_FEATURE_H
+
+#include "attribute.h"
+#include "numeric_fixed_types.h"
+#include "bool.h"
+#include "size.h"
+
+/**
+ * @enum ae_cpu_feature_t
+ * @brief Битовые флаги наборов инструкций процессора.
+ *
+ * Каждое значение занимает отдельный бит, поэтому флаги
+ * можно объединять с помощью побитового ИЛИ.
+ */
+typedef enum
+{
+    /** @brief Набор возможностей пуст. */
+    AE_CPU_FEATURE_NONE = 0,
+
+    /** @brief Поддержка SSE2. */
+    AE_CPU_FEATURE_SSE2 = 1 << 0,
+
+    /** @brief Поддержка SSE3. */
+    AE_CPU_FEATURE_SSE3 = 1 << 1,
+
+    /** @brief Поддержка SSSE3 (в том числе инструкции `pshufb`). */
+    AE_CPU_FEATURE_SSSE3 = 1 << 2,
+
+    /** @brief Поддержка SSE4.1. */
+    AE_CPU_FEATURE_SSE41 = 1 << 3,
+
+    /** @brief Поддержка SSE4.2 (в том числе инструкции `crc32`). */
+    AE_CPU_FEATURE_SSE42 = 1 << 4,
+
+    /** @brief Поддержка инструкции `popcnt`. */
+    AE_CPU_FEATURE_POPCNT = 1 << 5,
+
+    /** @brief Поддержка AVX (с учетом поддержки операционной системой). */
+    AE_CPU_FEATURE_AVX = 1 << 6,
+
+    /** @brief Поддержка AVX2 (с учетом поддержки операционной системой). */
+    AE_CPU_FEATURE_AVX2 = 1 << 7,
+
+    /** @brief Поддержка BMI1. */
+    AE_CPU_FEATURE_BMI1 = 1 << 8,
+
+    /** @brief Поддержка BMI2. */
+    AE_CPU_FEATURE_BMI2 = 1 << 9,
+
+    /** @brief Поддержка AVX-512 Foundation (с учетом поддержки операционной системой). */
+    AE_CPU_FEATURE_AVX512F = 1 << 10,
+
+    /** @brief Поддержка AVX-512 Byte and Word. */
+    AE_CPU_FEATURE_AVX512BW = 1 << 11,
+
+    /** @brief Поддержка AVX-512 Vector Length. */
+    AE_CPU_FEATURE_AVX512VL = 1 << 12,
+
+    /** @brief Поддержка AVX-512 Vector Byte Manipulation (в том числе `vpermb`). */
+    AE_CPU_FEATURE_AVX512VBMI = 1 << 13,
+
+    /** @brief Поддержка AVX-512 `vpopcntd`/`vpopcntq`. */
+    AE_CPU_FEATURE_AVX512VPOPCNTDQ = 1 << 14,
+
+    /** @brief Все известные возможности (используется для снятия ограничений). */
+    AE_CPU_FEATURE_ALL = (1 << 15) - 1
+} ae_cpu_feature_t;
+
+/*
+ * Макросы AE_CPU_FEATURE_KERNEL_* определяют, какие варианты SIMD-ядер
+ * собираются внутри библиотеки. При включенной опции
+ * `AE_LIBRARY_OPTION_RUNTIME_DISPATCH` на x86 собираются все варианты
+ * (через атрибут `target`), иначе — только разрешенные опциями компиляции.
+ */
+#if AE_COMPILER_ARCH_X86 && defined(AE_LIBRARY_OPTION_RUNTIME_DISPATCH)
+/** @brief Собирать варианты ядер на основе SSE2. */
+#    define AE_CPU_FEATURE_KERNEL_SSE2 1
+/** @brief Собирать варианты ядер на основе SSE4.2 (инструкция `crc32`). */
+#    define AE_CPU_FEATURE_KERNEL_SSE42 1
+/** @brief Собирать варианты ядер на основе AVX. */
+#    define AE_CPU_FEATURE_KERNEL_AVX 1
+/** @brief Собирать варианты ядер на основе AVX2. */
+#    define AE_CPU_FEATURE_KERNEL_AVX2 1
+/** @brief Собирать варианты ядер на основе AVX-512 (F и BW). */
+#    define AE_CPU_FEATURE_KERNEL_AVX512 1
+#elif AE_COMPILER_ARCH_X86
+#    if defined(AE_COMPILE_OPTION_SSE) || defined(AE_COMPILE_OPTION_AVX) ||                        \
+        defined(AE_COMPILE_OPTION_AVX2) || defined(AE_COMPILE_OPTION_AVX512)
+#        define AE_CPU_FEATURE_KERNEL_SSE2 1
+#    endif
+#    if defined(AE_COMPILE_OPTION_AVX) || defined(AE_COMPILE_OPTION_AVX2) ||                       \
+        defined(AE_COMPILE_OPTION_AVX512)
+#        define AE_CPU_FEATURE_KERNEL_SSE42 1
+#        define AE_CPU_FEATURE_KERNEL_AVX 1
+#    endif
+#    if defined(AE_COMPILE_OPTION_AVX2) || defined(AE_COMPILE_OPTION_AVX512)
+#        define AE_CPU_FEATURE_KERNEL_AVX2 1
+#    endif
+#    if defined(AE_COMPILE_OPTION_AVX512)
+#        define AE_CPU_FEATURE_KERNEL_AVX512 1
+#    endif
+#endif
+
+#ifndef AE_CPU_FEATURE_KERNEL_SSE2
+#    define AE_CPU_FEATURE_KERNEL_SSE2 0
+#endif
+#ifndef AE_CPU_FEATURE_KERNEL_SSE42
+#    define AE_CPU_FEATURE_KERNEL_SSE42 0
+#endif
+#ifndef AE_CPU_FEATURE_KERNEL_AVX
+#    define AE_CPU_FEATURE_KERNEL_AVX 0
+#endif
+#ifndef AE_CPU_FEATURE_KERNEL_AVX2
+#    define AE_CPU_FEATURE_KERNEL_AVX2 0
+#endif
+#ifndef AE_CPU_FEATURE_KERNEL_AVX512
+#    define AE_CPU_FEATURE_KERNEL_AVX512 0
+#endif
+
+AE_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Возвращает набор возможностей текущего процессора.
+ *
+ * При первом вызове выполняет определение возможностей,
+ * последующие вызовы возвращают сохраненный результат.
+ *
+ * @return Битовая маска значений `ae_cpu_feature_t`.
+ */
+AE_ATTRIBUTE(SYMBOL)
+ae_u32_t
+ae_cpu_feature_get();
+
+/**
+ * @brief Проверяет, поддерживает ли процессор все указанные возможности.
+ *
+ * @param features Битовая маска значений `ae_cpu_feature_t`.
+ *
+ * @return `true`, если все указанные возможности поддерживаются,
+ *         иначе `false`.
+ */
+AE_ATTRIBUTE(SYMBOL)
+bool
+ae_cpu_feature_has(ae_u32_t features);
+
+/**
+ * @brief Возвращает размер кэша последнего уровня процессора.
+ *
+ * На x86 размер определяется по листам CPUID 4 (Intel) или 0x8000001D (AMD),
+ * а при их отсутствии - по листу 0x80000006.
+ *
+ * @return Размер кэша в байтах или 0, если его не удалось определить.
+ */
+AE_ATTRIBUTE(SYMBOL)
+ae_usize_t
+ae_cpu_feature_cache_size();
+
+AE_COMPILER(EXTERN_C_END)
+
+#endif // AE_CPU_FEATURE_H
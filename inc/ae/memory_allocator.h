@@ -19,6 +19,12 @@
 
 #include "memory_allocator_alloc_fn.h"
 #include "memory_allocator_dealloc_fn.h"
+#include "memory_allocator_realloc_fn.h"
+#include "memory_allocator_expand_fn.h"
+#include "memory_allocator_align_alloc_fn.h"
+#include "memory_allocator_align_dealloc_fn.h"
+#include "memory_allocator_align_realloc_fn.h"
+#include "memory_allocator_sized_dealloc_fn.h"
 #include "attribute.h"
 
 /**
@@ -26,7 +32,12 @@
  * @brief Структура, представляющая аллокатор памяти.
  *
  * Эта структура используется для управления выделением и освобождением памяти.
- * Она включает в себя указатели на функции для выделения и освобождения памяти.
+ * Она включает в себя указатели на функции для выделения и освобождения памяти
+ * и пользовательский контекст, который передается каждой из них первым аргументом.
+ *
+ * Функции `realloc_fn`, `expand_fn`, `align_alloc_fn`, `align_dealloc_fn`,
+ * `align_realloc_fn` и `sized_dealloc_fn` необязательны: если они не заданы,
+ * соответствующие операции выполняются через `alloc_fn` и `dealloc_fn`.
  */
 typedef struct ae_memory_allocator
 {
@@ -45,6 +56,65 @@ typedef struct ae_memory_allocator
      * Эта функция должна быть реализована пользователем.
      */
     ae_memory_allocator_dealloc_fn *dealloc_fn;
+
+    /**
+     * @brief Пользовательский контекст аллокатора.
+     *
+     * Передается первым аргументом во все функции аллокатора и позволяет
+     * подключать пулы, арены и другие аллокаторы с состоянием
+     * без глобальных переменных.
+     */
+    void *context;
+
+    /**
+     * @brief Необязательная функция изменения размера памяти.
+     *
+     * Если задана, используется функцией `ae_memory_allocator_realloc`
+     * вместо выделения нового блока, копирования и освобождения старого.
+     */
+    ae_memory_allocator_realloc_fn *realloc_fn;
+
+    /**
+     * @brief Необязательная функция изменения размера блока на месте.
+     *
+     * Если задана, функция `ae_memory_allocator_realloc` сначала пытается
+     * изменить размер блока ею и только при неудаче перемещает блок.
+     */
+    ae_memory_allocator_expand_fn *expand_fn;
+
+    /**
+     * @brief Необязательная функция выделения выровненной памяти.
+     *
+     * Используется функцией `ae_memory_allocator_align_alloc` только вместе
+     * с функцией `align_dealloc_fn`: если задана лишь одна из них,
+     * выравнивание выполняется через `alloc_fn` и `dealloc_fn`.
+     */
+    ae_memory_allocator_align_alloc_fn *align_alloc_fn;
+
+    /**
+     * @brief Необязательная функция освобождения выровненной памяти.
+     *
+     * Освобождает блоки, выделенные функцией `align_alloc_fn`. Используется
+     * функцией `ae_memory_allocator_align_free` только вместе
+     * с функцией `align_alloc_fn`.
+     */
+    ae_memory_allocator_align_dealloc_fn *align_dealloc_fn;
+
+    /**
+     * @brief Необязательная функция изменения размера выровненной памяти.
+     *
+     * Используется функцией `ae_memory_allocator_align_realloc` для блоков,
+     * выделенных функцией `align_alloc_fn`, вместо копирования в новый блок.
+     */
+    ae_memory_allocator_align_realloc_fn *align_realloc_fn;
+
+    /**
+     * @brief Необязательная функция освобождения памяти известного размера.
+     *
+     * Если задана, используется функцией `ae_memory_allocator_free_sized`
+     * вместо функции `dealloc_fn`.
+     */
+    ae_memory_allocator_sized_dealloc_fn *sized_dealloc_fn;
 } ae_memory_allocator_t;
 
 // ------------------------------------------ Методы ------------------------------------------ //
@@ -93,6 +163,20 @@ AE_ATTRIBUTE(SYMBOL)
 ae_memory_allocator_dealloc_fn *
 ae_memory_allocator_get_dealloc_fn(const void *self);
 
+/**
+ * @brief Получает пользовательский контекст аллокатора.
+ *
+ * @param self Указатель на структуру аллокатора памяти.
+ *
+ * @return Контекст, передаваемый функциям аллокатора первым аргументом.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если указатель на `self` равен `null`.
+ */
+AE_ATTRIBUTE(SYMBOL)
+void *
+ae_memory_allocator_get_context(const void *self);
+
 /**
  * @brief Выделяет память заданного размера с использованием аллокатора.
  *
@@ -159,6 +243,30 @@ AE_ATTRIBUTE(SYMBOL)
 void
 ae_memory_allocator_free(const void *self, void *ptr);
 
+/**
+ * @brief Освобождает ранее выделенный блок памяти известного размера.
+ *
+ * Если аллокатор задает функцию `sized_dealloc_fn`, блок освобождается ею
+ * с передачей размера, иначе вызов эквивалентен `ae_memory_allocator_free`.
+ *
+ * @param self Указатель на структуру аллокатора памяти.
+ * @param ptr Указатель на блок памяти, который необходимо освободить.
+ * @param size Размер блока в байтах, с которым он был выделен.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если указатель на `self` равен `null`.
+ * @throw AE_RUNTIME_ERROR_DEALLOCATOR_FUNCTION_NOT_INITIALIZED
+ *        Если ни одна из функций освобождения памяти не инициализирована.
+ *
+ * @note Если указатель `ptr` равен `null`,
+ *       функция завершает выполнение без каких-либо действий.
+ *
+ * @see ae_memory_allocator_free
+ */
+AE_ATTRIBUTE(SYMBOL)
+void
+ae_memory_allocator_free_sized(const void *self, void *ptr, ae_usize_t size);
+
 /**
  * @brief Изменяет размер ранее выделенного блока памяти.
  *
@@ -194,6 +302,10 @@ ae_memory_allocator_free(const void *self, void *ptr);
  * @note Если `old_ptr` равен `null`, будет выделена новая память.
  *       Если `new_size` равен 0, память будет освобождена.
  *
+ * @note Размер изменяется первым доступным способом: на месте функцией `expand_fn`,
+ *       функцией `realloc_fn` или выделением нового блока с копированием данных
+ *       и освобождением старого.
+ *
  * @see ae_memory_allocator_alloc
  * @see ae_memory_allocator_free
  */
@@ -225,6 +337,8 @@ ae_memory_allocator_realloc(const void *self,
  *
  * @throw AE_RUNTIME_ERROR_NULL_POINTER
  *        Если указатель на `self` равен `null`.
+ * @throw AE_RUNTIME_ERROR_ZERO_MEMORY_SIZE
+ *        Если `size` равен 0.
  * @throw AE_RUNTIME_ERROR_NOT_POWER_OF_TWO
  *        Если `alignment_size` не является степенью двойки.
  * @throw AE_RUNTIME_ERROR_MEMORY_NOT_ALLOCATED
@@ -232,8 +346,10 @@ ae_memory_allocator_realloc(const void *self,
  * @throw AE_RUNTIME_ERROR_ALLOCATOR_FUNCTION_NOT_INITIALIZED
  *        Если функция выделения памяти не инициализирована.
  *
- * @note Указатель на невыравненную память сохраняется перед выровненным
- *       указателем для последующего освобождения.
+ * @note Если аллокатор задает функции `align_alloc_fn` и `align_dealloc_fn`,
+ *       память выделяется ими. Иначе блок выделяется с запасом, а указатель
+ *       на невыравненную память сохраняется перед выровненным указателем
+ *       для последующего освобождения.
  *
  * @see ae_memory_allocator_alloc
  */
@@ -248,7 +364,9 @@ ae_memory_allocator_align_alloc(const void *self, ae_usize_t size, ae_usize_t al
  * функции `ae_memory_allocator_align_alloc`:
  *
  * - Указатель `ptr` должен указывать на выровненный блок памяти.
- * - Функция извлекает указатель на невыравненную память и освобождает его.
+ * - Если аллокатор задает функции `align_alloc_fn` и `align_dealloc_fn`,
+ *   блок освобождается функцией `align_dealloc_fn`.
+ * - Иначе функция извлекает указатель на невыравненную память и освобождает его.
  * - Если указатель `ptr` равен `null`, функция завершает выполнение без каких-либо действий.
  *
  * @param self Указатель на структуру аллокатора памяти,
@@ -307,8 +425,10 @@ ae_memory_allocator_align_free(const void *self, void *ptr);
  * @throw AE_RUNTIME_ERROR_DEALLOCATOR_FUNCTION_NOT_INITIALIZED
  *        Если функция освобождения памяти не инициализирована.
  *
- * @note Указатель на невыравненную память сохраняется перед выровненным
- *       указателем для последующего освобождения.
+ * @note Если аллокатор задает функции `align_alloc_fn`, `align_dealloc_fn`
+ *       и `align_realloc_fn`, размер изменяется функцией `align_realloc_fn`.
+ *       Иначе новый блок выделяется функцией `ae_memory_allocator_align_alloc`,
+ *       данные копируются, а старый блок освобождается.
  *
  * @see ae_memory_allocator_align_alloc
  * @see ae_memory_allocator_align_free
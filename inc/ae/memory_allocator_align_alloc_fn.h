@@ -0,0 +1,31 @@
+/**
+ * @file memory_allocator_align_alloc_fn.h
+ * @brief Заголовочный файл для определения типа функции выделения выровненной памяти.
+ *
+ * Этот файл содержит определение типа необязательной функции аллокатора,
+ * которая выделяет выровненный блок собственными средствами
+ * (например, через `aligned_alloc` или `posix_memalign`).
+ *
+ * @note Функция задается вместе с функцией освобождения выровненной памяти
+ *       `ae_memory_allocator_align_dealloc_fn`.
+ */
+
+#ifndef AE_MEMORY_ALLOCATOR_ALIGN_ALLOC_FN_H
+#define AE_MEMORY_ALLOCATOR_ALIGN_ALLOC_FN_H
+
+#include "size.h"
+
+/**
+ * @typedef ae_memory_allocator_align_alloc_fn
+ * @brief Тип функции для выделения выровненной памяти.
+ *
+ * @param context Пользовательский контекст аллокатора.
+ * @param size Размер памяти в байтах (не равен 0).
+ * @param alignment Размер выравнивания в байтах (степень двойки).
+ * @return Указатель на выровненную память или NULL в случае ошибки.
+ */
+typedef void *(ae_memory_allocator_align_alloc_fn)(void      *context,
+                                                   ae_usize_t size,
+                                                   ae_usize_t alignment);
+
+#endif // AE_MEMORY_ALLOCATOR_ALIGN_ALLOC_FN_H
@@ -0,0 +1,21 @@
+/**
+ * @file memory_allocator_align_dealloc_fn.h
+ * @brief Заголовочный файл для определения типа функции освобождения выровненной памяти.
+ *
+ * Этот файл содержит определение типа необязательной функции аллокатора,
+ * которая освобождает блок, выделенный функцией `ae_memory_allocator_align_alloc_fn`.
+ */
+
+#ifndef AE_MEMORY_ALLOCATOR_ALIGN_DEALLOC_FN_H
+#define AE_MEMORY_ALLOCATOR_ALIGN_DEALLOC_FN_H
+
+/**
+ * @typedef ae_memory_allocator_align_dealloc_fn
+ * @brief Тип функции для освобождения выровненной памяти.
+ *
+ * @param context Пользовательский контекст аллокатора.
+ * @param ptr Указатель на выровненную память, которую необходимо освободить.
+ */
+typedef void(ae_memory_allocator_align_dealloc_fn)(void *context, void *ptr);
+
+#endif // AE_MEMORY_ALLOCATOR_ALIGN_DEALLOC_FN_H
@@ -0,0 +1,37 @@
+/**
+ * @file memory_allocator_align_realloc_fn.h
+ * @brief Заголовочный файл для определения типа функции изменения размера выровненной памяти.
+ *
+ * Этот файл содержит определение типа необязательной функции аллокатора,
+ * которая изменяет размер блока, выделенного функцией `ae_memory_allocator_align_alloc_fn`,
+ * сохраняя его выравнивание (например, через `_aligned_realloc`).
+ *
+ * @note Если функция не задана, размер выровненного блока изменяется
+ *       выделением нового блока, копированием и освобождением старого.
+ */
+
+#ifndef AE_MEMORY_ALLOCATOR_ALIGN_REALLOC_FN_H
+#define AE_MEMORY_ALLOCATOR_ALIGN_REALLOC_FN_H
+
+#include "size.h"
+
+/**
+ * @typedef ae_memory_allocator_align_realloc_fn
+ * @brief Тип функции для изменения размера выровненного блока памяти.
+ * @details Функция должна сохранить первые `min(old_size, new_size)` байт блока.
+ *
+ * @param context Пользовательский контекст аллокатора.
+ * @param ptr Указатель на выровненный блок памяти.
+ * @param old_size Текущий размер блока в байтах.
+ * @param new_size Новый размер блока в байтах (не равен 0).
+ * @param alignment Размер выравнивания в байтах, с которым был выделен блок.
+ * @return Указатель на выровненный блок нового размера или NULL в случае ошибки;
+ *         при ошибке исходный блок должен остаться действительным.
+ */
+typedef void *(ae_memory_allocator_align_realloc_fn)(void      *context,
+                                                     void      *ptr,
+                                                     ae_usize_t old_size,
+                                                     ae_usize_t new_size,
+                                                     ae_usize_t alignment);
+
+#endif // AE_MEMORY_ALLOCATOR_ALIGN_REALLOC_FN_H
@@ -20,12 +20,14 @@
  * @brief Тип функции для выделения памяти.
  * @details Эта функция используется для выделения памяти заданного размера.
  *
+ * @param context Пользовательский контекст аллокатора (поле `context` структуры
+ *                `ae_memory_allocator_t`), например указатель на пул или арену.
  * @param size_of_bytes Размер памяти в байтах, который необходимо выделить.
  * @return Указатель на выделенную память или NULL в случае ошибки.
  *
  * @note Функция должна обрабатывать случай,
  *       когда запрашиваемый размер равен 0.
  */
-typedef void *(ae_memory_allocator_alloc_fn)(ae_usize_t size_of_bytes);
+typedef void *(ae_memory_allocator_alloc_fn)(void *context, ae_usize_t size_of_bytes);
 
 #endif // AE_MEMORY_ALLOCATOR_ALLOC_FN_H
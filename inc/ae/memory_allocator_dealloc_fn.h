@@ -22,11 +22,13 @@
  * @brief Тип функции для освобождения памяти.
  * @details Эта функция используется для освобождения ранее выделенной памяти.
  *
+ * @param context Пользовательский контекст аллокатора (поле `context` структуры
+ *                `ae_memory_allocator_t`).
  * @param ptr Указатель на память, которую необходимо освободить.
  * @note Функция не должна вызывать освобождение памяти для указателя,
  *       который уже был освобожден, и должна обрабатывать случай,
  *       когда указатель равен NULL.
  */
-typedef void(ae_memory_allocator_dealloc_fn)(void *ptr);
+typedef void(ae_memory_allocator_dealloc_fn)(void *context, void *ptr);
 
 #endif // AE_MEMORY_ALLOCATOR_DEALLOC_FN_H
@@ -0,0 +1,36 @@
+/**
+ * @file memory_allocator_expand_fn.h
+ * @brief Заголовочный файл для определения типа функции изменения размера блока на месте.
+ *
+ * Этот файл содержит определение типа необязательной функции аллокатора,
+ * которая пытается изменить размер ранее выделенного блока, не перемещая его.
+ * Например, арена может продлить последний выделенный блок, а пул - вернуть
+ * блок того же класса размера.
+ *
+ * @note В отличие от `ae_memory_allocator_realloc_fn`, функция не выделяет
+ *       новый блок: при неудаче размер изменяется другими способами.
+ */
+
+#ifndef AE_MEMORY_ALLOCATOR_EXPAND_FN_H
+#define AE_MEMORY_ALLOCATOR_EXPAND_FN_H
+
+#include "size.h"
+#include "bool.h"
+
+/**
+ * @typedef ae_memory_allocator_expand_fn
+ * @brief Тип функции для изменения размера блока памяти без его перемещения.
+ *
+ * @param context Пользовательский контекст аллокатора.
+ * @param ptr Указатель на блок памяти, выделенный функцией выделения того же аллокатора.
+ * @param old_size Текущий размер блока в байтах.
+ * @param new_size Новый размер блока в байтах (не равен 0).
+ * @return true, если размер блока изменен на месте, или false,
+ *         если это невозможно (блок при этом не изменяется).
+ */
+typedef bool(ae_memory_allocator_expand_fn)(void      *context,
+                                            void      *ptr,
+                                            ae_usize_t old_size,
+                                            ae_usize_t new_size);
+
+#endif // AE_MEMORY_ALLOCATOR_EXPAND_FN_H
@@ -24,15 +24,32 @@
  *
  * @param alloc_fn Указатель на функцию выделения памяти.
  * @param free_fn Указатель на функцию освобождения памяти.
+ * @param ... Остальные поля в порядке их объявления в `ae_memory_allocator_t`:
+ *            `context`, `realloc_fn`, `expand_fn`, `align_alloc_fn`,
+ *            `align_dealloc_fn`, `align_realloc_fn`, `sized_dealloc_fn`.
+ *            Все поля указываются явно; для неиспользуемых передается `nullptr`.
  *
  * @return Инициализированная структура аллокатора памяти.
  *
- * @note Убедитесь, что указанные функции выделения и освобождения памяти
- *       корректно реализованы и совместимы с используемым аллокатором.
+ * @note Функции должны иметь сигнатуры `ae_memory_allocator_alloc_fn`
+ *       и `ae_memory_allocator_dealloc_fn` (с первым аргументом `context`),
+ *       поэтому стандартные `malloc` и `free` напрямую не подходят.
+ *
+ * Пример использования:
+ * @code{.c}
+ * ae_memory_allocator_t pool = ae_memory_allocator_initializer(pool_alloc,
+ *                                                              pool_free,
+ *                                                              &state,
+ *                                                              nullptr,
+ *                                                              nullptr,
+ *                                                              nullptr,
+ *                                                              nullptr,
+ *                                                              nullptr,
+ *                                                              nullptr);
+ * @endcode
  */
-#define ae_memory_allocator_initializer(alloc_fn, free_fn)                                         \
-    ae_initializer((ae_memory_allocator_alloc_fn *)alloc_fn,                                       \
-                   (ae_memory_allocator_dealloc_fn *)free_fn)
+#define ae_memory_allocator_initializer(alloc_fn, free_fn, ...)                                    \
+    ae_initializer(alloc_fn, free_fn, __VA_ARGS__)
 
 /**
  * @def ae_memory_allocator_empty_initializer
@@ -46,6 +63,15 @@
  * @note Этот аллокатор не может быть использован для выделения памяти,
  *       поскольку функции выделения и освобождения памяти не определены.
  */
-#define ae_memory_allocator_empty_initializer() ae_memory_allocator_initializer(nullptr, nullptr)
+#define ae_memory_allocator_empty_initializer()                                                    \
+    ae_memory_allocator_initializer(nullptr,                                                       \
+                                    nullptr,                                                       \
+                                    nullptr,                                                       \
+                                    nullptr,                                                       \
+                                    nullptr,                                                       \
+                                    nullptr,                                                       \
+                                    nullptr,                                                       \
+                                    nullptr,                                                       \
+                                    nullptr)
 
 #endif // AE_MEMORY_ALLOCATOR_INITIALIZER_H
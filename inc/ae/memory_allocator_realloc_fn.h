@@ -0,0 +1,35 @@
+/**
+ * @file memory_allocator_realloc_fn.h
+ * @brief Заголовочный файл для определения типа функции изменения размера памяти.
+ *
+ * Этот файл содержит определение типа необязательной функции аллокатора,
+ * которая изменяет размер ранее выделенного блока собственными средствами
+ * (например, через `realloc`), без обязательного копирования данных.
+ *
+ * @note Если функция не задана, размер блока изменяется
+ *       выделением нового блока, копированием и освобождением старого.
+ */
+
+#ifndef AE_MEMORY_ALLOCATOR_REALLOC_FN_H
+#define AE_MEMORY_ALLOCATOR_REALLOC_FN_H
+
+#include "size.h"
+
+/**
+ * @typedef ae_memory_allocator_realloc_fn
+ * @brief Тип функции для изменения размера блока памяти.
+ * @details Функция должна сохранить первые `min(old_size, new_size)` байт блока.
+ *
+ * @param context Пользовательский контекст аллокатора.
+ * @param ptr Указатель на блок памяти, выделенный функцией выделения того же аллокатора.
+ * @param old_size Текущий размер блока в байтах.
+ * @param new_size Новый размер блока в байтах (не равен 0).
+ * @return Указатель на блок нового размера или NULL в случае ошибки;
+ *         при ошибке исходный блок должен остаться действительным.
+ */
+typedef void *(ae_memory_allocator_realloc_fn)(void      *context,
+                                               void      *ptr,
+                                               ae_usize_t old_size,
+                                               ae_usize_t new_size);
+
+#endif // AE_MEMORY_ALLOCATOR_REALLOC_FN_H
@@ -0,0 +1,25 @@
+/**
+ * @file memory_allocator_sized_dealloc_fn.h
+ * @brief Заголовочный файл для определения типа функции освобождения памяти с размером.
+ *
+ * Этот файл содержит определение типа необязательной функции аллокатора,
+ * которая освобождает блок, получая его размер. Размер позволяет пулам
+ * и аллокаторам с классами размеров не хранить заголовок в каждом блоке.
+ */
+
+#ifndef AE_MEMORY_ALLOCATOR_SIZED_DEALLOC_FN_H
+#define AE_MEMORY_ALLOCATOR_SIZED_DEALLOC_FN_H
+
+#include "size.h"
+
+/**
+ * @typedef ae_memory_allocator_sized_dealloc_fn
+ * @brief Тип функции для освобождения памяти известного размера.
+ *
+ * @param context Пользовательский контекст аллокатора.
+ * @param ptr Указатель на память, которую необходимо освободить.
+ * @param size Размер блока в байтах, с которым он был выделен.
+ */
+typedef void(ae_memory_allocator_sized_dealloc_fn)(void *context, void *ptr, ae_usize_t size);
+
+#endif // AE_MEMORY_ALLOCATOR_SIZED_DEALLOC_FN_H
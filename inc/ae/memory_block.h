@@ -512,6 +512,47 @@ AE_ATTRIBUTE(SYMBOL)
 ae_memory_block_t
 ae_memory_block_slice(void *self, ae_usize_t index, ae_usize_t length);
 
+/**
+ * @brief Проверяет, что все байты блока памяти равны нулю.
+ *
+ * @param self Указатель на блок памяти.
+ *
+ * @return `true`, если блок пуст или состоит только из нулевых байт;
+ *         `false` в противном случае.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если указатель на `self` равен `nullptr`.
+ * @throw AE_RUNTIME_ERROR_INVALID_MEMORY_BLOCK
+ *        Если блок памяти недействителен.
+ *
+ * @see ae_memory_block_find_nonzero
+ */
+AE_ATTRIBUTE(SYMBOL)
+bool
+ae_memory_block_is_zero(const void *self);
+
+/**
+ * @brief Ищет первый элемент блока памяти, содержащий ненулевой байт.
+ *
+ * Поиск выполняется побайтно функцией `ae_memory_raw_find_nonzero`,
+ * после чего найденный адрес округляется вниз до начала элемента.
+ *
+ * @param self Указатель на блок памяти.
+ *
+ * @return Указатель на начало первого ненулевого элемента или `nullptr`,
+ *         если все элементы блока равны нулю.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если указатель на `self` равен `nullptr`.
+ * @throw AE_RUNTIME_ERROR_INVALID_MEMORY_BLOCK
+ *        Если блок памяти недействителен.
+ *
+ * @see ae_memory_raw_find_nonzero
+ */
+AE_ATTRIBUTE(SYMBOL)
+void *
+ae_memory_block_find_nonzero(const void *self);
+
 AE_COMPILER(EXTERN_C_END)
 
 #endif // AE_MEMORY_BLOCK_H
@@ -0,0 +1,314 @@
+/**
+ * @file memory_hash.h
+ * @brief Контрольные суммы и некриптографические хеши блоков памяти.
+ *
+ * Данный файл содержит функции для вычисления отпечатков блоков памяти,
+ * которые используются для поиска дубликатов и проверки целостности данных:
+ * - CRC32C (полином Кастаньоли `0x1EDC6F41`), совместимый с iSCSI, ext4 и SSE4.2.
+ *   На процессорах с SSE4.2 используется инструкция `crc32`, иначе - табличный
+ *   алгоритм, обрабатывающий по 8 байт за шаг (slicing-by-8).
+ * - XXH64 - 64-битный хеш, совместимый с эталонной реализацией xxHash.
+ *   Четыре независимые линии накопления обрабатывают по 32 байта за шаг.
+ *
+ * Функции принимают указатели на начало и конец блока, как и функции `ae_memory_raw_*`.
+ * Для каждого алгоритма есть потоковый интерфейс (`*_init`, `*_update`, `*_final`),
+ * результат которого совпадает с однократным вычислением по всему блоку
+ * независимо от того, как данные разбиты на части.
+ *
+ * Функции `*_copy` и `*_copy_update` копируют данные так же, как `ae_memory_raw_copy`,
+ * и одновременно вычисляют отпечаток копируемых байт, поэтому каждый байт
+ * источника читается из памяти один раз.
+ *
+ * @see ae_memory_hash_crc32c
+ * @see ae_memory_hash_xxh64
+ * @see ae_memory_hash_crc32c_copy
+ * @see ae_memory_hash_xxh64_copy
+ * @see ae_memory_hash_dispatch
+ * @see ae_memory_range_crc32c
+ * @see ae_memory_range_xxh64
+ */
+
+#ifndef AE_MEMORY_HASH_H
+#define AE_MEMORY_HASH_H
+
+#include "attribute.h"
+#include "numeric_fixed_types.h"
+#include "size.h"
+
+/**
+ * @brief Состояние потокового вычисления CRC32C.
+ */
+typedef struct ae_memory_hash_crc32c
+{
+    /**
+     * @brief Текущее значение регистра CRC (до финальной инверсии).
+     */
+    ae_u32_t crc;
+} ae_memory_hash_crc32c_t;
+
+/**
+ * @brief Состояние потокового вычисления XXH64.
+ */
+typedef struct ae_memory_hash_xxh64
+{
+    /**
+     * @brief Четыре линии накопления.
+     */
+    ae_u64_t acc[4];
+
+    /**
+     * @brief Начальное значение хеша.
+     */
+    ae_u64_t seed;
+
+    /**
+     * @brief Общее количество обработанных байт.
+     */
+    ae_u64_t total_size;
+
+    /**
+     * @brief Байты, которые еще не составили полный блок из 32 байт.
+     */
+    ae_u8_t buffer[32];
+
+    /**
+     * @brief Количество байт в @c buffer.
+     */
+    ae_usize_t buffer_size;
+} ae_memory_hash_xxh64_t;
+
+AE_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Выбирает варианты ядер функций модуля.
+ *
+ * Аналогична `ae_memory_raw_dispatch`: при загрузке библиотеки вызывается
+ * автоматически со значением `AE_CPU_FEATURE_ALL`, а повторный вызов позволяет
+ * ограничить набор инструкций (например, для проверки табличного алгоритма).
+ *
+ * @param features Битовая маска значений `ae_cpu_feature_t`.
+ *
+ * @note Функция не является потокобезопасной и должна вызываться
+ *       до использования функций модуля из других потоков.
+ */
+AE_ATTRIBUTE(SYMBOL)
+void
+ae_memory_hash_dispatch(ae_u32_t features);
+
+/**
+ * @brief Вычисляет CRC32C блока памяти.
+ *
+ * @param begin Указатель на начало блока.
+ * @param end Указатель на конец блока.
+ *
+ * @return Значение CRC32C (для пустого блока - 0).
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c begin является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+ae_u32_t
+ae_memory_hash_crc32c(const void *begin, const void *end);
+
+/**
+ * @brief Инициализирует состояние потокового вычисления CRC32C.
+ *
+ * @param self Указатель на состояние.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c self является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+void
+ae_memory_hash_crc32c_init(ae_memory_hash_crc32c_t *self);
+
+/**
+ * @brief Добавляет блок памяти к потоковому вычислению CRC32C.
+ *
+ * @param self Указатель на состояние.
+ * @param begin Указатель на начало блока.
+ * @param end Указатель на конец блока.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c self или @c begin является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+void
+ae_memory_hash_crc32c_update(ae_memory_hash_crc32c_t *self, const void *begin, const void *end);
+
+/**
+ * @brief Возвращает CRC32C всех добавленных данных.
+ *
+ * Состояние не изменяется, поэтому к нему можно добавлять данные и дальше.
+ *
+ * @param self Указатель на состояние.
+ *
+ * @return Значение CRC32C.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c self является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+ae_u32_t
+ae_memory_hash_crc32c_final(const ae_memory_hash_crc32c_t *self);
+
+/**
+ * @brief Копирует данные и вычисляет CRC32C скопированных байт за один проход.
+ *
+ * Копируется столько байт, сколько помещается в меньший из буферов.
+ * Как и в `ae_memory_raw_copy`, данные копируются от начала к концу,
+ * поэтому целевой буфер не должен перекрываться с источником,
+ * если начинается после него.
+ *
+ * @param dst Указатель на целевой буфер.
+ * @param dst_end Указатель на конец целевого буфера.
+ * @param src Указатель на исходный буфер.
+ * @param src_end Указатель на конец исходного буфера.
+ *
+ * @return Значение CRC32C скопированных байт.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c dst или @c src является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+ae_u32_t
+ae_memory_hash_crc32c_copy(void *dst, const void *dst_end, const void *src, const void *src_end);
+
+/**
+ * @brief Копирует данные и добавляет их к потоковому вычислению CRC32C.
+ *
+ * Позволяет копировать большой блок частями: результат `ae_memory_hash_crc32c_final`
+ * совпадает с результатом `ae_memory_hash_crc32c` по всем скопированным данным.
+ *
+ * @param self Указатель на состояние.
+ * @param dst Указатель на целевой буфер.
+ * @param dst_end Указатель на конец целевого буфера.
+ * @param src Указатель на исходный буфер.
+ * @param src_end Указатель на конец исходного буфера.
+ *
+ * @return Указатель на конец скопированных данных в целевом буфере.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c self, @c dst или @c src является NULL.
+ *
+ * @see ae_memory_hash_crc32c_copy
+ */
+AE_ATTRIBUTE(SYMBOL)
+void *
+ae_memory_hash_crc32c_copy_update(ae_memory_hash_crc32c_t *self,
+                                  void                    *dst,
+                                  const void              *dst_end,
+                                  const void              *src,
+                                  const void              *src_end);
+
+/**
+ * @brief Вычисляет хеш XXH64 блока памяти.
+ *
+ * @param begin Указатель на начало блока.
+ * @param end Указатель на конец блока.
+ * @param seed Начальное значение хеша.
+ *
+ * @return Значение XXH64.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c begin является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+ae_u64_t
+ae_memory_hash_xxh64(const void *begin, const void *end, ae_u64_t seed);
+
+/**
+ * @brief Инициализирует состояние потокового вычисления XXH64.
+ *
+ * @param self Указатель на состояние.
+ * @param seed Начальное значение хеша.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c self является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+void
+ae_memory_hash_xxh64_init(ae_memory_hash_xxh64_t *self, ae_u64_t seed);
+
+/**
+ * @brief Добавляет блок памяти к потоковому вычислению XXH64.
+ *
+ * @param self Указатель на состояние.
+ * @param begin Указатель на начало блока.
+ * @param end Указатель на конец блока.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c self или @c begin является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+void
+ae_memory_hash_xxh64_update(ae_memory_hash_xxh64_t *self, const void *begin, const void *end);
+
+/**
+ * @brief Возвращает хеш XXH64 всех добавленных данных.
+ *
+ * Состояние не изменяется, поэтому к нему можно добавлять данные и дальше.
+ *
+ * @param self Указатель на состояние.
+ *
+ * @return Значение XXH64.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c self является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+ae_u64_t
+ae_memory_hash_xxh64_final(const ae_memory_hash_xxh64_t *self);
+
+/**
+ * @brief Копирует данные и вычисляет хеш XXH64 скопированных байт за один проход.
+ *
+ * Ограничения на размер и перекрытие буферов такие же,
+ * как у `ae_memory_hash_crc32c_copy`.
+ *
+ * @param dst Указатель на целевой буфер.
+ * @param dst_end Указатель на конец целевого буфера.
+ * @param src Указатель на исходный буфер.
+ * @param src_end Указатель на конец исходного буфера.
+ * @param seed Начальное значение хеша.
+ *
+ * @return Значение XXH64 скопированных байт.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c dst или @c src является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+ae_u64_t
+ae_memory_hash_xxh64_copy(void       *dst,
+                          const void *dst_end,
+                          const void *src,
+                          const void *src_end,
+                          ae_u64_t    seed);
+
+/**
+ * @brief Копирует данные и добавляет их к потоковому вычислению XXH64.
+ *
+ * @param self Указатель на состояние.
+ * @param dst Указатель на целевой буфер.
+ * @param dst_end Указатель на конец целевого буфера.
+ * @param src Указатель на исходный буфер.
+ * @param src_end Указатель на конец исходного буфера.
+ *
+ * @return Указатель на конец скопированных данных в целевом буфере.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c self, @c dst или @c src является NULL.
+ *
+ * @see ae_memory_hash_xxh64_copy
+ */
+AE_ATTRIBUTE(SYMBOL)
+void *
+ae_memory_hash_xxh64_copy_update(ae_memory_hash_xxh64_t *self,
+                                 void                   *dst,
+                                 const void             *dst_end,
+                                 const void             *src,
+                                 const void             *src_end);
+
+AE_COMPILER(EXTERN_C_END)
+
+#endif // AE_MEMORY_HASH_H
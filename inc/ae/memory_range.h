@@ -20,6 +20,7 @@
 #include "bool.h"
 #include "offset.h"
 #include "ptrdiff.h"
+#include "numeric_fixed_types.h"
 #include "attribute.h"
 #include "memory_range_fields.h"
 
@@ -176,6 +177,7 @@ ae_memory_range_diff(const void *self);
  *
  * Эта функция определяет размер диапазона памяти,
  * используя разницу между конечным и начальным адресами.
+ * Для пустого диапазона (`ae_memory_range_empty_initializer`) возвращается 0.
  * Если диапазон памяти недопустим, функция вызывает ошибку времени выполнения.
  *
  * @param self Указатель на структуру ae_memory_range_t,
@@ -746,6 +748,87 @@ AE_ATTRIBUTE(SYMBOL)
 bool
 ae_memory_range_is_equal(const void *self, const void *other);
 
+/**
+ * @brief Вычисляет CRC32C содержимого диапазона памяти.
+ *
+ * Функция применима и к `ae_memory_block_t`, так как блок начинается
+ * с полей диапазона памяти.
+ *
+ * @param self Указатель на структуру ae_memory_range_t,
+ *             представляющую диапазон памяти.
+ * @return Значение CRC32C (для пустого диапазона - 0).
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если указатель на `self` равен `nullptr`.
+ * @throw AE_RUNTIME_ERROR_INVALID_MEMORY_RANGE
+ *        Если диапазон памяти недопустим.
+ *
+ * @see ae_memory_hash_crc32c
+ */
+AE_ATTRIBUTE(SYMBOL)
+ae_u32_t
+ae_memory_range_crc32c(const void *self);
+
+/**
+ * @brief Вычисляет хеш XXH64 содержимого диапазона памяти.
+ *
+ * Функция применима и к `ae_memory_block_t`, так как блок начинается
+ * с полей диапазона памяти.
+ *
+ * @param self Указатель на структуру ae_memory_range_t,
+ *             представляющую диапазон памяти.
+ * @param seed Начальное значение хеша.
+ * @return Значение XXH64.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если указатель на `self` равен `nullptr`.
+ * @throw AE_RUNTIME_ERROR_INVALID_MEMORY_RANGE
+ *        Если диапазон памяти недопустим.
+ *
+ * @see ae_memory_hash_xxh64
+ */
+AE_ATTRIBUTE(SYMBOL)
+ae_u64_t
+ae_memory_range_xxh64(const void *self, ae_u64_t seed);
+
+/**
+ * @brief Проверяет, что все байты диапазона памяти равны нулю.
+ *
+ * @param self Указатель на структуру ae_memory_range_t,
+ *             представляющую диапазон памяти.
+ * @return `true`, если диапазон пуст или состоит только из нулевых байт;
+ *         `false` в противном случае.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если указатель на `self` равен `nullptr`.
+ * @throw AE_RUNTIME_ERROR_INVALID_MEMORY_RANGE
+ *        Если диапазон памяти недопустим.
+ *
+ * @see ae_memory_raw_is_zero
+ */
+AE_ATTRIBUTE(SYMBOL)
+bool
+ae_memory_range_is_zero(const void *self);
+
+/**
+ * @brief Ищет первый ненулевой байт в диапазоне памяти.
+ *
+ * @param self Указатель на структуру ae_memory_range_t,
+ *             представляющую диапазон памяти.
+ * @return Указатель на первый ненулевой байт или `nullptr`,
+ *         если все байты диапазона равны нулю.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если указатель на `self` равен `nullptr`.
+ * @throw AE_RUNTIME_ERROR_INVALID_MEMORY_RANGE
+ *        Если диапазон памяти недопустим.
+ *
+ * @see ae_memory_raw_find_nonzero
+ */
+AE_ATTRIBUTE(SYMBOL)
+void *
+ae_memory_range_find_nonzero(const void *self);
+
 AE_COMPILER(EXTERN_C_END)
 
 #endif // AE_MEMORY_RANGE_H
@@ -5,8 +5,10 @@
  * Данный файл содержит объявления функций для копирования,
  * перемещения, сравнения и заполнения блоков памяти.
  *
- * Функции используют оптимизации с помощью SIMD-инструкций (AVX и SSE),
- * если они доступны, для повышения производительности операций.
+ * Функции используют оптимизации с помощью SIMD-инструкций (SSE2, AVX, AVX2 и AVX-512).
+ * Варианты ядер собираются для нескольких наборов инструкций, а при загрузке
+ * библиотеки выбирается наилучший вариант, поддерживаемый текущим процессором
+ * (см. `ae_memory_raw_dispatch`). Выбор можно ограничить во время выполнения.
  *
  * Основные функции включают:
  * - Копирование данных из одного буфера в другой.
@@ -14,6 +16,8 @@
  * - Сравнение двух блоков памяти.
  * - Поиск одного блока памяти внутри другого.
  * - Заполнение области памяти заданным значением.
+ * - Параллельное копирование, заполнение и сравнение очень больших блоков
+ *   потоками внутреннего пула (см. `ae_worker_pool_run`).
  *
  * Каждая функция имеет механизмы обработки ошибок
  * и может выбрасывать исключения в случае передачи нулевых указателей.
@@ -21,9 +25,16 @@
  * @see ae_memory_raw_copy
  * @see ae_memory_raw_move
  * @see ae_memory_raw_compare
+ * @see ae_memory_raw_order
+ * @see ae_memory_raw_equal_constant_time
  * @see ae_memory_raw_find
+ * @see ae_memory_raw_find_byte
+ * @see ae_memory_raw_find_class
+ * @see ae_memory_searcher_t
  * @see ae_memory_raw_set
  * @see ae_memory_raw_set_value
+ * @see ae_memory_raw_dispatch
+ * @see ae_memory_raw_copy_parallel
  */
 
 #ifndef AE_MEMORY_RAW_H
@@ -32,15 +43,84 @@
 #include "attribute.h"
 #include "size.h"
 #include "char.h"
+#include "numeric_fixed_types.h"
+#include "byte_class.h"
+
+/**
+ * @def AE_MEMORY_RAW_PARALLEL_CHUNKS_PER_THREAD
+ * @brief Количество частей, на которое параллельные функции делят блок
+ *        в расчете на одного участника пула рабочих потоков.
+ *
+ * Несколько частей на поток выравнивают нагрузку, если потоки
+ * получают разную долю пропускной способности памяти.
+ */
+#define AE_MEMORY_RAW_PARALLEL_CHUNKS_PER_THREAD 4
 
 AE_COMPILER(EXTERN_C_BEGIN)
 
+/**
+ * @brief Выбирает варианты SIMD-ядер функций модуля.
+ *
+ * Функция выбирает для каждой операции наилучший собранный вариант ядра,
+ * который использует только возможности из маски @c features,
+ * поддерживаемые текущим процессором. При загрузке библиотеки функция
+ * вызывается автоматически со значением `AE_CPU_FEATURE_ALL`.
+ *
+ * Повторный вызов позволяет ограничить набор инструкций
+ * (например, `AE_CPU_FEATURE_SSE2` для отключения AVX),
+ * что полезно для тестирования и сравнения производительности вариантов.
+ *
+ * @param features Битовая маска значений `ae_cpu_feature_t`.
+ *
+ * @note Функция не является потокобезопасной и должна вызываться
+ *       до использования функций модуля из других потоков.
+ */
+AE_ATTRIBUTE(SYMBOL)
+void
+ae_memory_raw_dispatch(ae_u32_t features);
+
+/**
+ * @brief Устанавливает порог невременной записи.
+ *
+ * Копирование, перемещение и заполнение областей размером от @c size байт
+ * выполняются невременными инструкциями записи в обход кэша,
+ * а исходные данные копирования заранее запрашиваются предвыборкой
+ * (см. `AE_MEMORY_RAW_PREFETCH_DISTANCE`).
+ *
+ * По умолчанию порог равен размеру кэша последнего уровня
+ * (см. `ae_cpu_feature_cache_size`), а если его не удалось определить -
+ * значению `AE_MEMORY_RAW_NON_TEMPORAL_THRESHOLD`.
+ *
+ * @param size Порог в байтах; значение 0 восстанавливает порог по умолчанию.
+ *
+ * @note Функция не является потокобезопасной и должна вызываться
+ *       до использования функций модуля из других потоков.
+ */
+AE_ATTRIBUTE(SYMBOL)
+void
+ae_memory_raw_set_non_temporal_threshold(ae_usize_t size);
+
+/**
+ * @brief Возвращает текущий порог невременной записи в байтах.
+ *
+ * @see ae_memory_raw_set_non_temporal_threshold
+ */
+AE_ATTRIBUTE(SYMBOL)
+ae_usize_t
+ae_memory_raw_get_non_temporal_threshold();
+
 /**
  * @brief Копирует данные из одного буфера в другой.
  *
  * Функция копирует данные из исходного буфера в целевой буфер от начала до конца.
  * Для ускорения копирования используются оптимизации с использованием инструкций AVX и SSE,
- * если они доступны. Для оставшихся данных выполняется побайтовое копирование.
+ * если они доступны. Остаток копируется последним векторным блоком, перекрывающим уже
+ * скопированные данные; блоки до 32 байт копируются парой перекрывающихся фрагментов
+ * от начала и от конца, а в ядре AVX-512 блоки до 64 байт - одной маскированной парой
+ * чтения и записи. Побайтовое копирование не используется.
+ *
+ * Блоки от порога невременной записи (см. `ae_memory_raw_set_non_temporal_threshold`)
+ * копируются с предвыборкой источника и невременной записью в обход кэша.
  *
  * @param dst Указатель на целевой буфер.
  * @param dst_end Указатель на конец целевого буфера.
@@ -61,8 +141,11 @@ ae_memory_raw_copy(void *dst, const void *dst_end, const void *src, const void *
  *
  * Функция копирует данные из исходного буфера в целевой буфер, начиная с конца и двигаясь к началу.
  * Она использует оптимизации для обработки данных с помощью инструкций AVX и SSE,
- * если они доступны, и копирует оставшиеся байты по одному,
- * если данные не соответствуют размеру для SIMD-инструкций.
+ * если они доступны. Остаток у начала буфера копируется первым векторным блоком,
+ * перекрывающим уже скопированные данные, как в `ae_memory_raw_copy`.
+ *
+ * Блоки от порога невременной записи (см. `ae_memory_raw_set_non_temporal_threshold`)
+ * копируются с предвыборкой источника и невременной записью в обход кэша.
  *
  * @param dst Указатель на целевой буфер.
  * @param dst_end Указатель на начало целевого буфера (аналогично указателю на конец).
@@ -86,6 +169,8 @@ ae_memory_raw_copy_from_end(const void *dst, void *dst_end, const void *src, con
  * данные копируются в обратном порядке, чтобы избежать потери информации.
  * В противном случае данные копируются в прямом порядке.
  *
+ * Как и при копировании, блоки от порога невременной записи записываются в обход кэша.
+ *
  * @param dst Указатель на целевую область памяти, куда будут скопированы данные.
  * @param dst_end Указатель на конец целевой области памяти.
  * @param src Указатель на исходную область памяти, откуда будут скопированы данные.
@@ -153,12 +238,99 @@ ae_memory_raw_compare_from_end(const void *lhs,
                                const void *rhs,
                                const void *rhs_end);
 
+/**
+ * @brief Сравнивает два блока памяти без учета регистра латинских букв ASCII.
+ *
+ * Работает как `ae_memory_raw_compare`, но заглавные и строчные латинские буквы
+ * считаются равными. Векторные ядра приводят буквы обоих блоков к нижнему регистру
+ * в регистрах и ищут первое различие целыми блоками, не сворачивая байты по одному.
+ * Байты вне диапазона ASCII сравниваются как есть.
+ *
+ * @param lhs Указатель на начало первого блока памяти.
+ * @param lhs_end Указатель на конец первого блока памяти.
+ * @param rhs Указатель на начало второго блока памяти.
+ * @param rhs_end Указатель на конец второго блока памяти.
+ *
+ * @return Указатель на первое различие между блоками памяти или nullptr,
+ *         если блоки равны без учета регистра.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c lhs или @c rhs является NULL.
+ *
+ * @see ae_memory_raw_compare
+ */
+AE_ATTRIBUTE(SYMBOL)
+const void *
+ae_memory_raw_compare_icase(const void *lhs,
+                            const void *lhs_end,
+                            const void *rhs,
+                            const void *rhs_end);
+
+/**
+ * @brief Определяет лексикографический порядок двух блоков памяти.
+ *
+ * Первое различие ищется тем же SIMD-ядром, что и в `ae_memory_raw_compare`,
+ * а байты сравниваются как беззнаковые значения (как в `memcmp`).
+ * Если меньший блок совпадает с началом большего, меньшим считается более короткий блок.
+ *
+ * @param lhs Указатель на начало первого блока памяти.
+ * @param lhs_end Указатель на конец первого блока памяти.
+ * @param rhs Указатель на начало второго блока памяти.
+ * @param rhs_end Указатель на конец второго блока памяти.
+ *
+ * @return Отрицательное значение, если первый блок меньше второго,
+ *         0, если блоки равны, и положительное значение, если первый блок больше.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c lhs или @c rhs является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+ae_sint_t
+ae_memory_raw_order(const void *lhs, const void *lhs_end, const void *rhs, const void *rhs_end);
+
+/**
+ * @brief Проверяет равенство двух блоков памяти за время, не зависящее от их содержимого.
+ *
+ * В отличие от `ae_memory_raw_compare`, функция не завершается на первом различии:
+ * разности всех байт накапливаются побитовым ИЛИ (в SIMD-регистрах, если это возможно),
+ * поэтому время проверки зависит только от размера блоков. Функция предназначена
+ * для сравнения секретных данных (кодов аутентификации сообщений, токенов),
+ * при котором время сравнения не должно раскрывать позицию различия.
+ *
+ * @param lhs Указатель на начало первого блока памяти.
+ * @param lhs_end Указатель на конец первого блока памяти.
+ * @param rhs Указатель на начало второго блока памяти.
+ * @param rhs_end Указатель на конец второго блока памяти.
+ *
+ * @return `true`, если блоки имеют одинаковый размер и содержимое, иначе `false`.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c lhs или @c rhs является NULL.
+ *
+ * @note Размеры блоков не считаются секретными: при разных размерах
+ *       функция сразу возвращает `false`.
+ */
+AE_ATTRIBUTE(SYMBOL)
+bool
+ae_memory_raw_equal_constant_time(const void *lhs,
+                                  const void *lhs_end,
+                                  const void *rhs,
+                                  const void *rhs_end);
+
 /**
  * @brief Ищет блок памяти в другом блоке памяти.
  *
  * - Если блок `rhs` найден в блоке `lhs`,
  *   функция возвращает указатель на первое вхождение.
  * - Если блок не найден, возвращается nullptr.
+ * - Если блок `rhs` пуст, возвращается `lhs` (при непустом блоке `lhs`).
+ *
+ * Вхождением считается только полное совпадение блока `rhs`.
+ * Блоки длиной до `AE_MEMORY_SEARCHER_SHORT_NEEDLE_SIZE` байт ищутся
+ * SIMD-фильтрацией по первому и последнему байту, более длинные -
+ * алгоритмом Two-Way (см. `ae_memory_searcher_t`). Для многократного
+ * поиска одного и того же длинного блока выгоднее использовать
+ * `ae_memory_searcher_t` напрямую.
  *
  * @param lhs Указатель на начало первого блока памяти, в котором будет производиться поиск.
  * @param lhs_end Указатель на конец первого блока памяти.
@@ -179,8 +351,11 @@ ae_memory_raw_find(const void *lhs, const void *lhs_end, const void *rhs, const
  * @brief Ищет блок памяти в другом блоке памяти, начиная с конца.
  *
  * - Если блок `rhs` найден в блоке `lhs`,
- *   функция возвращает указатель на первое вхождение.
+ *   функция возвращает указатель на начало последнего вхождения.
  * - Если блок не найден, возвращается nullptr.
+ * - Если блок `rhs` пуст, возвращается `lhs_end` (при непустом блоке `lhs`).
+ *
+ * Стратегия поиска совпадает с `ae_memory_raw_find`.
  *
  * @param lhs Указатель на начало первого блока памяти, в котором будет производиться поиск.
  * @param lhs_end Указатель на конец первого блока памяти.
@@ -200,12 +375,380 @@ ae_memory_raw_find_from_end(const void *lhs,
                             const void *rhs,
                             const void *rhs_end);
 
+/**
+ * @brief Ищет первое вхождение байта в блоке памяти.
+ *
+ * Функция сравнивает сразу 16, 32 или 64 байта (SSE2, AVX2 или AVX-512)
+ * и читает основную часть блока выровненными фрагментами.
+ * Чтение не выходит за пределы диапазона `[begin, end)`.
+ *
+ * @param begin Указатель на начало блока памяти.
+ * @param end Указатель на конец блока памяти.
+ * @param value Искомый байт.
+ *
+ * @return Указатель на первое вхождение байта или nullptr, если байт не найден.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c begin является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+const void *
+ae_memory_raw_find_byte(const void *begin, const void *end, ae_u8_t value);
+
+/**
+ * @brief Ищет последнее вхождение байта в блоке памяти.
+ *
+ * @param begin Указатель на начало блока памяти.
+ * @param end Указатель на конец блока памяти.
+ * @param value Искомый байт.
+ *
+ * @return Указатель на последнее вхождение байта или nullptr, если байт не найден.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c begin является NULL.
+ *
+ * @see ae_memory_raw_find_byte
+ */
+AE_ATTRIBUTE(SYMBOL)
+const void *
+ae_memory_raw_find_byte_from_end(const void *begin, const void *end, ae_u8_t value);
+
+/**
+ * @brief Ищет первый байт, равный одному из двух значений.
+ *
+ * Функция аналогична `ae_memory_raw_find_byte`, но сравнивает каждый блок
+ * сразу с двумя значениями, поэтому блок памяти просматривается один раз.
+ *
+ * @param begin Указатель на начало блока памяти.
+ * @param end Указатель на конец блока памяти.
+ * @param first Первое искомое значение.
+ * @param second Второе искомое значение.
+ *
+ * @return Указатель на первый найденный байт или nullptr, если байт не найден.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c begin является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+const void *
+ae_memory_raw_find_byte2(const void *begin, const void *end, ae_u8_t first, ae_u8_t second);
+
+/**
+ * @brief Ищет первый байт, равный одному из трех значений.
+ *
+ * @param begin Указатель на начало блока памяти.
+ * @param end Указатель на конец блока памяти.
+ * @param first Первое искомое значение.
+ * @param second Второе искомое значение.
+ * @param third Третье искомое значение.
+ *
+ * @return Указатель на первый найденный байт или nullptr, если байт не найден.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c begin является NULL.
+ *
+ * @see ae_memory_raw_find_byte2
+ */
+AE_ATTRIBUTE(SYMBOL)
+const void *
+ae_memory_raw_find_byte3(const void *begin,
+                         const void *end,
+                         ae_u8_t     first,
+                         ae_u8_t     second,
+                         ae_u8_t     third);
+
+/**
+ * @brief Ищет первый байт, входящий в класс байт.
+ *
+ * Принадлежность классу проверяется сразу для 16, 32 или 64 байт
+ * (SSSE3, AVX2 или AVX-512) поиском в таблицах класса инструкцией `pshufb`,
+ * поэтому скорость поиска не зависит от количества байт в классе.
+ * Чтение не выходит за пределы диапазона `[begin, end)`.
+ *
+ * @param begin Указатель на начало блока памяти.
+ * @param end Указатель на конец блока памяти.
+ * @param cls Указатель на класс байт.
+ *
+ * @return Указатель на первый байт из класса или nullptr, если такого байта нет.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c begin или @c cls является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+const void *
+ae_memory_raw_find_class(const void *begin, const void *end, const ae_byte_class_t *cls);
+
+/**
+ * @brief Ищет последний байт, входящий в класс байт.
+ *
+ * @param begin Указатель на начало блока памяти.
+ * @param end Указатель на конец блока памяти.
+ * @param cls Указатель на класс байт.
+ *
+ * @return Указатель на последний байт из класса или nullptr, если такого байта нет.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c begin или @c cls является NULL.
+ *
+ * @see ae_memory_raw_find_class
+ */
+AE_ATTRIBUTE(SYMBOL)
+const void *
+ae_memory_raw_find_class_from_end(const void *begin, const void *end, const ae_byte_class_t *cls);
+
+/**
+ * @brief Ищет первый байт, не входящий в класс байт.
+ *
+ * @param begin Указатель на начало блока памяти.
+ * @param end Указатель на конец блока памяти.
+ * @param cls Указатель на класс байт.
+ *
+ * @return Указатель на первый байт вне класса или nullptr,
+ *         если все байты блока входят в класс.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c begin или @c cls является NULL.
+ *
+ * @see ae_memory_raw_find_class
+ */
+AE_ATTRIBUTE(SYMBOL)
+const void *
+ae_memory_raw_find_not_class(const void *begin, const void *end, const ae_byte_class_t *cls);
+
+/**
+ * @brief Ищет последний байт, не входящий в класс байт.
+ *
+ * @param begin Указатель на начало блока памяти.
+ * @param end Указатель на конец блока памяти.
+ * @param cls Указатель на класс байт.
+ *
+ * @return Указатель на последний байт вне класса или nullptr,
+ *         если все байты блока входят в класс.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c begin или @c cls является NULL.
+ *
+ * @see ae_memory_raw_find_class
+ */
+AE_ATTRIBUTE(SYMBOL)
+const void *
+ae_memory_raw_find_not_class_from_end(const void            *begin,
+                                      const void            *end,
+                                      const ae_byte_class_t *cls);
+
+/**
+ * @brief Возвращает битовую маску байт, входящих в класс, среди первых 64 байт блока.
+ *
+ * Бит `i` маски установлен, если байт `begin[i]` входит в класс. Блок длиннее 64 байт
+ * обрабатывается только в пределах первых 64 байт. Функция позволяет обработать
+ * все вхождения класса в окне одним вызовом векторного ядра, перебирая
+ * установленные биты маски (например, при разбиении строки на поля).
+ *
+ * @param begin Указатель на начало блока памяти.
+ * @param end Указатель на конец блока памяти.
+ * @param cls Указатель на класс байт.
+ *
+ * @return Маска байт из класса (0 для пустого блока).
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c begin или @c cls является NULL.
+ *
+ * @see ae_memory_raw_find_class
+ */
+AE_ATTRIBUTE(SYMBOL)
+ae_u64_t
+ae_memory_raw_match_class(const void *begin, const void *end, const ae_byte_class_t *cls);
+
+/**
+ * @brief Подсчитывает байты блока памяти, равные заданному значению.
+ *
+ * Например, количество строк в текстовом буфере равно количеству
+ * байт `'\n'` (с поправкой на последнюю строку без перевода строки).
+ *
+ * @param begin Указатель на начало блока памяти.
+ * @param end Указатель на конец блока памяти.
+ * @param value Искомое значение байта.
+ *
+ * @return Количество байт, равных @c value.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c begin является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+ae_usize_t
+ae_memory_raw_count_byte(const void *begin, const void *end, ae_u8_t value);
+
+/**
+ * @brief Подсчитывает установленные биты в блоке памяти.
+ *
+ * @param begin Указатель на начало блока памяти.
+ * @param end Указатель на конец блока памяти.
+ *
+ * @return Общее количество единичных битов во всех байтах блока.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c begin является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+ae_usize_t
+ae_memory_raw_popcount(const void *begin, const void *end);
+
+/**
+ * @brief Ищет первый ненулевой байт в блоке памяти.
+ *
+ * Векторные ядра объединяют побитовым ИЛИ несколько регистров подряд
+ * и проверяют результат один раз на группу, поэтому проверка блока,
+ * состоящего из нулей, ограничена в основном пропускной способностью памяти,
+ * а при обнаружении ненулевого байта поиск завершается досрочно.
+ *
+ * @param begin Указатель на начало блока памяти.
+ * @param end Указатель на конец блока памяти.
+ *
+ * @return Указатель на первый ненулевой байт или NULL,
+ *         если все байты блока равны нулю.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c begin является NULL.
+ *
+ * @see ae_memory_raw_is_zero
+ */
+AE_ATTRIBUTE(SYMBOL)
+const void *
+ae_memory_raw_find_nonzero(const void *begin, const void *end);
+
+/**
+ * @brief Проверяет, что все байты блока памяти равны нулю.
+ *
+ * @param begin Указатель на начало блока памяти.
+ * @param end Указатель на конец блока памяти.
+ *
+ * @return true, если блок пуст или состоит только из нулевых байт.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c begin является NULL.
+ *
+ * @see ae_memory_raw_find_nonzero
+ */
+AE_ATTRIBUTE(SYMBOL)
+bool
+ae_memory_raw_is_zero(const void *begin, const void *end);
+
+/**
+ * @brief Ищет первый байт вне диапазона ASCII (со старшим битом, равным 1).
+ *
+ * Векторные ядра объединяют побитовым ИЛИ несколько регистров подряд
+ * и проверяют старшие биты результата один раз на группу
+ * (см. `ae_memory_raw_find_nonzero`).
+ *
+ * @param begin Указатель на начало блока памяти.
+ * @param end Указатель на конец блока памяти.
+ *
+ * @return Указатель на первый байт со значением больше 0x7F или NULL,
+ *         если все байты блока принадлежат ASCII.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c begin является NULL.
+ *
+ * @see ae_memory_raw_is_ascii
+ */
+AE_ATTRIBUTE(SYMBOL)
+const void *
+ae_memory_raw_find_non_ascii(const void *begin, const void *end);
+
+/**
+ * @brief Проверяет, что все байты блока памяти принадлежат ASCII.
+ *
+ * @param begin Указатель на начало блока памяти.
+ * @param end Указатель на конец блока памяти.
+ *
+ * @return true, если блок пуст или состоит только из байт от 0x00 до 0x7F.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c begin является NULL.
+ *
+ * @see ae_memory_raw_find_non_ascii
+ */
+AE_ATTRIBUTE(SYMBOL)
+bool
+ae_memory_raw_is_ascii(const void *begin, const void *end);
+
+/**
+ * @brief Ищет первое вхождение 16-битного элемента в блоке памяти.
+ *
+ * Блок рассматривается как массив 16-битных элементов, начинающийся с @c begin;
+ * неполный элемент в конце блока не учитывается. Функция используется
+ * для поиска в строках `ae_wchar_t` размером 2 байта.
+ *
+ * @param begin Указатель на начало блока памяти.
+ * @param end Указатель на конец блока памяти.
+ * @param value Искомое значение элемента.
+ *
+ * @return Указатель на первый найденный элемент или nullptr, если элемент не найден.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c begin является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+const void *
+ae_memory_raw_find_u16(const void *begin, const void *end, ae_u16_t value);
+
+/**
+ * @brief Ищет первое вхождение 32-битного элемента в блоке памяти.
+ *
+ * Блок рассматривается как массив 32-битных элементов, начинающийся с @c begin;
+ * неполный элемент в конце блока не учитывается. Функция используется
+ * для поиска в строках `ae_wchar_t` размером 4 байта.
+ *
+ * @param begin Указатель на начало блока памяти.
+ * @param end Указатель на конец блока памяти.
+ * @param value Искомое значение элемента.
+ *
+ * @return Указатель на первый найденный элемент или nullptr, если элемент не найден.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c begin является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+const void *
+ae_memory_raw_find_u32(const void *begin, const void *end, ae_u32_t value);
+
+/**
+ * @brief Ищет нулевой элемент (терминатор) в последовательности неизвестной длины.
+ *
+ * Последовательность рассматривается как массив элементов шириной @c width байт
+ * (1 для `ae_char_t`, 2 или 4 для `ae_wchar_t`). Поиск выполняется блоками,
+ * выровненными на ширину вектора, поэтому чтение никогда не пересекает
+ * границу страницы, в которой нет ни одного элемента последовательности.
+ * Для элементов, не выровненных на свою ширину, используется поэлементный поиск.
+ *
+ * @param str Указатель на начало последовательности.
+ * @param width Ширина элемента в байтах (1, 2 или 4).
+ *
+ * @return Указатель на первый нулевой элемент.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c str является NULL.
+ * @throw AE_RUNTIME_ERROR_INVALID_ARGUMENT
+ *        Если @c width не равно 1, 2 или 4.
+ *
+ * @warning Последовательность обязана содержать терминатор.
+ */
+AE_ATTRIBUTE(SYMBOL)
+const void *
+ae_memory_raw_find_null_terminator(const void *str, ae_usize_t width);
+
 /**
  * @brief Заполняет данными из одного блока памяти в другой.
  *
  * Эта функция копирует данные из источника `src` в назначение `dst`,
  * пока не будет достигнут конец блока `dst_end`.
  *
+ * Шаблоны длиной 1, 2, 4, 8 и 16 байт размножаются в SIMD-регистры
+ * и записываются выровненными блоками; для областей размером от порога
+ * невременной записи (см. `ae_memory_raw_set_non_temporal_threshold`) используются
+ * невременные инструкции записи в обход кэша. Шаблоны другой длины заполняются
+ * удвоением уже записанной части. Если шаблон пуст, память не изменяется.
+ *
  * @param dst Указатель на начало блока памяти назначения,
  *            в который будут дублироваться данные.
  * @param dst_end Указатель на конец блока памяти назначения.
@@ -223,6 +766,147 @@ AE_ATTRIBUTE(SYMBOL)
 void *
 ae_memory_raw_set(void *dst, const void *dst_end, const void *src, const void *src_end);
 
+/**
+ * @brief Копирует данные, заменяя каждый байт значением из таблицы.
+ *
+ * Байт `b` источника записывается в назначение как `table[b]`. Копируется
+ * столько байт, сколько помещается в меньший из буферов. Буферы могут совпадать
+ * (преобразование на месте); частичное перекрытие допускается, только если
+ * назначение начинается не позже источника.
+ *
+ * Таблица загружается в регистры целиком: при поддержке AVX-512 VBMI
+ * значения выбираются инструкцией `vpermi2b`, на AVX2 и AVX-512BW - 16 инструкциями
+ * `vpshufb` по строкам таблицы (по младшей тетраде байта).
+ *
+ * @param dst Указатель на целевой буфер.
+ * @param dst_end Указатель на конец целевого буфера.
+ * @param src Указатель на исходный буфер.
+ * @param src_end Указатель на конец исходного буфера.
+ * @param table Таблица замены из 256 байт.
+ *
+ * @return Указатель на конец записанных данных в целевом буфере.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c dst, @c src или @c table является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+void *
+ae_memory_raw_translate(void          *dst,
+                        const void    *dst_end,
+                        const void    *src,
+                        const void    *src_end,
+                        const ae_u8_t *table);
+
+/**
+ * @brief Копирует данные, переводя строчные латинские буквы ASCII в заглавные.
+ *
+ * Остальные байты (в том числе байты вне ASCII) копируются без изменений.
+ * Ограничения на размер и перекрытие буферов такие же, как у `ae_memory_raw_translate`.
+ *
+ * @param dst Указатель на целевой буфер.
+ * @param dst_end Указатель на конец целевого буфера.
+ * @param src Указатель на исходный буфер.
+ * @param src_end Указатель на конец исходного буфера.
+ *
+ * @return Указатель на конец записанных данных в целевом буфере.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c dst или @c src является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+void *
+ae_memory_raw_to_upper(void *dst, const void *dst_end, const void *src, const void *src_end);
+
+/**
+ * @brief Копирует данные, переводя заглавные латинские буквы ASCII в строчные.
+ *
+ * Остальные байты копируются без изменений (см. `ae_memory_raw_to_upper`).
+ *
+ * @param dst Указатель на целевой буфер.
+ * @param dst_end Указатель на конец целевого буфера.
+ * @param src Указатель на исходный буфер.
+ * @param src_end Указатель на конец исходного буфера.
+ *
+ * @return Указатель на конец записанных данных в целевом буфере.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c dst или @c src является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+void *
+ae_memory_raw_to_lower(void *dst, const void *dst_end, const void *src, const void *src_end);
+
+/**
+ * @brief Копирует данные из одного буфера в другой несколькими потоками.
+ *
+ * Результат совпадает с `ae_memory_raw_copy`. Блоки размером от
+ * `AE_MEMORY_RAW_PARALLEL_THRESHOLD` байт делятся на части, выровненные
+ * по строке кэша, которые копируются потоками пула (см. `ae_worker_pool_run`).
+ * Меньшие и перекрывающиеся блоки копируются вызывающим потоком
+ * (как в `ae_memory_raw_move`).
+ *
+ * @param dst Указатель на целевой буфер.
+ * @param dst_end Указатель на конец целевого буфера.
+ * @param src Указатель на исходный буфер.
+ * @param src_end Указатель на конец исходного буфера.
+ *
+ * @return Указатель на конец скопированных данных в целевом буфере.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c dst или @c src является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+void *
+ae_memory_raw_copy_parallel(void *dst, const void *dst_end, const void *src, const void *src_end);
+
+/**
+ * @brief Заполняет область памяти повторяющимся шаблоном несколькими потоками.
+ *
+ * Результат совпадает с `ae_memory_raw_set`. Области размером от
+ * `AE_MEMORY_RAW_PARALLEL_THRESHOLD` байт делятся на части, выровненные
+ * по строке кэша; каждая часть продолжает шаблон с нужной позиции.
+ *
+ * @param dst Указатель на начало блока памяти назначения.
+ * @param dst_end Указатель на конец блока памяти назначения.
+ * @param src Указатель на начало шаблона.
+ * @param src_end Указатель на конец шаблона.
+ *
+ * @return Указатель на конец заполненной области.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c dst или @c src является NULL.
+ *
+ * @warning Шаблон не должен перекрываться с заполняемой областью.
+ */
+AE_ATTRIBUTE(SYMBOL)
+void *
+ae_memory_raw_set_parallel(void *dst, const void *dst_end, const void *src, const void *src_end);
+
+/**
+ * @brief Сравнивает два блока памяти несколькими потоками.
+ *
+ * Результат совпадает с `ae_memory_raw_compare`: возвращается первое
+ * несовпадение. Части блока выдаются потокам по возрастанию адреса,
+ * и после найденного несовпадения последующие части не проверяются.
+ *
+ * @param lhs Указатель на начало первого блока.
+ * @param lhs_end Указатель на конец первого блока.
+ * @param rhs Указатель на начало второго блока.
+ * @param rhs_end Указатель на конец второго блока.
+ *
+ * @return Указатель на первый отличающийся байт в блоке @c lhs
+ *         или nullptr, если блоки совпадают.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c lhs или @c rhs является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+const void *
+ae_memory_raw_compare_parallel(const void *lhs,
+                               const void *lhs_end,
+                               const void *rhs,
+                               const void *rhs_end);
+
 AE_COMPILER(EXTERN_C_END)
 
 #endif // AE_MEMORY_RAW_H
@@ -0,0 +1,150 @@
+/**
+ * @file memory_searcher.h
+ * @brief Повторно используемый объект поиска подпоследовательности байт.
+ *
+ * Данный файл содержит структуру `ae_memory_searcher_t`, которая хранит
+ * предварительно вычисленные данные для поиска одной и той же последовательности
+ * байт (иглы) в произвольном количестве буферов.
+ *
+ * Стратегия поиска выбирается по длине иглы:
+ * - Короткие иглы (не длиннее `AE_MEMORY_SEARCHER_SHORT_NEEDLE_SIZE` байт) ищутся
+ *   SIMD-фильтрацией кандидатов по первому и последнему байту иглы
+ *   с последующей проверкой середины (см. `ae_memory_raw_find`).
+ * - Длинные иглы ищутся алгоритмом Two-Way (Crochemore–Perrin), который гарантирует
+ *   линейное время и константную дополнительную память, с таблицей сдвигов по
+ *   последнему байту окна для сублинейного пропуска несовпадающих участков.
+ *
+ * Для длинных игл критическая факторизация и таблицы сдвигов вычисляются один раз
+ * в `ae_memory_searcher_init` (для прямого и обратного направлений),
+ * поэтому многократный поиск не повторяет подготовку.
+ *
+ * @see ae_memory_searcher_init
+ * @see ae_memory_searcher_find
+ * @see ae_memory_searcher_find_from_end
+ */
+
+#ifndef AE_MEMORY_SEARCHER_H
+#define AE_MEMORY_SEARCHER_H
+
+#include "attribute.h"
+#include "size.h"
+
+/**
+ * @def AE_MEMORY_SEARCHER_SHORT_NEEDLE_SIZE
+ * @brief Максимальная длина иглы, для которой используется
+ *        SIMD-фильтрация кандидатов вместо алгоритма Two-Way.
+ */
+#define AE_MEMORY_SEARCHER_SHORT_NEEDLE_SIZE 32
+
+/**
+ * @brief Данные алгоритма Two-Way для одного направления поиска.
+ */
+typedef struct ae_memory_searcher_plan
+{
+    /**
+     * @brief Позиция критической факторизации иглы.
+     */
+    ae_usize_t critical_pos;
+
+    /**
+     * @brief Период иглы (или оценка сдвига для непериодической иглы).
+     */
+    ae_usize_t period;
+
+    /**
+     * @brief Длина префикса, совпадение которого запоминается после сдвига
+     *        на период (0 для непериодической иглы).
+     */
+    ae_usize_t memory;
+
+    /**
+     * @brief Таблица сдвигов: для каждого байта хранится позиция
+     *        его последнего вхождения в иглу плюс один (0, если байта нет в игле).
+     */
+    ae_usize_t shift[256];
+} ae_memory_searcher_plan_t;
+
+/**
+ * @brief Объект поиска последовательности байт.
+ *
+ * Объект хранит указатель на иглу, поэтому игла должна оставаться
+ * доступной все время использования объекта.
+ */
+typedef struct ae_memory_searcher
+{
+    /**
+     * @brief Указатель на начало иглы.
+     */
+    const void *needle;
+
+    /**
+     * @brief Указатель на конец иглы.
+     */
+    const void *needle_end;
+
+    /**
+     * @brief Данные для поиска от начала буфера.
+     */
+    ae_memory_searcher_plan_t forward;
+
+    /**
+     * @brief Данные для поиска от конца буфера.
+     */
+    ae_memory_searcher_plan_t backward;
+} ae_memory_searcher_t;
+
+AE_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Подготавливает объект поиска для указанной иглы.
+ *
+ * @param self Указатель на объект поиска.
+ * @param needle Указатель на начало иглы.
+ * @param needle_end Указатель на конец иглы.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c self или @c needle является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+void
+ae_memory_searcher_init(ae_memory_searcher_t *self, const void *needle, const void *needle_end);
+
+/**
+ * @brief Ищет первое вхождение иглы в буфере.
+ *
+ * @param self Указатель на подготовленный объект поиска.
+ * @param begin Указатель на начало буфера.
+ * @param end Указатель на конец буфера.
+ *
+ * @return Указатель на начало первого вхождения или nullptr, если игла не найдена.
+ *         Для пустой иглы возвращается @c begin (если буфер не пуст).
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c self или @c begin является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+const void *
+ae_memory_searcher_find(const ae_memory_searcher_t *self, const void *begin, const void *end);
+
+/**
+ * @brief Ищет последнее вхождение иглы в буфере.
+ *
+ * @param self Указатель на подготовленный объект поиска.
+ * @param begin Указатель на начало буфера.
+ * @param end Указатель на конец буфера.
+ *
+ * @return Указатель на начало последнего вхождения или nullptr, если игла не найдена.
+ *         Для пустой иглы возвращается @c end (если буфер не пуст).
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c self или @c begin является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+const void *
+ae_memory_searcher_find_from_end(const ae_memory_searcher_t *self,
+                                 const void                 *begin,
+                                 const void                 *end);
+
+AE_COMPILER(EXTERN_C_END)
+
+#endif // AE_MEMORY_SEARCHER_H
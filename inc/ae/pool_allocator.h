@@ -0,0 +1,224 @@
+/**
+ * @file pool_allocator.h
+ * @brief Пул: аллокатор небольших блоков с классами размеров.
+ *
+ * Данный файл содержит структуру `ae_pool_allocator_t`, которая распределяет блоки
+ * размером от `AE_POOL_ALLOCATOR_MIN_SIZE` до `AE_POOL_ALLOCATOR_MAX_SIZE` байт
+ * по классам размеров (степеням двойки). Блоки каждого класса нарезаются из слэбов
+ * размером `AE_POOL_ALLOCATOR_SLAB_SIZE`, полученных у родительского аллокатора,
+ * а освобожденные блоки хранятся во встроенном (интрузивном) списке класса
+ * и выдаются повторно в порядке LIFO, пока они еще находятся в кэше.
+ *
+ * Слэбы выровнены по своему размеру, поэтому класс блока определяется по его адресу,
+ * и освобождение не требует размера. Блоки больше `AE_POOL_ALLOCATOR_MAX_SIZE`
+ * выделяются у родительского аллокатора по отдельности.
+ *
+ * Записи фиксированного размера (`element_size` блока памяти) попадают в класс
+ * наименьшей подходящей степени двойки, поэтому массивы небольших записей
+ * выделяются без обращения к родительскому аллокатору.
+ *
+ * @note Пул не является потокобезопасным.
+ *
+ * @see ae_pool_allocator_init
+ * @see ae_pool_allocator_get_allocator
+ */
+
+#ifndef AE_POOL_ALLOCATOR_H
+#define AE_POOL_ALLOCATOR_H
+
+#include "memory_allocator.h"
+#include "attribute.h"
+#include "size.h"
+
+/**
+ * @brief Размер блоков наименьшего класса в байтах.
+ */
+#define AE_POOL_ALLOCATOR_MIN_SIZE 16
+
+/**
+ * @brief Размер блоков наибольшего класса в байтах.
+ */
+#define AE_POOL_ALLOCATOR_MAX_SIZE 4096
+
+/**
+ * @brief Количество классов размеров: степени двойки
+ *        от `AE_POOL_ALLOCATOR_MIN_SIZE` до `AE_POOL_ALLOCATOR_MAX_SIZE`.
+ */
+#define AE_POOL_ALLOCATOR_CLASS_COUNT 9
+
+/**
+ * @brief Статистика класса размеров.
+ */
+typedef struct ae_pool_allocator_class_stats
+{
+    /**
+     * @brief Размер блоков класса в байтах.
+     */
+    ae_usize_t block_size;
+
+    /**
+     * @brief Количество выданных и еще не освобожденных блоков.
+     */
+    ae_usize_t in_use;
+
+    /**
+     * @brief Количество освобожденных блоков, ожидающих повторной выдачи.
+     */
+    ae_usize_t cached;
+
+    /**
+     * @brief Общее количество выделений блоков класса.
+     */
+    ae_usize_t total_allocs;
+} ae_pool_allocator_class_stats_t;
+
+/**
+ * @brief Статистика пула.
+ */
+typedef struct ae_pool_allocator_stats
+{
+    /**
+     * @brief Статистика классов размеров по возрастанию размера блоков.
+     */
+    ae_pool_allocator_class_stats_t classes[AE_POOL_ALLOCATOR_CLASS_COUNT];
+
+    /**
+     * @brief Количество слэбов, полученных у родительского аллокатора.
+     */
+    ae_usize_t slab_count;
+
+    /**
+     * @brief Количество неосвобожденных блоков больше `AE_POOL_ALLOCATOR_MAX_SIZE`.
+     */
+    ae_usize_t large_in_use;
+
+    /**
+     * @brief Общее количество выделений блоков больше `AE_POOL_ALLOCATOR_MAX_SIZE`.
+     */
+    ae_usize_t large_total_allocs;
+} ae_pool_allocator_stats_t;
+
+/**
+ * @brief Состояние класса размеров.
+ */
+typedef struct ae_pool_allocator_class
+{
+    /**
+     * @brief Вершина списка освобожденных блоков; ссылка на следующий блок
+     *        хранится в первых байтах самого блока.
+     */
+    void *free_list;
+
+    /**
+     * @brief Первый еще не выданный блок текущего слэба класса.
+     */
+    void *cursor;
+
+    /**
+     * @brief Конец нарезаемой части текущего слэба класса.
+     */
+    void *limit;
+} ae_pool_allocator_class_t;
+
+/**
+ * @brief Пул памяти.
+ *
+ * Структура содержит интерфейс аллокатора, контекстом которого является сам пул,
+ * поэтому после инициализации пул нельзя перемещать или копировать.
+ */
+typedef struct ae_pool_allocator
+{
+    /**
+     * @brief Интерфейс аллокатора, выделяющего память из пула.
+     */
+    ae_memory_allocator_t allocator;
+
+    /**
+     * @brief Родительский аллокатор, у которого запрашиваются слэбы и крупные блоки.
+     */
+    const ae_memory_allocator_t *parent;
+
+    /**
+     * @brief Состояние классов размеров.
+     */
+    ae_pool_allocator_class_t classes[AE_POOL_ALLOCATOR_CLASS_COUNT];
+
+    /**
+     * @brief Список всех слэбов и крупных блоков пула.
+     */
+    struct ae_pool_allocator_slab *slabs;
+
+    /**
+     * @brief Статистика пула.
+     */
+    ae_pool_allocator_stats_t stats;
+} ae_pool_allocator_t;
+
+AE_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Инициализирует пустой пул.
+ *
+ * Слэбы запрашиваются у родительского аллокатора функцией
+ * `ae_memory_allocator_align_alloc` при первом выделении блока класса.
+ *
+ * @param self Указатель на пул.
+ * @param parent Указатель на родительский аллокатор, который должен оставаться
+ *               доступным все время использования пула.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c self или @c parent является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+void
+ae_pool_allocator_init(ae_pool_allocator_t *self, const ae_memory_allocator_t *parent);
+
+/**
+ * @brief Возвращает интерфейс аллокатора, выделяющего память из пула.
+ *
+ * Интерфейс поддерживает выравнивание до размера слэба; блок, выделенный
+ * с выравниванием, может быть освобожден как обычной, так и выровненной функцией.
+ *
+ * @param self Указатель на пул.
+ *
+ * @return Указатель на интерфейс аллокатора, действительный до перемещения пула.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c self является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+const ae_memory_allocator_t *
+ae_pool_allocator_get_allocator(const ae_pool_allocator_t *self);
+
+/**
+ * @brief Возвращает статистику пула.
+ *
+ * @param self Указатель на пул.
+ *
+ * @return Указатель на статистику, обновляемую при каждом выделении и освобождении.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c self является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+const ae_pool_allocator_stats_t *
+ae_pool_allocator_get_stats(const ae_pool_allocator_t *self);
+
+/**
+ * @brief Возвращает все слэбы и крупные блоки родительскому аллокатору.
+ *
+ * После вызова все выделенные из пула блоки становятся недействительными,
+ * а пул снова пуст и готов к использованию.
+ *
+ * @param self Указатель на пул.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c self является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+void
+ae_pool_allocator_clear(ae_pool_allocator_t *self);
+
+AE_COMPILER(EXTERN_C_END)
+
+#endif // AE_POOL_ALLOCATOR_H
@@ -71,6 +71,18 @@
  */
 #define ae_runtime_allocator_free(...) ae_memory_allocator_free(ae_runtime_allocator(), __VA_ARGS__)
 
+/**
+ * @brief Освобождает ранее выделенную память известного размера
+ *        с использованием аллокатора времени выполнения.
+ *
+ * @param ... Параметры, передаваемые в функцию `ae_memory_allocator_free_sized`.
+ *
+ * @see ae_runtime_allocator
+ * @see ae_memory_allocator_free_sized
+ */
+#define ae_runtime_allocator_free_sized(...)                                                       \
+    ae_memory_allocator_free_sized(ae_runtime_allocator(), __VA_ARGS__)
+
 /**
  * @brief Перераспределяет выровненную память
  *        с использованием аллокатора времени выполнения.
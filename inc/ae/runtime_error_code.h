@@ -207,7 +207,17 @@ typedef enum ae_runtime_error_code
      * Возникает при попытке использовать неинициализированную функцию
      * освобождения памяти. Убедитесь, что деаллокатор правильно настроен.
      */
-    AE_RUNTIME_ERROR_DEALLOCATOR_FUNCTION_NOT_INITIALIZED
+    AE_RUNTIME_ERROR_DEALLOCATOR_FUNCTION_NOT_INITIALIZED,
+
+    /**
+     * @brief Ошибка: недопустимая кодировка данных.
+     *
+     * Возникает при обработке текста, который не является корректной
+     * последовательностью в ожидаемой кодировке (например, UTF-8 с
+     * недопустимыми, избыточными или незавершенными последовательностями
+     * или UTF-16 с непарными суррогатами).
+     */
+    AE_RUNTIME_ERROR_INVALID_ENCODING
 } ae_runtime_error_code_t;
 
 #endif // AE_RUNTIME_ERROR_CODE_H
@@ -5,6 +5,8 @@
 #include "size.h"
 #include "attribute.h"
 #include "array_size.h"
+#include "numeric_types.h"
+#include "bool.h"
 
 AE_COMPILER(EXTERN_C_BEGIN)
 
@@ -36,7 +38,9 @@ ae_str_raw_find_char(const ae_char_t *str, ae_usize_t len, ae_char_t value);
  * @brief Ищет символ нулевого терминатора в строке.
  *
  * Эта функция ищет первое вхождение символа нулевого терминатора в заданном блоке памяти,
- * представляющем строку. Она использует максимальную длину блока памяти для поиска.
+ * представляющем строку. Поиск выполняется выровненными блоками и не пересекает
+ * границу страницы, в которой нет ни одного символа строки
+ * (см. `ae_memory_raw_find_null_terminator`).
  *
  * - Если нулевой терминатор найден, функция возвращает указатель на его первое вхождение.
  * - Если нулевой терминатор не найден, возвращается nullptr.
@@ -194,6 +198,165 @@ ae_str_raw_compare_from_end(const ae_char_t *str,
                             const ae_char_t *src,
                             ae_usize_t       src_len);
 
+/**
+ * @brief Сравнивает две строки без учета регистра латинских букв ASCII.
+ *
+ * Контракт совпадает с `ae_str_raw_compare`: сравнивается общая часть строк,
+ * а результатом является первое различие в @c str. Буквы приводятся
+ * к одному регистру векторными ядрами `ae_memory_raw_compare_icase`
+ * целыми блоками, а не по одному символу.
+ *
+ * @param str Указатель на начало первой строки.
+ * @param str_len Длина первой строки для сравнения.
+ * @param src Указатель на начало второй строки.
+ * @param src_len Длина второй строки для сравнения.
+ *
+ * @return Указатель на первое различие между строками или nullptr,
+ *         если строки равны без учета регистра.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c str или @c src является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+const ae_char_t *
+ae_str_raw_compare_icase(const ae_char_t *str,
+                         ae_usize_t       str_len,
+                         const ae_char_t *src,
+                         ae_usize_t       src_len);
+
+/**
+ * @brief Определяет лексикографический порядок двух строк.
+ *
+ * Символы сравниваются как беззнаковые байты (как в `strcmp`),
+ * а при совпадении общей части меньшей считается более короткая строка
+ * (см. `ae_memory_raw_order`).
+ *
+ * @param str Указатель на начало первой строки.
+ * @param str_len Длина первой строки.
+ * @param src Указатель на начало второй строки.
+ * @param src_len Длина второй строки.
+ *
+ * @return Отрицательное значение, если первая строка меньше второй,
+ *         0, если строки равны, и положительное значение, если первая строка больше.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c str или @c src является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+ae_sint_t
+ae_str_raw_order(const ae_char_t *str,
+                 ae_usize_t       str_len,
+                 const ae_char_t *src,
+                 ae_usize_t       src_len);
+
+/**
+ * @brief Проверяет, что строка состоит только из символов ASCII.
+ *
+ * Старшие биты символов объединяются побитовым ИЛИ целыми регистрами
+ * (см. `ae_memory_raw_is_ascii`), что позволяет выбрать быстрый путь обработки
+ * строки до посимвольного разбора.
+ *
+ * @param str Указатель на начало строки.
+ * @param len Длина строки.
+ *
+ * @return true, если строка пуста или все ее символы принадлежат ASCII.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c str является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+bool
+ae_str_raw_is_ascii(const ae_char_t *str, ae_usize_t len);
+
+/**
+ * @brief Ищет первый символ строки, совпадающий с одним из заданных символов.
+ *
+ * Для одного, двух и трех символов используется поиск по значениям
+ * (`ae_memory_raw_find_byte`, `ae_memory_raw_find_byte2`, `ae_memory_raw_find_byte3`),
+ * для большего количества - поиск по классу байт (`ae_memory_raw_find_class`).
+ *
+ * @param str Указатель на начало строки.
+ * @param len Длина строки.
+ * @param chars Указатель на массив искомых символов.
+ * @param chars_len Количество искомых символов.
+ *
+ * @return Указатель на первый найденный символ или nullptr, если символ не найден
+ *         (в том числе при пустом массиве @c chars).
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c str или @c chars является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+const ae_char_t *
+ae_str_raw_find_any_char(const ae_char_t *str,
+                         ae_usize_t       len,
+                         const ae_char_t *chars,
+                         ae_usize_t       chars_len);
+
+/**
+ * @brief Пропускает пробельные символы в начале строки.
+ *
+ * Пробельными считаются пробел, символы новой строки, возврата каретки,
+ * табуляции, вертикальной табуляции и нулевой терминатор.
+ *
+ * @param str Указатель на начало строки.
+ * @param len Длина строки.
+ *
+ * @return Указатель на первый непробельный символ или на конец строки (`str + len`),
+ *         если строка состоит только из пробельных символов.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c str является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+const ae_char_t *
+ae_str_raw_trim_left(const ae_char_t *str, ae_usize_t len);
+
+/**
+ * @brief Отбрасывает пробельные символы в конце строки.
+ *
+ * @param str Указатель на начало строки.
+ * @param len Длина строки.
+ *
+ * @return Указатель на символ, следующий за последним непробельным символом,
+ *         или @c str, если строка состоит только из пробельных символов.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c str является NULL.
+ *
+ * @see ae_str_raw_trim_left
+ */
+AE_ATTRIBUTE(SYMBOL)
+const ae_char_t *
+ae_str_raw_trim_right(const ae_char_t *str, ae_usize_t len);
+
+/**
+ * @brief Выделяет первую лексему строки, ограниченную символами-разделителями.
+ *
+ * Функция пропускает разделители в начале строки и возвращает начало лексемы,
+ * а ее длину записывает в @c token_len. Строка не изменяется, поэтому для перебора
+ * всех лексем следующий вызов выполняется с позиции `token + *token_len`.
+ *
+ * @param str Указатель на начало строки.
+ * @param len Длина строки.
+ * @param delims Указатель на массив символов-разделителей.
+ * @param delims_len Количество символов-разделителей.
+ * @param token_len Указатель для записи длины найденной лексемы.
+ *
+ * @return Указатель на начало лексемы или nullptr, если строка
+ *         состоит только из разделителей.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c str, @c delims или @c token_len является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+const ae_char_t *
+ae_str_raw_tokenize(const ae_char_t *str,
+                    ae_usize_t       len,
+                    const ae_char_t *delims,
+                    ae_usize_t       delims_len,
+                    ae_usize_t      *token_len);
+
 AE_COMPILER(EXTERN_C_END)
 
 #endif // AE_STR_RAW_H
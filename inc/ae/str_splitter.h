@@ -0,0 +1,171 @@
+/**
+ * @file str_splitter.h
+ * @brief Разбиение строки на поля без выделения памяти.
+ *
+ * Данный файл содержит структуру `ae_str_splitter_t`, которая последовательно
+ * выделяет из строки поля, ограниченные символами-разделителями, и возвращает их
+ * как диапазоны `ae_memory_range_t`, указывающие в исходную строку.
+ * Строка не изменяется и не копируется. Разделители ищутся окнами по 64 байта:
+ * для каждого окна векторное ядро `ae_memory_raw_match_class` один раз строит
+ * битовую маску разделителей, после чего поля окна выделяются перебором
+ * установленных битов без повторного обращения к памяти.
+ *
+ * В отличие от `ae_str_raw_tokenize`, пустые поля не пропускаются:
+ * строка из `n` разделителей дает `n + 1` поле, как в записях CSV.
+ *
+ * @see ae_str_splitter_init
+ * @see ae_str_splitter_next
+ * @see ae_str_splitter_next_batch
+ */
+
+#ifndef AE_STR_SPLITTER_H
+#define AE_STR_SPLITTER_H
+
+#include "char.h"
+#include "size.h"
+#include "bool.h"
+#include "attribute.h"
+#include "byte_class.h"
+#include "memory_range.h"
+#include "numeric_fixed_types.h"
+
+/**
+ * @brief Объект разбиения строки на поля.
+ *
+ * Объект хранит указатели на исходную строку, поэтому строка должна оставаться
+ * доступной все время использования объекта и полученных из него диапазонов.
+ */
+typedef struct ae_str_splitter
+{
+    /**
+     * @brief Указатель на начало еще не разобранной части строки.
+     */
+    const ae_char_t *begin;
+
+    /**
+     * @brief Указатель на конец строки.
+     */
+    const ae_char_t *end;
+
+    /**
+     * @brief Указатель на начало окна из 64 байт, для которого построена маска @c mask.
+     */
+    const ae_char_t *window;
+
+    /**
+     * @brief Маска еще не выделенных разделителей окна (бит `i` - символ `window[i]`).
+     */
+    ae_u64_t mask;
+
+    /**
+     * @brief Класс символов-разделителей.
+     */
+    ae_byte_class_t cls;
+
+    /**
+     * @brief Признак того, что последнее поле уже выделено.
+     */
+    bool done;
+} ae_str_splitter_t;
+
+AE_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Подготавливает объект разбиения строки по набору разделителей.
+ *
+ * Набор разделителей преобразуется в класс байт, поэтому скорость разбора
+ * не зависит от их количества. Если набор пуст, вся строка выделяется одним полем.
+ *
+ * @param self Указатель на объект разбиения.
+ * @param str Указатель на начало строки.
+ * @param len Длина строки.
+ * @param delims Указатель на массив символов-разделителей.
+ * @param delims_len Количество символов-разделителей.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c self, @c str или @c delims является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+void
+ae_str_splitter_init(ae_str_splitter_t *self,
+                     const ae_char_t   *str,
+                     ae_usize_t         len,
+                     const ae_char_t   *delims,
+                     ae_usize_t         delims_len);
+
+/**
+ * @brief Подготавливает объект разбиения строки по одному разделителю.
+ *
+ * @param self Указатель на объект разбиения.
+ * @param str Указатель на начало строки.
+ * @param len Длина строки.
+ * @param delim Символ-разделитель.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c self или @c str является NULL.
+ *
+ * @see ae_str_splitter_init
+ */
+AE_ATTRIBUTE(SYMBOL)
+void
+ae_str_splitter_init_char(ae_str_splitter_t *self,
+                          const ae_char_t   *str,
+                          ae_usize_t         len,
+                          ae_char_t          delim);
+
+/**
+ * @brief Выделяет следующее поле строки.
+ *
+ * Поле записывается в @c token диапазоном от его первого символа
+ * до следующего разделителя (или конца строки), не включая разделитель.
+ *
+ * @param self Указатель на объект разбиения.
+ * @param token Указатель на диапазон для записи поля.
+ *
+ * @return true, если поле выделено, или false, если поля закончились
+ *         (в этом случае @c token не изменяется).
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c self или @c token является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+bool
+ae_str_splitter_next(ae_str_splitter_t *self, ae_memory_range_t *token);
+
+/**
+ * @brief Выделяет до @c capacity следующих полей строки.
+ *
+ * Эквивалентно повторным вызовам `ae_str_splitter_next`, но проверяет аргументы
+ * один раз на пакет, поэтому лучше подходит для разбора коротких полей.
+ *
+ * @param self Указатель на объект разбиения.
+ * @param tokens Указатель на массив диапазонов для записи полей.
+ * @param capacity Количество элементов массива @c tokens.
+ *
+ * @return Количество записанных полей; значение меньше @c capacity
+ *         означает, что поля закончились.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c self или @c tokens является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+ae_usize_t
+ae_str_splitter_next_batch(ae_str_splitter_t *self, ae_memory_range_t *tokens, ae_usize_t capacity);
+
+/**
+ * @brief Проверяет, что все поля строки уже выделены.
+ *
+ * @param self Указатель на объект разбиения.
+ *
+ * @return true, если следующий вызов `ae_str_splitter_next` вернет false.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c self является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+bool
+ae_str_splitter_is_done(const ae_str_splitter_t *self);
+
+AE_COMPILER(EXTERN_C_END)
+
+#endif // AE_STR_SPLITTER_H
@@ -0,0 +1,511 @@
+/**
+ * @file utf.h
+ * @brief Проверка и преобразование текста в кодировках UTF-8, UTF-16 и UTF-32.
+ *
+ * Данный файл содержит функции, связывающие узкие строки (`ae_str_raw_*`, UTF-8)
+ * и широкие строки (`ae_wstr_raw_*`, UTF-16 или UTF-32 в зависимости от размера
+ * `ae_wchar_t`):
+ * - Проверка корректности UTF-8. Векторные ядра используют табличный алгоритм
+ *   Кайзера-Лемира (simdutf): для каждого байта по старшему и младшему полубайтам
+ *   предыдущего байта и старшему полубайту текущего инструкцией `pshufb` выбираются
+ *   битовые маски возможных ошибок, пересечение которых непусто только для
+ *   недопустимых пар байтов. Блоки из одних ASCII-символов пропускаются целиком.
+ * - Преобразование UTF-8 в UTF-16/UTF-32 и обратно. Участки ASCII-символов
+ *   расширяются или сужаются векторными ядрами, остальные символы
+ *   декодируются с полной проверкой корректности.
+ *
+ * Функции принимают указатели на начало и конец данных, как и функции `ae_memory_raw_*`.
+ * Результат записывается либо в буфер вызывающей стороны (функция возвращает
+ * указатель на конец записанных данных), либо дописывается в конец
+ * динамического блока `ae_dynamic_block_t` (функции `*_dynamic_block`).
+ *
+ * Элементы UTF-16 и UTF-32 хранятся в порядке байтов текущей системы.
+ *
+ * @see ae_utf8_find_invalid
+ * @see ae_utf8_to_utf16
+ * @see ae_utf8_to_wstr
+ * @see ae_utf_dispatch
+ */
+
+#ifndef AE_UTF_H
+#define AE_UTF_H
+
+#include "numeric_fixed_types.h"
+#include "dynamic_block.h"
+#include "attribute.h"
+#include "wchar.h"
+#include "char.h"
+#include "size.h"
+#include "bool.h"
+
+AE_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Выбирает варианты ядер функций модуля.
+ *
+ * Аналогична `ae_memory_raw_dispatch`: при загрузке библиотеки вызывается
+ * автоматически со значением `AE_CPU_FEATURE_ALL`, а повторный вызов позволяет
+ * ограничить набор инструкций.
+ *
+ * @param features Битовая маска значений `ae_cpu_feature_t`.
+ *
+ * @note Функция не является потокобезопасной и должна вызываться
+ *       до использования функций модуля из других потоков.
+ */
+AE_ATTRIBUTE(SYMBOL)
+void
+ae_utf_dispatch(ae_u32_t features);
+
+/**
+ * @brief Ищет первую недопустимую последовательность UTF-8.
+ *
+ * Недопустимыми считаются байты продолжения без начального байта,
+ * незавершенные последовательности (в том числе в конце данных),
+ * избыточные (overlong) формы, суррогаты `U+D800..U+DFFF`
+ * и значения больше `U+10FFFF`.
+ *
+ * @param begin Указатель на начало данных.
+ * @param end Указатель на конец данных.
+ *
+ * @return Указатель на начало первой недопустимой последовательности
+ *         или NULL, если данные являются корректным UTF-8.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c begin является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+const ae_char_t *
+ae_utf8_find_invalid(const ae_char_t *begin, const ae_char_t *end);
+
+/**
+ * @brief Проверяет, являются ли данные корректным UTF-8.
+ *
+ * @param begin Указатель на начало данных.
+ * @param end Указатель на конец данных.
+ *
+ * @return true, если данные пусты или являются корректным UTF-8.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c begin является NULL.
+ *
+ * @see ae_utf8_find_invalid
+ */
+AE_ATTRIBUTE(SYMBOL)
+bool
+ae_utf8_is_valid(const ae_char_t *begin, const ae_char_t *end);
+
+/**
+ * @brief Вычисляет количество элементов UTF-16, необходимое для записи данных UTF-8.
+ *
+ * Данные не проверяются: для корректного UTF-8 результат точен,
+ * а некорректные данные обнаруживаются при преобразовании.
+ *
+ * @param begin Указатель на начало данных UTF-8.
+ * @param end Указатель на конец данных UTF-8.
+ *
+ * @return Количество 16-битных элементов.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c begin является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+ae_usize_t
+ae_utf8_to_utf16_length(const ae_char_t *begin, const ae_char_t *end);
+
+/**
+ * @brief Вычисляет количество элементов UTF-32, необходимое для записи данных UTF-8.
+ *
+ * Результат равен количеству символов в данных.
+ * Данные не проверяются (см. `ae_utf8_to_utf16_length`).
+ *
+ * @param begin Указатель на начало данных UTF-8.
+ * @param end Указатель на конец данных UTF-8.
+ *
+ * @return Количество 32-битных элементов.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c begin является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+ae_usize_t
+ae_utf8_to_utf32_length(const ae_char_t *begin, const ae_char_t *end);
+
+/**
+ * @brief Вычисляет количество байт UTF-8, необходимое для записи данных UTF-16.
+ *
+ * Данные не проверяются (см. `ae_utf8_to_utf16_length`).
+ *
+ * @param begin Указатель на начало данных UTF-16.
+ * @param end Указатель на конец данных UTF-16.
+ *
+ * @return Количество байт.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c begin является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+ae_usize_t
+ae_utf16_to_utf8_length(const ae_u16_t *begin, const ae_u16_t *end);
+
+/**
+ * @brief Вычисляет количество байт UTF-8, необходимое для записи данных UTF-32.
+ *
+ * Данные не проверяются (см. `ae_utf8_to_utf16_length`).
+ *
+ * @param begin Указатель на начало данных UTF-32.
+ * @param end Указатель на конец данных UTF-32.
+ *
+ * @return Количество байт.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c begin является NULL.
+ */
+AE_ATTRIBUTE(SYMBOL)
+ae_usize_t
+ae_utf32_to_utf8_length(const ae_u32_t *begin, const ae_u32_t *end);
+
+/**
+ * @brief Преобразует данные UTF-8 в UTF-16.
+ *
+ * Символы вне базовой плоскости записываются суррогатными парами.
+ * При ошибке содержимое целевого буфера не определено.
+ *
+ * @param dst Указатель на целевой буфер.
+ * @param dst_end Указатель на конец целевого буфера.
+ * @param src Указатель на начало данных UTF-8.
+ * @param src_end Указатель на конец данных UTF-8.
+ *
+ * @return Указатель на конец записанных данных в целевом буфере.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c dst или @c src является NULL.
+ * @throw AE_RUNTIME_ERROR_INVALID_ENCODING
+ *        Если данные не являются корректным UTF-8.
+ * @throw AE_RUNTIME_ERROR_OUT_OF_RANGE
+ *        Если результат не помещается в целевой буфер
+ *        (необходимый размер возвращает `ae_utf8_to_utf16_length`).
+ */
+AE_ATTRIBUTE(SYMBOL)
+ae_u16_t *
+ae_utf8_to_utf16(ae_u16_t        *dst,
+                 const ae_u16_t  *dst_end,
+                 const ae_char_t *src,
+                 const ae_char_t *src_end);
+
+/**
+ * @brief Преобразует данные UTF-8 в UTF-32.
+ *
+ * @param dst Указатель на целевой буфер.
+ * @param dst_end Указатель на конец целевого буфера.
+ * @param src Указатель на начало данных UTF-8.
+ * @param src_end Указатель на конец данных UTF-8.
+ *
+ * @return Указатель на конец записанных данных в целевом буфере.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c dst или @c src является NULL.
+ * @throw AE_RUNTIME_ERROR_INVALID_ENCODING
+ *        Если данные не являются корректным UTF-8.
+ * @throw AE_RUNTIME_ERROR_OUT_OF_RANGE
+ *        Если результат не помещается в целевой буфер.
+ *
+ * @see ae_utf8_to_utf16
+ */
+AE_ATTRIBUTE(SYMBOL)
+ae_u32_t *
+ae_utf8_to_utf32(ae_u32_t        *dst,
+                 const ae_u32_t  *dst_end,
+                 const ae_char_t *src,
+                 const ae_char_t *src_end);
+
+/**
+ * @brief Преобразует данные UTF-16 в UTF-8.
+ *
+ * @param dst Указатель на целевой буфер.
+ * @param dst_end Указатель на конец целевого буфера.
+ * @param src Указатель на начало данных UTF-16.
+ * @param src_end Указатель на конец данных UTF-16.
+ *
+ * @return Указатель на конец записанных данных в целевом буфере.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c dst или @c src является NULL.
+ * @throw AE_RUNTIME_ERROR_INVALID_ENCODING
+ *        Если данные содержат непарный суррогат.
+ * @throw AE_RUNTIME_ERROR_OUT_OF_RANGE
+ *        Если результат не помещается в целевой буфер
+ *        (необходимый размер возвращает `ae_utf16_to_utf8_length`).
+ */
+AE_ATTRIBUTE(SYMBOL)
+ae_char_t *
+ae_utf16_to_utf8(ae_char_t       *dst,
+                 const ae_char_t *dst_end,
+                 const ae_u16_t  *src,
+                 const ae_u16_t  *src_end);
+
+/**
+ * @brief Преобразует данные UTF-32 в UTF-8.
+ *
+ * @param dst Указатель на целевой буфер.
+ * @param dst_end Указатель на конец целевого буфера.
+ * @param src Указатель на начало данных UTF-32.
+ * @param src_end Указатель на конец данных UTF-32.
+ *
+ * @return Указатель на конец записанных данных в целевом буфере.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c dst или @c src является NULL.
+ * @throw AE_RUNTIME_ERROR_INVALID_ENCODING
+ *        Если данные содержат суррогат или значение больше `U+10FFFF`.
+ * @throw AE_RUNTIME_ERROR_OUT_OF_RANGE
+ *        Если результат не помещается в целевой буфер.
+ */
+AE_ATTRIBUTE(SYMBOL)
+ae_char_t *
+ae_utf32_to_utf8(ae_char_t       *dst,
+                 const ae_char_t *dst_end,
+                 const ae_u32_t  *src,
+                 const ae_u32_t  *src_end);
+
+/**
+ * @brief Преобразует данные UTF-8 в UTF-16 и дописывает их в динамический блок.
+ *
+ * Блок при необходимости расширяется. При ошибке количество элементов
+ * блока не изменяется, а его емкость может увеличиться.
+ *
+ * @param self Указатель на динамический блок с размером элемента 2 байта.
+ * @param src Указатель на начало данных UTF-8.
+ * @param src_end Указатель на конец данных UTF-8.
+ *
+ * @return true, если данные преобразованы и дописаны.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c self или @c src является NULL.
+ * @throw AE_RUNTIME_ERROR_DIFFERENT_ELEMENT_SIZE
+ *        Если размер элемента блока не равен размеру элемента UTF-16.
+ * @throw AE_RUNTIME_ERROR_INVALID_ENCODING
+ *        Если данные не являются корректным UTF-8.
+ *
+ * @see ae_utf8_to_utf16
+ * @see ae_dynamic_block_reserve
+ */
+AE_ATTRIBUTE(SYMBOL)
+bool
+ae_utf8_to_utf16_dynamic_block(ae_dynamic_block_t *self,
+                               const ae_char_t    *src,
+                               const ae_char_t    *src_end);
+
+/**
+ * @brief Преобразует данные UTF-8 в UTF-32 и дописывает их в динамический блок.
+ *
+ * @param self Указатель на динамический блок с размером элемента 4 байта.
+ * @param src Указатель на начало данных UTF-8.
+ * @param src_end Указатель на конец данных UTF-8.
+ *
+ * @return true, если данные преобразованы и дописаны.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c self или @c src является NULL.
+ * @throw AE_RUNTIME_ERROR_DIFFERENT_ELEMENT_SIZE
+ *        Если размер элемента блока не равен размеру элемента UTF-32.
+ * @throw AE_RUNTIME_ERROR_INVALID_ENCODING
+ *        Если данные не являются корректным UTF-8.
+ *
+ * @see ae_utf8_to_utf16_dynamic_block
+ */
+AE_ATTRIBUTE(SYMBOL)
+bool
+ae_utf8_to_utf32_dynamic_block(ae_dynamic_block_t *self,
+                               const ae_char_t    *src,
+                               const ae_char_t    *src_end);
+
+/**
+ * @brief Преобразует данные UTF-16 в UTF-8 и дописывает их в динамический блок.
+ *
+ * @param self Указатель на динамический блок с размером элемента 1 байт.
+ * @param src Указатель на начало данных UTF-16.
+ * @param src_end Указатель на конец данных UTF-16.
+ *
+ * @return true, если данные преобразованы и дописаны.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c self или @c src является NULL.
+ * @throw AE_RUNTIME_ERROR_DIFFERENT_ELEMENT_SIZE
+ *        Если размер элемента блока не равен 1.
+ * @throw AE_RUNTIME_ERROR_INVALID_ENCODING
+ *        Если данные содержат непарный суррогат.
+ *
+ * @see ae_utf8_to_utf16_dynamic_block
+ */
+AE_ATTRIBUTE(SYMBOL)
+bool
+ae_utf16_to_utf8_dynamic_block(ae_dynamic_block_t *self,
+                               const ae_u16_t     *src,
+                               const ae_u16_t     *src_end);
+
+/**
+ * @brief Преобразует данные UTF-32 в UTF-8 и дописывает их в динамический блок.
+ *
+ * @param self Указатель на динамический блок с размером элемента 1 байт.
+ * @param src Указатель на начало данных UTF-32.
+ * @param src_end Указатель на конец данных UTF-32.
+ *
+ * @return true, если данные преобразованы и дописаны.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c self или @c src является NULL.
+ * @throw AE_RUNTIME_ERROR_DIFFERENT_ELEMENT_SIZE
+ *        Если размер элемента блока не равен 1.
+ * @throw AE_RUNTIME_ERROR_INVALID_ENCODING
+ *        Если данные содержат суррогат или значение больше `U+10FFFF`.
+ *
+ * @see ae_utf8_to_utf16_dynamic_block
+ */
+AE_ATTRIBUTE(SYMBOL)
+bool
+ae_utf32_to_utf8_dynamic_block(ae_dynamic_block_t *self,
+                               const ae_u32_t     *src,
+                               const ae_u32_t     *src_end);
+
+/**
+ * @brief Вычисляет количество широких символов, необходимое для записи данных UTF-8.
+ *
+ * Широкие строки хранятся в UTF-16, если `ae_wchar_t` занимает 2 байта,
+ * и в UTF-32 в противном случае.
+ *
+ * @param begin Указатель на начало данных UTF-8.
+ * @param end Указатель на конец данных UTF-8.
+ *
+ * @return Количество элементов `ae_wchar_t`.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c begin является NULL.
+ *
+ * @see ae_utf8_to_utf16_length
+ * @see ae_utf8_to_utf32_length
+ */
+AE_ATTRIBUTE(SYMBOL)
+ae_usize_t
+ae_utf8_to_wstr_length(const ae_char_t *begin, const ae_char_t *end);
+
+/**
+ * @brief Вычисляет количество байт UTF-8, необходимое для записи широкой строки.
+ *
+ * @param begin Указатель на начало широкой строки.
+ * @param end Указатель на конец широкой строки.
+ *
+ * @return Количество байт.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c begin является NULL.
+ *
+ * @see ae_utf8_to_wstr_length
+ */
+AE_ATTRIBUTE(SYMBOL)
+ae_usize_t
+ae_wstr_to_utf8_length(const ae_wchar_t *begin, const ae_wchar_t *end);
+
+/**
+ * @brief Преобразует данные UTF-8 в широкую строку.
+ *
+ * @param dst Указатель на целевой буфер.
+ * @param dst_end Указатель на конец целевого буфера.
+ * @param src Указатель на начало данных UTF-8.
+ * @param src_end Указатель на конец данных UTF-8.
+ *
+ * @return Указатель на конец записанных данных в целевом буфере.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c dst или @c src является NULL.
+ * @throw AE_RUNTIME_ERROR_INVALID_ENCODING
+ *        Если данные не являются корректным UTF-8.
+ * @throw AE_RUNTIME_ERROR_OUT_OF_RANGE
+ *        Если результат не помещается в целевой буфер.
+ *
+ * @see ae_utf8_to_wstr_length
+ */
+AE_ATTRIBUTE(SYMBOL)
+ae_wchar_t *
+ae_utf8_to_wstr(ae_wchar_t       *dst,
+                const ae_wchar_t *dst_end,
+                const ae_char_t  *src,
+                const ae_char_t  *src_end);
+
+/**
+ * @brief Преобразует широкую строку в UTF-8.
+ *
+ * @param dst Указатель на целевой буфер.
+ * @param dst_end Указатель на конец целевого буфера.
+ * @param src Указатель на начало широкой строки.
+ * @param src_end Указатель на конец широкой строки.
+ *
+ * @return Указатель на конец записанных данных в целевом буфере.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c dst или @c src является NULL.
+ * @throw AE_RUNTIME_ERROR_INVALID_ENCODING
+ *        Если строка содержит недопустимый символ.
+ * @throw AE_RUNTIME_ERROR_OUT_OF_RANGE
+ *        Если результат не помещается в целевой буфер.
+ *
+ * @see ae_wstr_to_utf8_length
+ */
+AE_ATTRIBUTE(SYMBOL)
+ae_char_t *
+ae_wstr_to_utf8(ae_char_t        *dst,
+                const ae_char_t  *dst_end,
+                const ae_wchar_t *src,
+                const ae_wchar_t *src_end);
+
+/**
+ * @brief Преобразует данные UTF-8 в широкую строку
+ *        и дописывает ее в динамический блок.
+ *
+ * @param self Указатель на динамический блок с размером элемента `sizeof(ae_wchar_t)`.
+ * @param src Указатель на начало данных UTF-8.
+ * @param src_end Указатель на конец данных UTF-8.
+ *
+ * @return true, если данные преобразованы и дописаны.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c self или @c src является NULL.
+ * @throw AE_RUNTIME_ERROR_DIFFERENT_ELEMENT_SIZE
+ *        Если размер элемента блока не равен `sizeof(ae_wchar_t)`.
+ * @throw AE_RUNTIME_ERROR_INVALID_ENCODING
+ *        Если данные не являются корректным UTF-8.
+ *
+ * @see ae_utf8_to_utf16_dynamic_block
+ */
+AE_ATTRIBUTE(SYMBOL)
+bool
+ae_utf8_to_wstr_dynamic_block(ae_dynamic_block_t *self,
+                              const ae_char_t    *src,
+                              const ae_char_t    *src_end);
+
+/**
+ * @brief Преобразует широкую строку в UTF-8 и дописывает ее в динамический блок.
+ *
+ * @param self Указатель на динамический блок с размером элемента 1 байт.
+ * @param src Указатель на начало широкой строки.
+ * @param src_end Указатель на конец широкой строки.
+ *
+ * @return true, если строка преобразована и дописана.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c self или @c src является NULL.
+ * @throw AE_RUNTIME_ERROR_DIFFERENT_ELEMENT_SIZE
+ *        Если размер элемента блока не равен 1.
+ * @throw AE_RUNTIME_ERROR_INVALID_ENCODING
+ *        Если строка содержит недопустимый символ.
+ *
+ * @see ae_utf8_to_utf16_dynamic_block
+ */
+AE_ATTRIBUTE(SYMBOL)
+bool
+ae_wstr_to_utf8_dynamic_block(ae_dynamic_block_t *self,
+                              const ae_wchar_t   *src,
+                              const ae_wchar_t   *src_end);
+
+AE_COMPILER(EXTERN_C_END)
+
+#endif // AE_UTF_H
@@ -0,0 +1,93 @@
+/**
+ * @file worker_pool.h
+ * @brief Внутренний пул рабочих потоков для параллельной обработки больших блоков.
+ *
+ * Данный файл содержит функции для выполнения набора независимых задач
+ * несколькими потоками. Задачи нумеруются от 0 и раздаются участникам
+ * строго по возрастанию номера; вызывающий поток также выполняет задачи,
+ * а функция `ae_worker_pool_run` возвращает управление только после
+ * завершения всех выданных задач.
+ *
+ * Пул создается при первом использовании и завершается при выгрузке библиотеки.
+ * По умолчанию число участников равно числу логических процессоров
+ * (но не больше `AE_WORKER_POOL_MAX_SIZE`). Если библиотека собрана без опции
+ * `AE_LIBRARY_OPTION_WORKER_POOL`, все задачи выполняются вызывающим потоком.
+ *
+ * @see ae_worker_pool_run
+ * @see ae_worker_pool_set_size
+ * @see ae_worker_pool_get_size
+ */
+
+#ifndef AE_WORKER_POOL_H
+#define AE_WORKER_POOL_H
+
+#include "attribute.h"
+#include "size.h"
+#include "bool.h"
+
+/**
+ * @brief Функция задачи пула.
+ *
+ * @param context Пользовательский контекст, переданный в `ae_worker_pool_run`.
+ * @param index Номер задачи.
+ *
+ * @return `true` для продолжения или `false`, чтобы задачи
+ *         с большими номерами больше не выдавались.
+ */
+typedef bool (*ae_worker_pool_task_t)(void *context, ae_usize_t index);
+
+AE_COMPILER(EXTERN_C_BEGIN)
+
+/**
+ * @brief Выполняет задачи с номерами от 0 до @c count - 1 потоками пула.
+ *
+ * Задачи выдаются по возрастанию номера. Если задача вернула `false`,
+ * задачи с большими номерами, которые еще не выданы, не выполняются,
+ * а все уже выданные задачи (в том числе с меньшими номерами) завершаются.
+ *
+ * Одновременные вызовы из разных потоков выполняются по очереди.
+ *
+ * @note Вызов из функции задачи не ожидает пул, а выполняет все свои задачи
+ *       в потоке, который его сделал.
+ *
+ * @param task Функция задачи.
+ * @param context Контекст, передаваемый в функцию задачи.
+ * @param count Количество задач.
+ *
+ * @throw AE_RUNTIME_ERROR_NULL_POINTER
+ *        Если @c task является NULL.
+ *
+ * @warning Функция задачи вызывается из других потоков и не должна
+ *          выбрасывать исключения.
+ */
+AE_ATTRIBUTE(SYMBOL)
+void
+ae_worker_pool_run(ae_worker_pool_task_t task, void *context, ae_usize_t count);
+
+/**
+ * @brief Устанавливает число участников пула (рабочих потоков и вызывающего потока).
+ *
+ * Уже запущенные рабочие потоки завершаются, а новые создаются
+ * при следующем вызове `ae_worker_pool_run`.
+ *
+ * @param size Число участников; значение 0 восстанавливает число по умолчанию.
+ *             Значение ограничивается `AE_WORKER_POOL_MAX_SIZE`.
+ *
+ * @note Функция не должна вызываться одновременно с `ae_worker_pool_run`.
+ */
+AE_ATTRIBUTE(SYMBOL)
+void
+ae_worker_pool_set_size(ae_usize_t size);
+
+/**
+ * @brief Возвращает число участников пула (рабочих потоков и вызывающего потока).
+ *
+ * @return Число участников; 1, если задачи выполняются только вызывающим потоком.
+ */
+AE_ATTRIBUTE(SYMBOL)
+ae_usize_t
+ae_worker_pool_get_size();
+
+AE_COMPILER(EXTERN_C_END)
+
+#endif // AE_WORKER_POOL_H
@@ -32,7 +32,7 @@ ae_aligned_block_exchange(void *self, void *other)
 void
 ae_aligned_block_resize(void *self, ae_usize_t number_of_elements)
 {
-    ae_runtime_assert(ae_allocated_block_is_max_size_exceeds(self, number_of_elements),
+    ae_runtime_assert(!ae_allocated_block_is_max_size_exceeds(self, number_of_elements),
                       AE_RUNTIME_ERROR_EXCEEDS_MAX_SIZE);
 
     const ae_usize_t element_size   = ae_memory_block_get_element_size(self);
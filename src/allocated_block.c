@@ -41,7 +41,7 @@ ae_allocated_block_is_max_size_exceeds(const void *self, ae_usize_t number_of_el
 void
 ae_allocated_block_resize(void *self, ae_usize_t number_of_elements)
 {
-    ae_runtime_assert(ae_allocated_block_is_max_size_exceeds(self, number_of_elements),
+    ae_runtime_assert(!ae_allocated_block_is_max_size_exceeds(self, number_of_elements),
                       AE_RUNTIME_ERROR_EXCEEDS_MAX_SIZE);
 
     const ae_usize_t element_size  = ae_memory_block_get_element_size(self);
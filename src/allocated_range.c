@@ -10,7 +10,8 @@ ae_allocated_range_clear(void *self)
 {
     ae_runtime_try
     {
-        ae_runtime_allocator_free(ae_memory_range_get_begin(self));
+        ae_runtime_allocator_free_sized(ae_memory_range_get_begin(self),
+                                        ae_memory_range_size(self));
         ae_memory_range_clear(self);
         ae_runtime_try_return();
     }
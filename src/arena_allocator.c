@@ -0,0 +1,297 @@
+#include <ae/arena_allocator.h>
+/* Дополнительные модули */
+#include <ae/memory_allocator_initializer.h>
+#include <ae/runtime_error_code.h>
+#include <ae/runtime_return_if.h>
+#include <ae/runtime_assert.h>
+#include <ae/addr_traits.h>
+#include <ae/ptr_traits.h>
+#include <ae/str_raw.h>
+#include <ae/nullptr.h>
+
+#include <stddef.h>
+
+/**
+ * @brief Выравнивание блоков, выделяемых без явного выравнивания (как у `malloc`).
+ */
+#define AE_ARENA_ALLOCATOR_DEFAULT_ALIGNMENT _Alignof(max_align_t)
+
+/**
+ * @brief Заголовок фрагмента арены, расположенный в его начале.
+ */
+typedef struct ae_arena_allocator_chunk
+{
+    /**
+     * @brief Предыдущий фрагмент арены.
+     */
+    struct ae_arena_allocator_chunk *prev;
+
+    /**
+     * @brief Полный размер фрагмента в байтах, включая заголовок.
+     */
+    ae_usize_t size;
+} ae_arena_allocator_chunk_t;
+
+/**
+ * @brief Размер заголовка фрагмента, кратный выравниванию по умолчанию.
+ */
+#define AE_ARENA_ALLOCATOR_CHUNK_HEADER_SIZE                                                       \
+    ((sizeof(ae_arena_allocator_chunk_t) + AE_ARENA_ALLOCATOR_DEFAULT_ALIGNMENT - 1) &             \
+     ~(AE_ARENA_ALLOCATOR_DEFAULT_ALIGNMENT - 1))
+
+/**
+ * @brief Возвращает начало области данных фрагмента.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN void *
+ae_arena_allocator_chunk_begin(ae_arena_allocator_chunk_t *chunk)
+{
+    return ae_ptr_add_offset_unsafe(void, chunk, AE_ARENA_ALLOCATOR_CHUNK_HEADER_SIZE);
+}
+
+/**
+ * @brief Возвращает конец фрагмента.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN void *
+ae_arena_allocator_chunk_end(ae_arena_allocator_chunk_t *chunk)
+{
+    return ae_ptr_add_offset_unsafe(void, chunk, chunk->size);
+}
+
+/**
+ * @brief Возвращает фрагмент родительскому аллокатору и возвращает предыдущий фрагмент.
+ */
+static ae_arena_allocator_chunk_t *
+ae_arena_allocator_release_chunk(ae_arena_allocator_t *self, ae_arena_allocator_chunk_t *chunk)
+{
+    ae_arena_allocator_chunk_t *prev = chunk->prev;
+    ae_memory_allocator_free_sized(self->parent, chunk, chunk->size);
+    return prev;
+}
+
+/**
+ * @brief Запрашивает у родительского аллокатора фрагмент,
+ *        вмещающий блок размером @c size с выравниванием @c alignment.
+ *
+ * @return true, если фрагмент получен и стал текущим.
+ */
+static bool
+ae_arena_allocator_grow(ae_arena_allocator_t *self, ae_usize_t size, ae_usize_t alignment)
+{
+    const ae_usize_t overhead = AE_ARENA_ALLOCATOR_CHUNK_HEADER_SIZE + alignment - 1;
+    ae_runtime_return_if(size > AE_USIZE_T_MAX - overhead, false);
+
+    // Фрагменты растут геометрически от текущего, чтобы их количество оставалось
+    // логарифмическим; после освобождения фрагментов рост начинается заново.
+    ae_usize_t next = self->chunk_size;
+
+    if (self->chunk)
+    {
+        const ae_usize_t current = self->chunk->size;
+        next                     = (current <= AE_USIZE_T_MAX / 2) ? current * 2 : current;
+    }
+
+    const ae_usize_t required = size + overhead;
+    const ae_usize_t bytes    = (required > next) ? required : next;
+
+    ae_arena_allocator_chunk_t *chunk = ae_memory_allocator_alloc(self->parent, bytes);
+    ae_runtime_return_if_not(chunk, false);
+
+    chunk->prev = self->chunk;
+    chunk->size = bytes;
+
+    self->chunk = chunk;
+    self->ptr   = ae_arena_allocator_chunk_begin(chunk);
+    self->end   = ae_arena_allocator_chunk_end(chunk);
+    return true;
+}
+
+/**
+ * @brief Выделяет блок смещением указателя, при необходимости запрашивая новый фрагмент.
+ */
+static void *
+ae_arena_allocator_bump(ae_arena_allocator_t *self, ae_usize_t size, ae_usize_t alignment)
+{
+    const ae_uaddr_t end  = ae_ptr_to_addr(self->end);
+    ae_uaddr_t       addr = (ae_ptr_to_addr(self->ptr) + alignment - 1) & ~(alignment - 1);
+
+    if (!self->chunk || addr > end || size > end - addr)
+    {
+        ae_runtime_return_if_not(ae_arena_allocator_grow(self, size, alignment), nullptr);
+        addr = (ae_ptr_to_addr(self->ptr) + alignment - 1) & ~(alignment - 1);
+    }
+
+    self->last = ae_addr_to_ptr(void, addr);
+    self->ptr  = ae_addr_to_ptr(void, addr + size);
+    return self->last;
+}
+
+/**
+ * @brief Изменяет размер последнего выделенного блока на месте.
+ */
+static bool
+ae_arena_allocator_expand(void *context, void *ptr, ae_usize_t old_size, ae_usize_t new_size)
+{
+    ae_arena_allocator_t *self = context;
+
+    ae_runtime_return_if(ptr != self->last || ae_ptr_to_addr_diff(self->ptr, ptr) != old_size,
+                         false);
+    ae_runtime_return_if(new_size > ae_ptr_to_addr_diff(self->end, ptr), false);
+
+    self->ptr = ae_ptr_add_offset_unsafe(void, ptr, new_size);
+    return true;
+}
+
+/**
+ * @brief Функция выделения памяти интерфейса арены.
+ */
+static void *
+ae_arena_allocator_alloc(void *context, ae_usize_t size)
+{
+    return ae_arena_allocator_bump(context, size, AE_ARENA_ALLOCATOR_DEFAULT_ALIGNMENT);
+}
+
+/**
+ * @brief Функция освобождения памяти интерфейса арены; память возвращается сбросом арены.
+ */
+static void
+ae_arena_allocator_free(void *context, void *ptr)
+{
+    (void)context;
+    (void)ptr;
+}
+
+/**
+ * @brief Функция освобождения памяти известного размера: возвращает в арену
+ *        последний выделенный блок, остальные блоки освобождаются сбросом арены.
+ */
+static void
+ae_arena_allocator_free_sized(void *context, void *ptr, ae_usize_t size)
+{
+    ae_arena_allocator_t *self = context;
+
+    if (ptr == self->last && ae_ptr_to_addr_diff(self->ptr, ptr) == size)
+    {
+        self->ptr  = ptr;
+        self->last = nullptr;
+    }
+}
+
+/**
+ * @brief Функция выделения выровненной памяти интерфейса арены.
+ */
+static void *
+ae_arena_allocator_align_alloc(void *context, ae_usize_t size, ae_usize_t alignment)
+{
+    if (alignment < AE_ARENA_ALLOCATOR_DEFAULT_ALIGNMENT)
+    {
+        alignment = AE_ARENA_ALLOCATOR_DEFAULT_ALIGNMENT;
+    }
+    return ae_arena_allocator_bump(context, size, alignment);
+}
+
+/**
+ * @brief Функция изменения размера выровненного блока: последний блок изменяется
+ *        на месте, остальные копируются в новый блок арены.
+ */
+static void *
+ae_arena_allocator_align_realloc(void      *context,
+                                 void      *ptr,
+                                 ae_usize_t old_size,
+                                 ae_usize_t new_size,
+                                 ae_usize_t alignment)
+{
+    ae_runtime_return_if(ae_arena_allocator_expand(context, ptr, old_size, new_size), ptr);
+
+    void *new_ptr = ae_arena_allocator_align_alloc(context, new_size, alignment);
+
+    if (new_ptr)
+    {
+        ae_str_raw_copy(new_ptr, new_size, ptr, old_size);
+    }
+    return new_ptr;
+}
+
+void
+ae_arena_allocator_init(ae_arena_allocator_t        *self,
+                        const ae_memory_allocator_t *parent,
+                        ae_usize_t                   chunk_size)
+{
+    ae_runtime_assert(self && parent, AE_RUNTIME_ERROR_NULL_POINTER, );
+
+    const ae_memory_allocator_t allocator =
+        ae_memory_allocator_initializer(ae_arena_allocator_alloc,
+                                        ae_arena_allocator_free,
+                                        self,
+                                        nullptr,
+                                        ae_arena_allocator_expand,
+                                        ae_arena_allocator_align_alloc,
+                                        ae_arena_allocator_free,
+                                        ae_arena_allocator_align_realloc,
+                                        ae_arena_allocator_free_sized);
+
+    self->allocator  = allocator;
+    self->parent     = parent;
+    self->chunk      = nullptr;
+    self->ptr        = nullptr;
+    self->end        = nullptr;
+    self->last       = nullptr;
+    self->chunk_size = (chunk_size != 0) ? chunk_size : AE_ARENA_ALLOCATOR_CHUNK_SIZE;
+}
+
+const ae_memory_allocator_t *
+ae_arena_allocator_get_allocator(const ae_arena_allocator_t *self)
+{
+    ae_runtime_assert(self, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+    return &self->allocator;
+}
+
+ae_arena_allocator_marker_t
+ae_arena_allocator_mark(const ae_arena_allocator_t *self)
+{
+    ae_arena_allocator_marker_t marker = {nullptr, nullptr};
+    ae_runtime_assert(self, AE_RUNTIME_ERROR_NULL_POINTER, marker);
+
+    marker.chunk = self->chunk;
+    marker.ptr   = self->ptr;
+    return marker;
+}
+
+void
+ae_arena_allocator_rewind(ae_arena_allocator_t *self, ae_arena_allocator_marker_t marker)
+{
+    ae_runtime_assert(self, AE_RUNTIME_ERROR_NULL_POINTER, );
+
+    while (self->chunk != marker.chunk)
+    {
+        self->chunk = ae_arena_allocator_release_chunk(self, self->chunk);
+    }
+
+    self->ptr  = marker.ptr;
+    self->end  = self->chunk ? ae_arena_allocator_chunk_end(self->chunk) : nullptr;
+    self->last = nullptr;
+}
+
+void
+ae_arena_allocator_reset(ae_arena_allocator_t *self)
+{
+    ae_runtime_assert(self, AE_RUNTIME_ERROR_NULL_POINTER, );
+    ae_runtime_return_if_not(self->chunk);
+
+    ae_arena_allocator_chunk_t *prev = self->chunk->prev;
+
+    while (prev)
+    {
+        prev = ae_arena_allocator_release_chunk(self, prev);
+    }
+
+    self->chunk->prev = nullptr;
+    self->ptr         = ae_arena_allocator_chunk_begin(self->chunk);
+    self->last        = nullptr;
+}
+
+void
+ae_arena_allocator_clear(ae_arena_allocator_t *self)
+{
+    ae_arena_allocator_marker_t marker = {nullptr, nullptr};
+    ae_arena_allocator_rewind(self, marker);
+}
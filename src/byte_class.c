@@ -0,0 +1,61 @@
+#include <ae/byte_class.h>
+/* Дополнительные модули */
+#include <ae/runtime_error_code.h>
+#include <ae/runtime_assert.h>
+#include <ae/ptr_traits.h>
+#include <ae/size.h>
+
+void
+ae_byte_class_init(ae_byte_class_t *self)
+{
+    ae_runtime_assert(self, AE_RUNTIME_ERROR_NULL_POINTER, );
+
+    for (ae_usize_t i = 0; i < sizeof(self->bitmap); ++i)
+    {
+        self->bitmap[i] = 0;
+    }
+
+    for (ae_usize_t i = 0; i < sizeof(self->low); ++i)
+    {
+        self->low[i]  = 0;
+        self->high[i] = 0;
+    }
+}
+
+void
+ae_byte_class_add(ae_byte_class_t *self, ae_u8_t value)
+{
+    ae_runtime_assert(self, AE_RUNTIME_ERROR_NULL_POINTER, );
+
+    const ae_u8_t bit = (ae_u8_t)(1u << ((value >> 4) & 7));
+
+    self->bitmap[value >> 3] |= (ae_u8_t)(1u << (value & 7));
+
+    if (value & 0x80)
+    {
+        self->high[value & 15] |= bit;
+    }
+    else
+    {
+        self->low[value & 15] |= bit;
+    }
+}
+
+void
+ae_byte_class_add_range(ae_byte_class_t *self, const void *begin, const void *end)
+{
+    ae_runtime_assert(self && begin, AE_RUNTIME_ERROR_NULL_POINTER, );
+
+    const ae_u8_t *_end = ae_ptr_cast(const ae_u8_t, end);
+    for (const ae_u8_t *ptr = begin; ptr < _end; ++ptr)
+    {
+        ae_byte_class_add(self, *ptr);
+    }
+}
+
+bool
+ae_byte_class_contains(const ae_byte_class_t *self, ae_u8_t value)
+{
+    ae_runtime_assert(self, AE_RUNTIME_ERROR_NULL_POINTER, false);
+    return (self->bitmap[value >> 3] >> (value & 7)) & 1;
+}
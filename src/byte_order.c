@@ -0,0 +1,287 @@
+#include <ae/byte_order.h>
+/* Дополнительные модули */
+#include <ae/runtime_error_code.h>
+#include <ae/runtime_return_if.h>
+#include <ae/runtime_assert.h>
+#include <ae/compiler_constructor.h>
+#include <ae/cpu_feature.h>
+#include <ae/ptr_traits.h>
+#include <ae/memory_raw.h>
+#include <ae/nullptr.h>
+
+#if AE_COMPILER_ARCH_X86
+#    include <immintrin.h> // Для SSSE3, AVX2 и AVX-512
+#endif                     // AE_COMPILER_ARCH_X86
+
+/**
+ * @brief Ядро перестановки байтов в элементах размера @c width.
+ *
+ * Значение @c size кратно @c width. Указатели @c dst и @c src могут совпадать.
+ */
+typedef void(ae_byte_order_swap_kernel)(ae_u8_t       *dst,
+                                        const ae_u8_t *src,
+                                        ae_usize_t     size,
+                                        ae_usize_t     width);
+
+/**
+ * @brief Маски `pshufb`, переставляющие байты 16-байтного блока
+ *        для элементов размера 2, 4 и 8 байт.
+ */
+static const ae_u8_t m_byte_order_swap_mask[3][16] = {
+    {1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14},
+    {3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12},
+    {7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8},
+};
+
+/**
+ * @brief Возвращает маску `pshufb` для элементов размера @c width.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN const ae_u8_t *
+ae_byte_order_swap_mask(ae_usize_t width)
+{
+    return m_byte_order_swap_mask[(width == 2) ? 0 : (width == 4) ? 1 : 2];
+}
+
+/**
+ * @brief Возвращает размер диапазона, округленный вниз до кратного @c width.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_usize_t
+ae_byte_order_range_size(const void *begin, const void *end, ae_usize_t width)
+{
+    const ae_usize_t size = (end > begin) ? ae_ptr_to_addr_diff(end, begin) : 0;
+    return size - size % width;
+}
+
+static void
+ae_byte_order_swap_generic(ae_u8_t *dst, const ae_u8_t *src, ae_usize_t size, ae_usize_t width)
+{
+    for (; size != 0; dst += width, src += width, size -= width)
+    {
+        for (ae_usize_t lo = 0, hi = width - 1; lo < hi; ++lo, --hi)
+        {
+            const ae_u8_t a = src[lo];
+            const ae_u8_t b = src[hi];
+
+            dst[lo] = b;
+            dst[hi] = a;
+        }
+    }
+}
+
+/* -------------------------------------------------------------------------------------------- */
+/* Ядра SSSE3                                                                                   */
+/* -------------------------------------------------------------------------------------------- */
+
+#if AE_CPU_FEATURE_KERNEL_SSE42
+/**
+ * @brief Переставляет байты блоками по 16 байт инструкцией `pshufb`.
+ *
+ * Остаток меньше 16 байт обрабатывается универсальным ядром.
+ */
+AE_ATTRIBUTE(TARGET)("ssse3")
+static void
+ae_byte_order_swap_ssse3(ae_u8_t *dst, const ae_u8_t *src, ae_usize_t size, ae_usize_t width)
+{
+    const __m128i mask =
+        _mm_loadu_si128(ae_ptr_cast(const __m128i, ae_byte_order_swap_mask(width)));
+
+    for (; size >= 32; dst += 32, src += 32, size -= 32)
+    {
+        const __m128i xmm0 = _mm_loadu_si128(ae_ptr_cast(const __m128i, src));
+        const __m128i xmm1 = _mm_loadu_si128(ae_ptr_cast(const __m128i, (src + 16)));
+
+        _mm_storeu_si128(ae_ptr_cast(__m128i, dst), _mm_shuffle_epi8(xmm0, mask));
+        _mm_storeu_si128(ae_ptr_cast(__m128i, (dst + 16)), _mm_shuffle_epi8(xmm1, mask));
+    }
+
+    if (size >= 16)
+    {
+        const __m128i xmm0 = _mm_loadu_si128(ae_ptr_cast(const __m128i, src));
+        _mm_storeu_si128(ae_ptr_cast(__m128i, dst), _mm_shuffle_epi8(xmm0, mask));
+
+        dst += 16;
+        src += 16;
+        size -= 16;
+    }
+
+    ae_byte_order_swap_generic(dst, src, size, width);
+}
+#endif // AE_CPU_FEATURE_KERNEL_SSE42
+
+/* -------------------------------------------------------------------------------------------- */
+/* Ядра AVX2                                                                                    */
+/* -------------------------------------------------------------------------------------------- */
+
+#if AE_CPU_FEATURE_KERNEL_AVX2
+/**
+ * @brief Переставляет байты блоками по 32 байта инструкцией `vpshufb`.
+ *
+ * Маска одинакова для обеих 128-битных половин регистра, так как размер
+ * элемента делит 16. Остаток меньше 32 байт обрабатывается ядром SSSE3.
+ */
+AE_ATTRIBUTE(TARGET)("avx2")
+static void
+ae_byte_order_swap_avx2(ae_u8_t *dst, const ae_u8_t *src, ae_usize_t size, ae_usize_t width)
+{
+    const __m256i mask = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128(ae_ptr_cast(const __m128i, ae_byte_order_swap_mask(width))));
+
+    for (; size >= 64; dst += 64, src += 64, size -= 64)
+    {
+        const __m256i ymm0 = _mm256_loadu_si256(ae_ptr_cast(const __m256i, src));
+        const __m256i ymm1 = _mm256_loadu_si256(ae_ptr_cast(const __m256i, (src + 32)));
+
+        _mm256_storeu_si256(ae_ptr_cast(__m256i, dst), _mm256_shuffle_epi8(ymm0, mask));
+        _mm256_storeu_si256(ae_ptr_cast(__m256i, (dst + 32)), _mm256_shuffle_epi8(ymm1, mask));
+    }
+
+    if (size >= 32)
+    {
+        const __m256i ymm0 = _mm256_loadu_si256(ae_ptr_cast(const __m256i, src));
+        _mm256_storeu_si256(ae_ptr_cast(__m256i, dst), _mm256_shuffle_epi8(ymm0, mask));
+
+        dst += 32;
+        src += 32;
+        size -= 32;
+    }
+
+    ae_byte_order_swap_ssse3(dst, src, size, width);
+}
+#endif // AE_CPU_FEATURE_KERNEL_AVX2
+
+/* -------------------------------------------------------------------------------------------- */
+/* Ядра AVX-512                                                                                 */
+/* -------------------------------------------------------------------------------------------- */
+
+#if AE_CPU_FEATURE_KERNEL_AVX512
+/**
+ * @brief Переставляет байты блоками по 64 байта инструкцией `vpshufb`.
+ *
+ * Остаток меньше 64 байт обрабатывается маскированными загрузкой и записью;
+ * так как размер кратен @c width, в маску попадают только полные элементы.
+ */
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static void
+ae_byte_order_swap_avx512(ae_u8_t *dst, const ae_u8_t *src, ae_usize_t size, ae_usize_t width)
+{
+    const __m512i mask = _mm512_broadcast_i32x4(
+        _mm_loadu_si128(ae_ptr_cast(const __m128i, ae_byte_order_swap_mask(width))));
+
+    for (; size >= 64; dst += 64, src += 64, size -= 64)
+    {
+        const __m512i zmm0 = _mm512_loadu_si512(ae_ptr_cast(const void, src));
+        _mm512_storeu_si512(ae_ptr_cast(void, dst), _mm512_shuffle_epi8(zmm0, mask));
+    }
+
+    if (size != 0)
+    {
+        const __mmask64 tail = (~(ae_u64_t)0) >> (64 - size);
+        const __m512i   zmm0 = _mm512_maskz_loadu_epi8(tail, src);
+
+        _mm512_mask_storeu_epi8(dst, tail, _mm512_shuffle_epi8(zmm0, mask));
+    }
+}
+#endif // AE_CPU_FEATURE_KERNEL_AVX512
+
+/**
+ * @brief Ядро перестановки байтов, выбранное для текущего процессора.
+ */
+ae_byte_order_swap_kernel *m_byte_order_swap_kernel = ae_byte_order_swap_generic;
+
+void
+ae_byte_order_dispatch(ae_u32_t features)
+{
+    ae_byte_order_swap_kernel *swap = ae_byte_order_swap_generic;
+
+    features &= ae_cpu_feature_get();
+
+#if AE_CPU_FEATURE_KERNEL_SSE42
+    if (features & AE_CPU_FEATURE_SSSE3)
+    {
+        swap = ae_byte_order_swap_ssse3;
+    }
+#endif
+
+#if AE_CPU_FEATURE_KERNEL_AVX2
+    if ((features & AE_CPU_FEATURE_AVX2) && (features & AE_CPU_FEATURE_SSSE3))
+    {
+        swap = ae_byte_order_swap_avx2;
+    }
+#endif
+
+#if AE_CPU_FEATURE_KERNEL_AVX512
+    if ((features & AE_CPU_FEATURE_AVX512F) && (features & AE_CPU_FEATURE_AVX512BW))
+    {
+        swap = ae_byte_order_swap_avx512;
+    }
+#endif
+
+    m_byte_order_swap_kernel = swap;
+}
+
+/**
+ * @brief Конструктор, выбирающий ядра модуля при загрузке библиотеки.
+ */
+ae_compiler_constructor(ae_byte_order_dispatch_init)
+{
+    ae_byte_order_dispatch(AE_CPU_FEATURE_ALL);
+}
+
+void *
+ae_byte_order_swap(void *begin, const void *end, ae_usize_t width)
+{
+    return ae_byte_order_swap_copy(begin, end, begin, end, width);
+}
+
+void *
+ae_byte_order_swap_copy(void       *dst,
+                        const void *dst_end,
+                        const void *src,
+                        const void *src_end,
+                        ae_usize_t  width)
+{
+    ae_runtime_assert(dst && src, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+    ae_runtime_assert(width == 2 || width == 4 || width == 8,
+                      AE_RUNTIME_ERROR_INVALID_ARGUMENT,
+                      nullptr);
+
+    const ae_usize_t dst_size = ae_byte_order_range_size(dst, dst_end, width);
+    const ae_usize_t src_size = ae_byte_order_range_size(src, src_end, width);
+    const ae_usize_t size     = (dst_size < src_size) ? dst_size : src_size;
+
+    m_byte_order_swap_kernel(ae_ptr_cast(ae_u8_t, dst),
+                             ae_ptr_cast(const ae_u8_t, src),
+                             size,
+                             width);
+    return ae_ptr_add_offset_unsafe(void, dst, size);
+}
+
+void *
+ae_byte_order_convert_big(void *begin, const void *end, ae_usize_t width)
+{
+    return ae_byte_order_convert_big_copy(begin, end, begin, end, width);
+}
+
+void *
+ae_byte_order_convert_big_copy(void       *dst,
+                               const void *dst_end,
+                               const void *src,
+                               const void *src_end,
+                               ae_usize_t  width)
+{
+#if AE_BYTE_ORDER == AE_BYTE_ORDER_LITTLE_ENDIAN
+    return ae_byte_order_swap_copy(dst, dst_end, src, src_end, width);
+#else
+    ae_runtime_assert(dst && src, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+    ae_runtime_assert(width == 2 || width == 4 || width == 8,
+                      AE_RUNTIME_ERROR_INVALID_ARGUMENT,
+                      nullptr);
+
+    const ae_usize_t dst_size = ae_byte_order_range_size(dst, dst_end, width);
+    const ae_usize_t src_size = ae_byte_order_range_size(src, src_end, width);
+    const ae_usize_t size     = (dst_size < src_size) ? dst_size : src_size;
+
+    ae_runtime_return_if(dst == src, ae_ptr_add_offset_unsafe(void, dst, size));
+    return ae_memory_raw_copy(dst, ae_ptr_add_offset_unsafe(void, dst, size), src, src_end);
+#endif
+}
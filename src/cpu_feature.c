@@ -0,0 +1,299 @@
+#include <ae/cpu_feature.h>
+/* Дополнительные модули */
+#include <ae/compiler_type.h>
+#include <ae/array_size.h>
+#include <ae/size.h>
+
+#if AE_COMPILER_ARCH_X86
+#    if (AE_COMPILER_TYPE == AE_COMPILER_TYPE_MSVC)
+#        include <intrin.h>
+#    else
+#        include <cpuid.h>
+#    endif
+#endif // AE_COMPILER_ARCH_X86
+
+/**
+ * @brief Битовая маска возможностей процессора, определенных при загрузке библиотеки.
+ *
+ * Значение заполняется функцией `ae_cpu_feature_detect`
+ * и далее не изменяется, поэтому разделяется между всеми потоками.
+ */
+ae_u32_t m_cpu_features = AE_CPU_FEATURE_NONE;
+
+/**
+ * @brief Признак того, что возможности процессора уже определены.
+ */
+bool m_cpu_features_detected = false;
+
+/**
+ * @brief Размер кэша последнего уровня в байтах (0, если размер не определен).
+ *
+ * Значение заполняется вместе с `m_cpu_features`.
+ */
+ae_usize_t m_cpu_cache_size = 0;
+
+#if AE_COMPILER_ARCH_X86
+/**
+ * @brief Выполняет инструкцию CPUID для указанного листа и подлиста.
+ *
+ * @param leaf Номер листа (значение регистра EAX).
+ * @param subleaf Номер подлиста (значение регистра ECX).
+ * @param regs Массив для значений регистров EAX, EBX, ECX и EDX.
+ */
+static void
+ae_cpu_feature_cpuid(ae_u32_t leaf, ae_u32_t subleaf, ae_u32_t regs[4])
+{
+#    if (AE_COMPILER_TYPE == AE_COMPILER_TYPE_MSVC)
+    int info[4];
+    __cpuidex(info, (int)leaf, (int)subleaf);
+    regs[0] = (ae_u32_t)info[0];
+    regs[1] = (ae_u32_t)info[1];
+    regs[2] = (ae_u32_t)info[2];
+    regs[3] = (ae_u32_t)info[3];
+#    else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#    endif
+}
+
+/**
+ * @brief Читает регистр XCR0 с маской состояний,
+ *        которые сохраняет операционная система.
+ *
+ * @return Младшие 32 бита регистра XCR0.
+ */
+static ae_u32_t
+ae_cpu_feature_xgetbv()
+{
+#    if (AE_COMPILER_TYPE == AE_COMPILER_TYPE_MSVC)
+    return (ae_u32_t)_xgetbv(0);
+#    else
+    ae_u32_t eax, edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return eax;
+#    endif
+}
+
+/**
+ * @brief Описание бита возможности в выводе инструкции CPUID.
+ */
+typedef struct
+{
+    ae_u32_t leaf;    /**< Номер листа CPUID (1 или 7). */
+    ae_u32_t reg;     /**< Индекс регистра: 1 - EBX, 2 - ECX, 3 - EDX. */
+    ae_u32_t bit;     /**< Номер бита в регистре. */
+    ae_u32_t feature; /**< Соответствующее значение `ae_cpu_feature_t`. */
+} ae_cpu_feature_bit_t;
+
+/**
+ * @brief Таблица соответствия битов CPUID возможностям процессора.
+ *
+ * Расширения AVX и AVX-512 дополнительно фильтруются
+ * по маске состояний XCR0 в функции `ae_cpu_feature_detect`.
+ */
+static const ae_cpu_feature_bit_t m_cpu_feature_bits[] = {
+    {1, 3, 26, AE_CPU_FEATURE_SSE2},
+    {1, 2, 0, AE_CPU_FEATURE_SSE3},
+    {1, 2, 9, AE_CPU_FEATURE_SSSE3},
+    {1, 2, 19, AE_CPU_FEATURE_SSE41},
+    {1, 2, 20, AE_CPU_FEATURE_SSE42},
+    {1, 2, 23, AE_CPU_FEATURE_POPCNT},
+    {1, 2, 28, AE_CPU_FEATURE_AVX},
+    {7, 1, 3, AE_CPU_FEATURE_BMI1},
+    {7, 1, 5, AE_CPU_FEATURE_AVX2},
+    {7, 1, 8, AE_CPU_FEATURE_BMI2},
+    {7, 1, 16, AE_CPU_FEATURE_AVX512F},
+    {7, 1, 30, AE_CPU_FEATURE_AVX512BW},
+    {7, 1, 31, AE_CPU_FEATURE_AVX512VL},
+    {7, 2, 1, AE_CPU_FEATURE_AVX512VBMI},
+    {7, 2, 14, AE_CPU_FEATURE_AVX512VPOPCNTDQ},
+};
+
+/**
+ * @brief Определяет размер кэша последнего уровня по листу CPUID с описанием кэшей.
+ *
+ * Листы 4 (Intel) и 0x8000001D (AMD) имеют одинаковый формат: каждый подлист
+ * описывает один кэш, а перечисление заканчивается подлистом с типом 0.
+ *
+ * @param leaf Номер листа CPUID.
+ *
+ * @return Размер кэша данных или унифицированного кэша наибольшего уровня
+ *         в байтах или 0, если лист не содержит описаний кэшей.
+ */
+static ae_usize_t
+ae_cpu_feature_cache_size_from_leaf(ae_u32_t leaf)
+{
+    ae_usize_t size  = 0;
+    ae_u32_t   level = 0;
+
+    for (ae_u32_t subleaf = 0; subleaf < 16; ++subleaf)
+    {
+        ae_u32_t regs[4];
+        ae_cpu_feature_cpuid(leaf, subleaf, regs);
+
+        const ae_u32_t type = regs[0] & 0x1F;
+
+        if (type == 0)
+        {
+            break;
+        }
+
+        /* Кэш инструкций (тип 2) не используется при копировании данных. */
+        if (type == 2)
+        {
+            continue;
+        }
+
+        const ae_u32_t   cache_level = (regs[0] >> 5) & 0x07;
+        const ae_usize_t ways        = (regs[1] >> 22) + 1;
+        const ae_usize_t partitions  = ((regs[1] >> 12) & 0x3FF) + 1;
+        const ae_usize_t line        = (regs[1] & 0xFFF) + 1;
+        const ae_usize_t sets        = (ae_usize_t)regs[2] + 1;
+
+        if (cache_level >= level)
+        {
+            level = cache_level;
+            size  = ways * partitions * line * sets;
+        }
+    }
+    return size;
+}
+#endif // AE_COMPILER_ARCH_X86
+
+/**
+ * @brief Определяет размер кэша последнего уровня.
+ *
+ * @return Размер кэша в байтах или 0, если его не удалось определить.
+ */
+static ae_usize_t
+ae_cpu_feature_detect_cache_size()
+{
+    ae_usize_t size = 0;
+
+#if AE_COMPILER_ARCH_X86
+    ae_u32_t regs[4] = {0};
+
+    ae_cpu_feature_cpuid(0, 0, regs);
+    const ae_u32_t max_leaf = regs[0];
+
+    ae_cpu_feature_cpuid(0x80000000, 0, regs);
+    const ae_u32_t max_extended_leaf = regs[0];
+
+    if (max_leaf >= 4)
+    {
+        size = ae_cpu_feature_cache_size_from_leaf(4);
+    }
+
+    if (size == 0 && max_extended_leaf >= 0x8000001D)
+    {
+        size = ae_cpu_feature_cache_size_from_leaf(0x8000001D);
+    }
+
+    if (size == 0 && max_extended_leaf >= 0x80000006)
+    {
+        ae_cpu_feature_cpuid(0x80000006, 0, regs);
+
+        /* EDX[31:18] - размер L3 в блоках по 512 КиБ, ECX[31:16] - размер L2 в КиБ. */
+        size = (ae_usize_t)(regs[3] >> 18) * 512 * 1024;
+        if (size == 0)
+        {
+            size = (ae_usize_t)(regs[2] >> 16) * 1024;
+        }
+    }
+#endif // AE_COMPILER_ARCH_X86
+
+    return size;
+}
+
+/**
+ * @brief Определяет возможности процессора.
+ *
+ * @return Битовая маска значений `ae_cpu_feature_t`.
+ */
+static ae_u32_t
+ae_cpu_feature_detect()
+{
+    ae_u32_t features = AE_CPU_FEATURE_NONE;
+
+#if AE_COMPILER_ARCH_X86
+    ae_u32_t leaf0[4] = {0};
+    ae_u32_t leaf1[4] = {0};
+    ae_u32_t leaf7[4] = {0};
+
+    ae_cpu_feature_cpuid(0, 0, leaf0);
+
+    if (leaf0[0] >= 1)
+    {
+        ae_cpu_feature_cpuid(1, 0, leaf1);
+    }
+
+    if (leaf0[0] >= 7)
+    {
+        ae_cpu_feature_cpuid(7, 0, leaf7);
+    }
+
+    for (ae_usize_t i = 0; i < ae_array_size(m_cpu_feature_bits); ++i)
+    {
+        const ae_cpu_feature_bit_t *entry = &m_cpu_feature_bits[i];
+        const ae_u32_t             *regs  = (entry->leaf == 1) ? leaf1 : leaf7;
+
+        if (regs[entry->reg] & (1u << entry->bit))
+        {
+            features |= entry->feature;
+        }
+    }
+
+    /* Регистры YMM/ZMM можно использовать, только если ОС сохраняет их состояние. */
+    const bool     has_osxsave = (leaf1[2] & (1u << 27)) != 0;
+    const ae_u32_t xcr0        = has_osxsave ? ae_cpu_feature_xgetbv() : 0;
+
+    if ((xcr0 & 0x06) != 0x06)
+    {
+        features &= ~(ae_u32_t)(AE_CPU_FEATURE_AVX | AE_CPU_FEATURE_AVX2);
+    }
+
+    if ((xcr0 & 0xE6) != 0xE6 || !(features & AE_CPU_FEATURE_AVX512F))
+    {
+        features &= ~(ae_u32_t)(AE_CPU_FEATURE_AVX512F | AE_CPU_FEATURE_AVX512BW |
+                                AE_CPU_FEATURE_AVX512VL | AE_CPU_FEATURE_AVX512VBMI |
+                                AE_CPU_FEATURE_AVX512VPOPCNTDQ);
+    }
+#endif // AE_COMPILER_ARCH_X86
+
+    return features;
+}
+
+ae_u32_t
+ae_cpu_feature_get()
+{
+    if (!m_cpu_features_detected)
+    {
+        m_cpu_features          = ae_cpu_feature_detect();
+        m_cpu_cache_size        = ae_cpu_feature_detect_cache_size();
+        m_cpu_features_detected = true;
+    }
+    return m_cpu_features;
+}
+
+bool
+ae_cpu_feature_has(ae_u32_t features)
+{
+    return (ae_cpu_feature_get() & features) == features;
+}
+
+ae_usize_t
+ae_cpu_feature_cache_size()
+{
+    ae_cpu_feature_get();
+    return m_cpu_cache_size;
+}
+
+/**
+ * @brief Конструктор, определяющий возможности процессора при загрузке библиотеки.
+ *
+ * Благодаря раннему определению последующие вызовы `ae_cpu_feature_get`
+ * только читают уже заполненные переменные и не конкурируют между потоками.
+ */
+ae_compiler_constructor(ae_cpu_feature_init)
+{
+    ae_cpu_feature_get();
+}
@@ -10,6 +10,25 @@
 #include <ae/str_raw.h>
 #include <ae/nullptr.h>
 
+/**
+ * @brief Заполняет нулями байты блока `ptr` в диапазоне [`begin`, `end`),
+ *        если включена опция `AE_LIBRARY_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE`.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN void
+ae_memory_allocator_fill_zero(void *ptr, ae_usize_t begin, ae_usize_t end)
+{
+#if AE_LIBRARY_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE
+    if (begin < end)
+    {
+        ae_str_raw_set_value(ae_ptr_add_offset(ae_char_t, ptr, begin), end - begin, 0);
+    }
+#else
+    (void)ptr;
+    (void)begin;
+    (void)end;
+#endif
+}
+
 ae_memory_allocator_alloc_fn *
 ae_memory_allocator_get_alloc_fn(const void *self)
 {
@@ -24,6 +43,13 @@ ae_memory_allocator_get_dealloc_fn(const void *self)
     return ae_ptr_cast(const ae_memory_allocator_t, self)->dealloc_fn;
 }
 
+void *
+ae_memory_allocator_get_context(const void *self)
+{
+    ae_runtime_assert(self, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+    return ae_ptr_cast(const ae_memory_allocator_t, self)->context;
+}
+
 void *
 ae_memory_allocator_alloc(const void *self, ae_usize_t size)
 {
@@ -37,16 +63,14 @@ ae_memory_allocator_alloc(const void *self, ae_usize_t size)
     ae_runtime_assert(alloc_fn, AE_RUNTIME_ERROR_ALLOCATOR_FUNCTION_NOT_INITIALIZED, nullptr);
 
     // Запрашиваем выделение памяти размером size у аллокатора
-    void *ptr = alloc_fn(size);
+    void *ptr = alloc_fn(ae_memory_allocator_get_context(self), size);
 
     // Проверяем, успешно ли выделена память. Если нет, генерируем ошибку.
     ae_runtime_assert(ptr, AE_RUNTIME_ERROR_MEMORY_NOT_ALLOCATED, nullptr);
 
-#if AE_LIBRARY_OPTION_FILL_ZERO_AFTER_MEMORY_ALLOCATE
     // Если включена опция заполнения нулями после выделения памяти,
     // заполняем выделенную память нулями от указателя ptr до конца выделенной области
-    ae_str_raw_set_value(ptr, size, 0);
-#endif
+    ae_memory_allocator_fill_zero(ptr, 0, size);
 
     // Возвращаем указатель на выделенную память
     return ptr;
@@ -61,7 +85,25 @@ ae_memory_allocator_free(const void *self, void *ptr)
     ae_memory_allocator_dealloc_fn *dealloc_fn = ae_memory_allocator_get_dealloc_fn(self);
     ae_runtime_assert(dealloc_fn, AE_RUNTIME_ERROR_DEALLOCATOR_FUNCTION_NOT_INITIALIZED);
 
-    dealloc_fn(ptr);
+    dealloc_fn(ae_memory_allocator_get_context(self), ptr);
+}
+
+void
+ae_memory_allocator_free_sized(const void *self, void *ptr, ae_usize_t size)
+{
+    ae_runtime_return_if_not(ptr);
+
+    ae_runtime_assert(self, AE_RUNTIME_ERROR_NULL_POINTER);
+    const ae_memory_allocator_t *allocator = ae_ptr_cast(const ae_memory_allocator_t, self);
+
+    // Без функции освобождения с размером размер блока не нужен
+    if (allocator->sized_dealloc_fn)
+    {
+        allocator->sized_dealloc_fn(allocator->context, ptr, size);
+        return;
+    }
+
+    ae_memory_allocator_free(self, ptr);
 }
 
 void *
@@ -79,10 +121,31 @@ ae_memory_allocator_realloc(const void *self,
     // Если новый размер равен 0, освобождаем память и возвращаем nullptr
     if (new_size == 0)
     {
-        ae_memory_allocator_free(self, old_ptr);
+        ae_memory_allocator_free_sized(self, old_ptr, old_size);
         return nullptr;
     }
 
+    ae_runtime_assert(self, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+    const ae_memory_allocator_t *allocator = ae_ptr_cast(const ae_memory_allocator_t, self);
+
+    // Сначала пробуем изменить размер блока, не перемещая его
+    if (allocator->expand_fn &&
+        allocator->expand_fn(allocator->context, old_ptr, old_size, new_size))
+    {
+        ae_memory_allocator_fill_zero(old_ptr, old_size, new_size);
+        return old_ptr;
+    }
+
+    // Если аллокатор умеет изменять размер блока сам, обходимся без копирования
+    if (allocator->realloc_fn)
+    {
+        void *new_ptr = allocator->realloc_fn(allocator->context, old_ptr, old_size, new_size);
+        ae_runtime_assert(new_ptr, AE_RUNTIME_ERROR_MEMORY_NOT_ALLOCATED, nullptr);
+
+        ae_memory_allocator_fill_zero(new_ptr, old_size, new_size);
+        return new_ptr;
+    }
+
     ae_runtime_try
     {
         // Выделяем новую область памяти размером new_size
@@ -92,7 +155,7 @@ ae_memory_allocator_realloc(const void *self,
         ae_str_raw_copy(new_ptr, new_size, old_ptr, old_size);
 
         // Освобождаем старую область памяти
-        ae_memory_allocator_free(self, old_ptr);
+        ae_memory_allocator_free_sized(self, old_ptr, old_size);
 
         // Прерываем работу try блока и возвращаем новый указатель
         ae_runtime_try_return(new_ptr);
@@ -104,9 +167,24 @@ ae_memory_allocator_realloc(const void *self,
 void *
 ae_memory_allocator_align_alloc(const void *self, ae_usize_t size, ae_usize_t alignment_size)
 {
+    ae_runtime_assert(self, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+    ae_runtime_assert(size, AE_RUNTIME_ERROR_ZERO_MEMORY_SIZE, nullptr);
+
     // Проверка, является ли alignment_size степенью двойки.
     ae_runtime_assert(ae_bit_is_single(alignment_size), AE_RUNTIME_ERROR_NOT_POWER_OF_TWO, nullptr);
 
+    const ae_memory_allocator_t *allocator = ae_ptr_cast(const ae_memory_allocator_t, self);
+
+    // Если аллокатор выделяет выровненную память сам, запас под выравнивание не нужен.
+    if (allocator->align_alloc_fn && allocator->align_dealloc_fn)
+    {
+        void *ptr = allocator->align_alloc_fn(allocator->context, size, alignment_size);
+        ae_runtime_assert(ptr, AE_RUNTIME_ERROR_MEMORY_NOT_ALLOCATED, nullptr);
+
+        ae_memory_allocator_fill_zero(ptr, 0, size);
+        return ptr;
+    }
+
     // Вычисление смещения для выравнивания.
     ae_usize_t alignment_offset = sizeof(void *) + alignment_size - 1;
 
@@ -137,6 +215,16 @@ ae_memory_allocator_align_free(const void *self, void *ptr)
     // Проверка, что указатель не равен nullptr.
     ae_runtime_return_if_not(ptr);
 
+    ae_runtime_assert(self, AE_RUNTIME_ERROR_NULL_POINTER);
+    const ae_memory_allocator_t *allocator = ae_ptr_cast(const ae_memory_allocator_t, self);
+
+    // Блок, выделенный функцией align_alloc_fn, освобождается парной ей функцией.
+    if (allocator->align_alloc_fn && allocator->align_dealloc_fn)
+    {
+        allocator->align_dealloc_fn(allocator->context, ptr);
+        return;
+    }
+
     // Извлечение указателя на невыравненную память.
     void *unaligned_ptr = ((void **)ptr)[-1];
 
@@ -168,6 +256,23 @@ ae_memory_allocator_align_realloc(const void *self,
         return nullptr;
     }
 
+    ae_runtime_assert(self, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+    const ae_memory_allocator_t *allocator = ae_ptr_cast(const ae_memory_allocator_t, self);
+
+    // Блок, выделенный функцией align_alloc_fn, аллокатор может изменить сам.
+    if (allocator->align_alloc_fn && allocator->align_dealloc_fn && allocator->align_realloc_fn)
+    {
+        void *new_ptr = allocator->align_realloc_fn(allocator->context,
+                                                    old_ptr,
+                                                    old_size,
+                                                    new_size,
+                                                    alignment_size);
+        ae_runtime_assert(new_ptr, AE_RUNTIME_ERROR_MEMORY_NOT_ALLOCATED, nullptr);
+
+        ae_memory_allocator_fill_zero(new_ptr, old_size, new_size);
+        return new_ptr;
+    }
+
     ae_runtime_try
     {
         // Выделяем новую область памяти с учетом выравнивания.
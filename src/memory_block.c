@@ -2,10 +2,12 @@
 /* Дополнительные модули */
 #include <ae/memory_block_initializer.h>
 #include <ae/runtime_error_code.h>
+#include <ae/runtime_return_if.h>
 #include <ae/runtime_assert.h>
 #include <ae/runtime_throw.h>
 #include <ae/memory_range.h>
 #include <ae/runtime_try.h>
+#include <ae/memory_raw.h>
 #include <ae/ptr_traits.h>
 #include <ae/nullptr.h>
 
@@ -158,3 +160,29 @@ ae_memory_block_slice(void *self, ae_usize_t index, ae_usize_t length)
     }
     ae_runtime_raise(ae_memory_block_make_empty(element_size));
 }
+
+bool
+ae_memory_block_is_zero(const void *self)
+{
+    ae_runtime_assert(ae_memory_block_is_valid(self), AE_RUNTIME_ERROR_INVALID_MEMORY_BLOCK, false);
+
+    return ae_memory_block_find_nonzero(self) == nullptr;
+}
+
+void *
+ae_memory_block_find_nonzero(const void *self)
+{
+    ae_runtime_assert(ae_memory_block_is_valid(self),
+                      AE_RUNTIME_ERROR_INVALID_MEMORY_BLOCK,
+                      nullptr);
+
+    void       *begin = ae_memory_range_get_begin(self);
+    const void *found = ae_memory_raw_find_nonzero(begin, ae_memory_range_get_end(self));
+
+    ae_runtime_return_if(found == nullptr, nullptr);
+
+    const ae_usize_t element_size = ae_memory_block_get_element_size(self);
+    const ae_usize_t offset       = ae_ptr_to_addr_diff(found, begin);
+
+    return ae_ptr_add_offset_unsafe(void, begin, offset - offset % element_size);
+}
@@ -0,0 +1,702 @@
+#include <ae/memory_hash.h>
+/* Дополнительные модули */
+#include <ae/runtime_error_code.h>
+#include <ae/runtime_return_if.h>
+#include <ae/runtime_assert.h>
+#include <ae/compiler_bit_depth.h>
+#include <ae/compiler_constructor.h>
+#include <ae/cpu_feature.h>
+#include <ae/bit_traits.h>
+#include <ae/ptr_traits.h>
+#include <ae/nullptr.h>
+
+#if AE_CPU_FEATURE_KERNEL_SSE42
+#    include <immintrin.h> // Для SSE4.2
+#endif                     // AE_CPU_FEATURE_KERNEL_SSE42
+
+/**
+ * @brief Отраженный полином CRC32C (Кастаньоли).
+ */
+static const ae_u32_t m_memory_hash_crc32c_poly = 0x82F63B78;
+
+/**
+ * @brief Таблицы алгоритма slicing-by-8.
+ *
+ * Элемент `table[k][b]` равен CRC байта @c b, за которым следуют @c k нулевых байт,
+ * что позволяет обработать 8 байт восемью независимыми обращениями к таблицам.
+ * Таблицы заполняются конструктором `ae_memory_hash_dispatch_init`.
+ */
+ae_u32_t m_memory_hash_crc32c_table[8][256];
+
+/**
+ * @brief Ядро обновления регистра CRC32C по @c size байтам.
+ */
+typedef ae_u32_t(ae_memory_hash_crc32c_kernel)(ae_u32_t crc, const ae_u8_t *data, ae_usize_t size);
+
+/**
+ * @brief Ядро копирования @c size байт с обновлением регистра CRC32C по копируемым данным.
+ */
+typedef ae_u32_t(ae_memory_hash_crc32c_copy_kernel)(ae_u32_t       crc,
+                                                    ae_u8_t       *dst,
+                                                    const ae_u8_t *src,
+                                                    ae_usize_t     size);
+
+/**
+ * @brief Простые числа алгоритма XXH64.
+ */
+static const ae_u64_t m_memory_hash_xxh64_prime[5] = {
+    0x9E3779B185EBCA87ULL,
+    0xC2B2AE3D27D4EB4FULL,
+    0x165667B19E3779F9ULL,
+    0x85EBCA77C2B2AE63ULL,
+    0x27D4EB2F165667C5ULL,
+};
+
+/**
+ * @brief Возвращает количество байт в диапазоне или 0, если диапазон пуст.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_usize_t
+ae_memory_hash_range_size(const void *begin, const void *end)
+{
+    return (end > begin) ? ae_ptr_to_addr_diff(end, begin) : 0;
+}
+
+/**
+ * @brief Возвращает количество копируемых байт: размер меньшего из двух диапазонов.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_usize_t
+ae_memory_hash_copy_size(const void *dst, const void *dst_end, const void *src, const void *src_end)
+{
+    const ae_usize_t dst_size = ae_memory_hash_range_size(dst, dst_end);
+    const ae_usize_t src_size = ae_memory_hash_range_size(src, src_end);
+
+    return (dst_size < src_size) ? dst_size : src_size;
+}
+
+/**
+ * @brief Читает 32-битное число в порядке little-endian.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_u32_t
+ae_memory_hash_read32(const ae_u8_t *data)
+{
+    return (ae_u32_t)data[0] | ((ae_u32_t)data[1] << 8) | ((ae_u32_t)data[2] << 16) |
+           ((ae_u32_t)data[3] << 24);
+}
+
+/**
+ * @brief Читает 64-битное число в порядке little-endian.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_u64_t
+ae_memory_hash_read64(const ae_u8_t *data)
+{
+    return (ae_u64_t)ae_memory_hash_read32(data) |
+           ((ae_u64_t)ae_memory_hash_read32(data + 4) << 32);
+}
+
+/**
+ * @brief Записывает 32-битное число в порядке little-endian.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN void
+ae_memory_hash_write32(ae_u8_t *data, ae_u32_t value)
+{
+    data[0] = (ae_u8_t)value;
+    data[1] = (ae_u8_t)(value >> 8);
+    data[2] = (ae_u8_t)(value >> 16);
+    data[3] = (ae_u8_t)(value >> 24);
+}
+
+/**
+ * @brief Записывает 64-битное число в порядке little-endian.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN void
+ae_memory_hash_write64(ae_u8_t *data, ae_u64_t value)
+{
+    ae_memory_hash_write32(data, (ae_u32_t)value);
+    ae_memory_hash_write32(data + 4, (ae_u32_t)(value >> 32));
+}
+
+/* -------------------------------------------------------------------------------------------- */
+/* CRC32C                                                                                       */
+/* -------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief Обновляет регистр CRC32C по 8 байтам, заданным двумя 32-битными половинами.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_u32_t
+ae_memory_hash_crc32c_step(ae_u32_t crc, ae_u32_t lo, ae_u32_t hi)
+{
+    const ae_u32_t(*table)[256] = m_memory_hash_crc32c_table;
+
+    lo ^= crc;
+    return table[7][lo & 0xFF] ^ table[6][(lo >> 8) & 0xFF] ^ table[5][(lo >> 16) & 0xFF] ^
+           table[4][lo >> 24] ^ table[3][hi & 0xFF] ^ table[2][(hi >> 8) & 0xFF] ^
+           table[1][(hi >> 16) & 0xFF] ^ table[0][hi >> 24];
+}
+
+static ae_u32_t
+ae_memory_hash_crc32c_generic(ae_u32_t crc, const ae_u8_t *data, ae_usize_t size)
+{
+    for (; size >= 8; data += 8, size -= 8)
+    {
+        crc = ae_memory_hash_crc32c_step(crc,
+                                         ae_memory_hash_read32(data),
+                                         ae_memory_hash_read32(data + 4));
+    }
+
+    while (size--)
+    {
+        crc = m_memory_hash_crc32c_table[0][(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+static ae_u32_t
+ae_memory_hash_crc32c_copy_generic(ae_u32_t crc, ae_u8_t *dst, const ae_u8_t *src, ae_usize_t size)
+{
+    for (; size >= 8; dst += 8, src += 8, size -= 8)
+    {
+        const ae_u32_t lo = ae_memory_hash_read32(src);
+        const ae_u32_t hi = ae_memory_hash_read32(src + 4);
+
+        ae_memory_hash_write32(dst, lo);
+        ae_memory_hash_write32(dst + 4, hi);
+        crc = ae_memory_hash_crc32c_step(crc, lo, hi);
+    }
+
+    while (size--)
+    {
+        const ae_u8_t byte = *src++;
+
+        *dst++ = byte;
+        crc    = m_memory_hash_crc32c_table[0][(crc ^ byte) & 0xFF] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+#if AE_CPU_FEATURE_KERNEL_SSE42
+/**
+ * @brief Обновляет регистр CRC32C инструкцией `crc32` по 8 байт
+ *        (по 4 байта на 32-битной архитектуре).
+ *
+ * Сначала побайтно обрабатываются байты до границы 8 байт, чтобы остальные
+ * чтения были выровнены.
+ */
+AE_ATTRIBUTE(TARGET)("sse4.2")
+static ae_u32_t
+ae_memory_hash_crc32c_sse42(ae_u32_t crc, const ae_u8_t *data, ae_usize_t size)
+{
+    for (; size != 0 && (ae_ptr_to_addr(data) & 7) != 0; ++data, --size)
+    {
+        crc = _mm_crc32_u8(crc, *data);
+    }
+
+#    if AE_COMPILER_BIT_DEPTH == 64
+    ae_u64_t crc64 = crc;
+
+    for (; size >= 32; data += 32, size -= 32)
+    {
+        crc64 = _mm_crc32_u64(crc64, ae_memory_hash_read64(data));
+        crc64 = _mm_crc32_u64(crc64, ae_memory_hash_read64(data + 8));
+        crc64 = _mm_crc32_u64(crc64, ae_memory_hash_read64(data + 16));
+        crc64 = _mm_crc32_u64(crc64, ae_memory_hash_read64(data + 24));
+    }
+
+    for (; size >= 8; data += 8, size -= 8)
+    {
+        crc64 = _mm_crc32_u64(crc64, ae_memory_hash_read64(data));
+    }
+    crc = (ae_u32_t)crc64;
+#    endif // AE_COMPILER_BIT_DEPTH == 64
+
+    for (; size >= 4; data += 4, size -= 4)
+    {
+        crc = _mm_crc32_u32(crc, ae_memory_hash_read32(data));
+    }
+
+    while (size--)
+    {
+        crc = _mm_crc32_u8(crc, *data++);
+    }
+    return crc;
+}
+
+/**
+ * @brief Копирует данные и обновляет регистр CRC32C инструкцией `crc32`.
+ *
+ * На 64-битной архитектуре данные переносятся 16-байтными регистрами SSE,
+ * из которых 64-битные половины сразу передаются в `crc32`, поэтому
+ * каждый байт читается из памяти один раз.
+ */
+AE_ATTRIBUTE(TARGET)("sse4.2")
+static ae_u32_t
+ae_memory_hash_crc32c_copy_sse42(ae_u32_t crc, ae_u8_t *dst, const ae_u8_t *src, ae_usize_t size)
+{
+#    if AE_COMPILER_BIT_DEPTH == 64
+    ae_u64_t crc64 = crc;
+
+    for (; size >= 32; dst += 32, src += 32, size -= 32)
+    {
+        const __m128i a = _mm_loadu_si128(ae_ptr_cast(const __m128i, src));
+        const __m128i b = _mm_loadu_si128(ae_ptr_cast(const __m128i, (src + 16)));
+
+        _mm_storeu_si128(ae_ptr_cast(__m128i, dst), a);
+        _mm_storeu_si128(ae_ptr_cast(__m128i, (dst + 16)), b);
+
+        crc64 = _mm_crc32_u64(crc64, (ae_u64_t)_mm_cvtsi128_si64(a));
+        crc64 = _mm_crc32_u64(crc64, (ae_u64_t)_mm_extract_epi64(a, 1));
+        crc64 = _mm_crc32_u64(crc64, (ae_u64_t)_mm_cvtsi128_si64(b));
+        crc64 = _mm_crc32_u64(crc64, (ae_u64_t)_mm_extract_epi64(b, 1));
+    }
+
+    for (; size >= 8; dst += 8, src += 8, size -= 8)
+    {
+        const ae_u64_t value = ae_memory_hash_read64(src);
+
+        ae_memory_hash_write64(dst, value);
+        crc64 = _mm_crc32_u64(crc64, value);
+    }
+    crc = (ae_u32_t)crc64;
+#    endif // AE_COMPILER_BIT_DEPTH == 64
+
+    for (; size >= 4; dst += 4, src += 4, size -= 4)
+    {
+        const ae_u32_t value = ae_memory_hash_read32(src);
+
+        ae_memory_hash_write32(dst, value);
+        crc = _mm_crc32_u32(crc, value);
+    }
+
+    while (size--)
+    {
+        const ae_u8_t byte = *src++;
+
+        *dst++ = byte;
+        crc    = _mm_crc32_u8(crc, byte);
+    }
+    return crc;
+}
+#endif // AE_CPU_FEATURE_KERNEL_SSE42
+
+/**
+ * @brief Ядро CRC32C, выбранное для текущего процессора.
+ */
+ae_memory_hash_crc32c_kernel *m_memory_hash_crc32c_kernel = ae_memory_hash_crc32c_generic;
+
+/**
+ * @brief Ядро копирования с CRC32C, выбранное для текущего процессора.
+ */
+ae_memory_hash_crc32c_copy_kernel *m_memory_hash_crc32c_copy_kernel =
+    ae_memory_hash_crc32c_copy_generic;
+
+void
+ae_memory_hash_dispatch(ae_u32_t features)
+{
+    ae_memory_hash_crc32c_kernel      *crc32c      = ae_memory_hash_crc32c_generic;
+    ae_memory_hash_crc32c_copy_kernel *crc32c_copy = ae_memory_hash_crc32c_copy_generic;
+
+    features &= ae_cpu_feature_get();
+
+#if AE_CPU_FEATURE_KERNEL_SSE42
+    if (features & AE_CPU_FEATURE_SSE42)
+    {
+        crc32c      = ae_memory_hash_crc32c_sse42;
+        crc32c_copy = ae_memory_hash_crc32c_copy_sse42;
+    }
+#endif
+
+    m_memory_hash_crc32c_kernel      = crc32c;
+    m_memory_hash_crc32c_copy_kernel = crc32c_copy;
+}
+
+/**
+ * @brief Конструктор, заполняющий таблицы CRC32C и выбирающий ядра модуля.
+ */
+ae_compiler_constructor(ae_memory_hash_dispatch_init)
+{
+    for (ae_u32_t i = 0; i < 256; ++i)
+    {
+        ae_u32_t crc = i;
+        for (ae_u32_t bit = 0; bit < 8; ++bit)
+        {
+            crc = (crc >> 1) ^ (m_memory_hash_crc32c_poly & (0 - (crc & 1)));
+        }
+        m_memory_hash_crc32c_table[0][i] = crc;
+    }
+
+    for (ae_u32_t i = 0; i < 256; ++i)
+    {
+        for (ae_u32_t k = 1; k < 8; ++k)
+        {
+            const ae_u32_t prev = m_memory_hash_crc32c_table[k - 1][i];
+            const ae_u32_t next = m_memory_hash_crc32c_table[0][prev & 0xFF];
+
+            m_memory_hash_crc32c_table[k][i] = (prev >> 8) ^ next;
+        }
+    }
+
+    ae_memory_hash_dispatch(AE_CPU_FEATURE_ALL);
+}
+
+ae_u32_t
+ae_memory_hash_crc32c(const void *begin, const void *end)
+{
+    ae_runtime_assert(begin, AE_RUNTIME_ERROR_NULL_POINTER, 0);
+
+    const ae_u32_t crc = m_memory_hash_crc32c_kernel(~(ae_u32_t)0,
+                                                     ae_ptr_cast(const ae_u8_t, begin),
+                                                     ae_memory_hash_range_size(begin, end));
+    return ~crc;
+}
+
+void
+ae_memory_hash_crc32c_init(ae_memory_hash_crc32c_t *self)
+{
+    ae_runtime_assert(self, AE_RUNTIME_ERROR_NULL_POINTER, );
+    self->crc = ~(ae_u32_t)0;
+}
+
+void
+ae_memory_hash_crc32c_update(ae_memory_hash_crc32c_t *self, const void *begin, const void *end)
+{
+    ae_runtime_assert(self && begin, AE_RUNTIME_ERROR_NULL_POINTER, );
+
+    self->crc = m_memory_hash_crc32c_kernel(self->crc,
+                                            ae_ptr_cast(const ae_u8_t, begin),
+                                            ae_memory_hash_range_size(begin, end));
+}
+
+ae_u32_t
+ae_memory_hash_crc32c_final(const ae_memory_hash_crc32c_t *self)
+{
+    ae_runtime_assert(self, AE_RUNTIME_ERROR_NULL_POINTER, 0);
+    return ~self->crc;
+}
+
+ae_u32_t
+ae_memory_hash_crc32c_copy(void *dst, const void *dst_end, const void *src, const void *src_end)
+{
+    ae_memory_hash_crc32c_t state;
+
+    ae_memory_hash_crc32c_init(&state);
+    ae_memory_hash_crc32c_copy_update(&state, dst, dst_end, src, src_end);
+    return ae_memory_hash_crc32c_final(&state);
+}
+
+void *
+ae_memory_hash_crc32c_copy_update(ae_memory_hash_crc32c_t *self,
+                                  void                    *dst,
+                                  const void              *dst_end,
+                                  const void              *src,
+                                  const void              *src_end)
+{
+    ae_runtime_assert(self && dst && src, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+
+    const ae_usize_t size = ae_memory_hash_copy_size(dst, dst_end, src, src_end);
+
+    self->crc = m_memory_hash_crc32c_copy_kernel(self->crc,
+                                                 ae_ptr_cast(ae_u8_t, dst),
+                                                 ae_ptr_cast(const ae_u8_t, src),
+                                                 size);
+    return ae_ptr_add_offset_unsafe(void, dst, size);
+}
+
+/* -------------------------------------------------------------------------------------------- */
+/* XXH64                                                                                        */
+/* -------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief Добавляет 8 байт к линии накопления.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_u64_t
+ae_memory_hash_xxh64_round(ae_u64_t acc, ae_u64_t input)
+{
+    acc += input * m_memory_hash_xxh64_prime[1];
+    acc = ae_bit_rotate_left(acc, 31);
+    return acc * m_memory_hash_xxh64_prime[0];
+}
+
+/**
+ * @brief Объединяет линию накопления с хешем.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_u64_t
+ae_memory_hash_xxh64_merge(ae_u64_t hash, ae_u64_t acc)
+{
+    hash ^= ae_memory_hash_xxh64_round(0, acc);
+    return hash * m_memory_hash_xxh64_prime[0] + m_memory_hash_xxh64_prime[3];
+}
+
+/**
+ * @brief Обрабатывает все полные блоки по 32 байта.
+ *
+ * @return Количество обработанных байт.
+ */
+static ae_usize_t
+ae_memory_hash_xxh64_consume(ae_u64_t acc[4], const ae_u8_t *data, ae_usize_t size)
+{
+    ae_u64_t a0 = acc[0];
+    ae_u64_t a1 = acc[1];
+    ae_u64_t a2 = acc[2];
+    ae_u64_t a3 = acc[3];
+
+    ae_usize_t pos = 0;
+    for (; pos + 32 <= size; pos += 32)
+    {
+        a0 = ae_memory_hash_xxh64_round(a0, ae_memory_hash_read64(data + pos));
+        a1 = ae_memory_hash_xxh64_round(a1, ae_memory_hash_read64(data + pos + 8));
+        a2 = ae_memory_hash_xxh64_round(a2, ae_memory_hash_read64(data + pos + 16));
+        a3 = ae_memory_hash_xxh64_round(a3, ae_memory_hash_read64(data + pos + 24));
+    }
+
+    acc[0] = a0;
+    acc[1] = a1;
+    acc[2] = a2;
+    acc[3] = a3;
+    return pos;
+}
+
+/**
+ * @brief Копирует все полные блоки по 32 байта, добавляя их к линиям накопления.
+ *
+ * @return Количество обработанных байт.
+ */
+static ae_usize_t
+ae_memory_hash_xxh64_consume_copy(ae_u64_t       acc[4],
+                                  ae_u8_t       *dst,
+                                  const ae_u8_t *src,
+                                  ae_usize_t     size)
+{
+    ae_u64_t a0 = acc[0];
+    ae_u64_t a1 = acc[1];
+    ae_u64_t a2 = acc[2];
+    ae_u64_t a3 = acc[3];
+
+    ae_usize_t pos = 0;
+    for (; pos + 32 <= size; pos += 32)
+    {
+        const ae_u64_t v0 = ae_memory_hash_read64(src + pos);
+        const ae_u64_t v1 = ae_memory_hash_read64(src + pos + 8);
+        const ae_u64_t v2 = ae_memory_hash_read64(src + pos + 16);
+        const ae_u64_t v3 = ae_memory_hash_read64(src + pos + 24);
+
+        ae_memory_hash_write64(dst + pos, v0);
+        ae_memory_hash_write64(dst + pos + 8, v1);
+        ae_memory_hash_write64(dst + pos + 16, v2);
+        ae_memory_hash_write64(dst + pos + 24, v3);
+
+        a0 = ae_memory_hash_xxh64_round(a0, v0);
+        a1 = ae_memory_hash_xxh64_round(a1, v1);
+        a2 = ae_memory_hash_xxh64_round(a2, v2);
+        a3 = ae_memory_hash_xxh64_round(a3, v3);
+    }
+
+    acc[0] = a0;
+    acc[1] = a1;
+    acc[2] = a2;
+    acc[3] = a3;
+    return pos;
+}
+
+/**
+ * @brief Добавляет данные к потоковому вычислению XXH64.
+ *
+ * @param self Состояние.
+ * @param dst Буфер, в который копируются данные, или `nullptr`, если копирование не требуется.
+ * @param data Добавляемые данные.
+ * @param size Количество байт.
+ */
+static void
+ae_memory_hash_xxh64_append(ae_memory_hash_xxh64_t *self,
+                            ae_u8_t                *dst,
+                            const ae_u8_t          *data,
+                            ae_usize_t              size)
+{
+    self->total_size += size;
+
+    /* Сначала дополняется блок, накопленный предыдущими вызовами. */
+    if (self->buffer_size != 0)
+    {
+        for (; size != 0 && self->buffer_size < sizeof(self->buffer); --size)
+        {
+            const ae_u8_t byte = *data++;
+
+            self->buffer[self->buffer_size++] = byte;
+            if (dst)
+            {
+                *dst++ = byte;
+            }
+        }
+
+        ae_runtime_return_if(self->buffer_size < sizeof(self->buffer), );
+
+        ae_memory_hash_xxh64_consume(self->acc, self->buffer, sizeof(self->buffer));
+        self->buffer_size = 0;
+    }
+
+    const ae_usize_t consumed = dst ? ae_memory_hash_xxh64_consume_copy(self->acc, dst, data, size)
+                                    : ae_memory_hash_xxh64_consume(self->acc, data, size);
+
+    for (ae_usize_t i = consumed; i < size; ++i)
+    {
+        self->buffer[self->buffer_size++] = data[i];
+        if (dst)
+        {
+            dst[i] = data[i];
+        }
+    }
+}
+
+/**
+ * @brief Вычисляет итоговое значение хеша.
+ *
+ * @param acc Линии накопления.
+ * @param seed Начальное значение хеша.
+ * @param total_size Общее количество байт.
+ * @param tail Оставшиеся байты (меньше 32).
+ * @param tail_size Количество оставшихся байт.
+ */
+static ae_u64_t
+ae_memory_hash_xxh64_digest(const ae_u64_t acc[4],
+                            ae_u64_t       seed,
+                            ae_u64_t       total_size,
+                            const ae_u8_t *tail,
+                            ae_usize_t     tail_size)
+{
+    const ae_u64_t *prime = m_memory_hash_xxh64_prime;
+    ae_u64_t        hash;
+
+    if (total_size >= 32)
+    {
+        ae_u64_t a0 = acc[0];
+        ae_u64_t a1 = acc[1];
+        ae_u64_t a2 = acc[2];
+        ae_u64_t a3 = acc[3];
+
+        hash = ae_bit_rotate_left(a0, 1) + ae_bit_rotate_left(a1, 7) +
+               ae_bit_rotate_left(a2, 12) + ae_bit_rotate_left(a3, 18);
+        hash = ae_memory_hash_xxh64_merge(hash, a0);
+        hash = ae_memory_hash_xxh64_merge(hash, a1);
+        hash = ae_memory_hash_xxh64_merge(hash, a2);
+        hash = ae_memory_hash_xxh64_merge(hash, a3);
+    }
+    else
+    {
+        hash = seed + prime[4];
+    }
+
+    hash += total_size;
+
+    for (; tail_size >= 8; tail += 8, tail_size -= 8)
+    {
+        hash ^= ae_memory_hash_xxh64_round(0, ae_memory_hash_read64(tail));
+        hash = ae_bit_rotate_left(hash, 27);
+        hash = hash * prime[0] + prime[3];
+    }
+
+    if (tail_size >= 4)
+    {
+        hash ^= (ae_u64_t)ae_memory_hash_read32(tail) * prime[0];
+        hash = ae_bit_rotate_left(hash, 23);
+        hash = hash * prime[1] + prime[2];
+        tail += 4;
+        tail_size -= 4;
+    }
+
+    while (tail_size--)
+    {
+        hash ^= *tail++ * prime[4];
+        hash = ae_bit_rotate_left(hash, 11);
+        hash *= prime[0];
+    }
+
+    /* Финальное перемешивание битов. */
+    hash ^= hash >> 33;
+    hash *= prime[1];
+    hash ^= hash >> 29;
+    hash *= prime[2];
+    hash ^= hash >> 32;
+    return hash;
+}
+
+ae_u64_t
+ae_memory_hash_xxh64(const void *begin, const void *end, ae_u64_t seed)
+{
+    ae_runtime_assert(begin, AE_RUNTIME_ERROR_NULL_POINTER, 0);
+
+    const ae_u8_t   *data = ae_ptr_cast(const ae_u8_t, begin);
+    const ae_usize_t size = ae_memory_hash_range_size(begin, end);
+
+    ae_memory_hash_xxh64_t state;
+    ae_memory_hash_xxh64_init(&state, seed);
+
+    const ae_usize_t consumed = ae_memory_hash_xxh64_consume(state.acc, data, size);
+    return ae_memory_hash_xxh64_digest(state.acc, seed, size, data + consumed, size - consumed);
+}
+
+void
+ae_memory_hash_xxh64_init(ae_memory_hash_xxh64_t *self, ae_u64_t seed)
+{
+    ae_runtime_assert(self, AE_RUNTIME_ERROR_NULL_POINTER, );
+
+    self->acc[0]      = seed + m_memory_hash_xxh64_prime[0] + m_memory_hash_xxh64_prime[1];
+    self->acc[1]      = seed + m_memory_hash_xxh64_prime[1];
+    self->acc[2]      = seed;
+    self->acc[3]      = seed - m_memory_hash_xxh64_prime[0];
+    self->seed        = seed;
+    self->total_size  = 0;
+    self->buffer_size = 0;
+}
+
+void
+ae_memory_hash_xxh64_update(ae_memory_hash_xxh64_t *self, const void *begin, const void *end)
+{
+    ae_runtime_assert(self && begin, AE_RUNTIME_ERROR_NULL_POINTER, );
+
+    ae_memory_hash_xxh64_append(self,
+                                nullptr,
+                                ae_ptr_cast(const ae_u8_t, begin),
+                                ae_memory_hash_range_size(begin, end));
+}
+
+ae_u64_t
+ae_memory_hash_xxh64_final(const ae_memory_hash_xxh64_t *self)
+{
+    ae_runtime_assert(self, AE_RUNTIME_ERROR_NULL_POINTER, 0);
+
+    return ae_memory_hash_xxh64_digest(self->acc,
+                                       self->seed,
+                                       self->total_size,
+                                       self->buffer,
+                                       self->buffer_size);
+}
+
+ae_u64_t
+ae_memory_hash_xxh64_copy(void       *dst,
+                          const void *dst_end,
+                          const void *src,
+                          const void *src_end,
+                          ae_u64_t    seed)
+{
+    ae_memory_hash_xxh64_t state;
+
+    ae_memory_hash_xxh64_init(&state, seed);
+    ae_memory_hash_xxh64_copy_update(&state, dst, dst_end, src, src_end);
+    return ae_memory_hash_xxh64_final(&state);
+}
+
+void *
+ae_memory_hash_xxh64_copy_update(ae_memory_hash_xxh64_t *self,
+                                 void                   *dst,
+                                 const void             *dst_end,
+                                 const void             *src,
+                                 const void             *src_end)
+{
+    ae_runtime_assert(self && dst && src, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+
+    const ae_usize_t size = ae_memory_hash_copy_size(dst, dst_end, src, src_end);
+
+    ae_memory_hash_xxh64_append(self,
+                                ae_ptr_cast(ae_u8_t, dst),
+                                ae_ptr_cast(const ae_u8_t, src),
+                                size);
+    return ae_ptr_add_offset_unsafe(void, dst, size);
+}
@@ -2,10 +2,12 @@
 /* Дополнительные модули */
 #include <ae/memory_range_initializer.h>
 #include <ae/runtime_error_code.h>
+#include <ae/runtime_return_if.h>
 #include <ae/ptr_range_traits.h>
 #include <ae/runtime_assert.h>
 #include <ae/runtime_throw.h>
 #include <ae/runtime_try.h>
+#include <ae/memory_hash.h>
 #include <ae/memory_raw.h>
 #include <ae/nullptr.h>
 
@@ -68,6 +70,7 @@ ae_memory_range_diff(const void *self)
 ae_usize_t
 ae_memory_range_size(const void *self)
 {
+    ae_runtime_return_if(ae_memory_range_is_null(self), 0);
     ae_runtime_assert(ae_memory_range_is_valid(self), AE_RUNTIME_ERROR_INVALID_MEMORY_RANGE, 0);
     return (ae_usize_t)ae_memory_range_diff(self);
 }
@@ -263,4 +266,47 @@ bool
 ae_memory_range_is_equal(const void *self, const void *other)
 {
     return ae_memory_range_is_begin_equal(self, other) && ae_memory_range_is_end_equal(self, other);
-}
\ No newline at end of file
+}
+
+ae_u32_t
+ae_memory_range_crc32c(const void *self)
+{
+    ae_runtime_assert(ae_memory_range_is_valid(self), AE_RUNTIME_ERROR_INVALID_MEMORY_RANGE, 0);
+
+    const void *begin = ae_memory_range_get_begin(self);
+    const void *end   = ae_memory_range_get_end(self);
+
+    return ae_memory_hash_crc32c(begin, end);
+}
+
+ae_u64_t
+ae_memory_range_xxh64(const void *self, ae_u64_t seed)
+{
+    ae_runtime_assert(ae_memory_range_is_valid(self), AE_RUNTIME_ERROR_INVALID_MEMORY_RANGE, 0);
+
+    const void *begin = ae_memory_range_get_begin(self);
+    const void *end   = ae_memory_range_get_end(self);
+
+    return ae_memory_hash_xxh64(begin, end, seed);
+}
+
+bool
+ae_memory_range_is_zero(const void *self)
+{
+    ae_runtime_assert(ae_memory_range_is_valid(self), AE_RUNTIME_ERROR_INVALID_MEMORY_RANGE, false);
+
+    return ae_memory_range_find_nonzero(self) == nullptr;
+}
+
+void *
+ae_memory_range_find_nonzero(const void *self)
+{
+    ae_runtime_assert(ae_memory_range_is_valid(self),
+                      AE_RUNTIME_ERROR_INVALID_MEMORY_RANGE,
+                      nullptr);
+
+    const void *begin = ae_memory_range_get_begin(self);
+    const void *end   = ae_memory_range_get_end(self);
+
+    return ae_ptr_cast(void, ae_memory_raw_find_nonzero(begin, end));
+}
@@ -1,397 +1,5106 @@
 #include <ae/memory_raw.h>
 
+#include <ae/memory_searcher.h>
 #include <ae/runtime_error_code.h>
 #include <ae/runtime_return_if.h>
 #include <ae/ptr_range_traits.h>
 #include <ae/runtime_assert.h>
-#include <ae/runtime_try.h>
+#include <ae/bit_traits.h>
+#include <ae/cpu_feature.h>
+#include <ae/worker_pool.h>
+#include <ae/array_size.h>
+#include <ae/ascii_map.h>
+#include <ae/bit_scan.h>
 #include <ae/nullptr.h>
 
-#if defined(AE_COMPILE_OPTION_AVX) || defined(AE_COMPILE_OPTION_AVX2)
-#    include <immintrin.h> // Для AVX
-#endif                     // AE_COMPILE_OPTION_AVX
+#if AE_COMPILER_ARCH_X86
+#    include <immintrin.h> // Для SSE, AVX и AVX-512
+#endif                     // AE_COMPILER_ARCH_X86
 
-#ifdef AE_COMPILE_OPTION_SSE
-#    include <xmmintrin.h> // Для SSE
-#endif                     // AE_COMPILE_OPTION_SSE
+/**
+ * @brief Ядро копирования @c size байт в прямом направлении.
+ *
+ * При @c non_temporal основная часть записывается в обход кэша.
+ */
+typedef void(ae_memory_raw_copy_kernel)(ae_u8_t       *dst,
+                                        const ae_u8_t *src,
+                                        ae_usize_t     size,
+                                        bool           non_temporal);
 
-#ifdef AE_COMPILE_OPTION_SSE2
-#    include <emmintrin.h> // Для SSE2
-#endif                     // AE_COMPILE_OPTION_SSE2
+/**
+ * @brief Ядро копирования @c size байт в обратном направлении,
+ *        начиная с концов буферов.
+ *
+ * При @c non_temporal основная часть записывается в обход кэша.
+ */
+typedef void(ae_memory_raw_copy_from_end_kernel)(ae_u8_t       *dst_end,
+                                                 const ae_u8_t *src_end,
+                                                 ae_usize_t     size,
+                                                 bool           non_temporal);
 
-#ifdef AE_COMPILE_OPTION_SSE3
-#    include <pmmintrin.h> // Для SSE3
-#endif                     // AE_COMPILE_OPTION_SSE3
+/**
+ * @brief Ядро сравнения @c size байт; возвращает первое различие в @c lhs или nullptr.
+ */
+typedef const ae_u8_t *(ae_memory_raw_compare_kernel)(const ae_u8_t *lhs,
+                                                      const ae_u8_t *rhs,
+                                                      ae_usize_t     size);
 
-#ifdef AE_COMPILE_OPTION_SSE41
-#    include <smmintrin.h> // Для SSE4.1
-#endif                     // AE_COMPILE_OPTION_SSE41
-                           // AE_COMPILE_OPTION_SSE41
+/**
+ * @brief Ядро сравнения @c size байт, начиная с концов буферов;
+ *        возвращает последнее различие в @c lhs или nullptr.
+ */
+typedef const ae_u8_t *(ae_memory_raw_compare_from_end_kernel)(const ae_u8_t *lhs_end,
+                                                               const ae_u8_t *rhs_end,
+                                                               ae_usize_t     size);
 
-void *
-ae_memory_raw_copy(void *dst, const void *dst_end, const void *src, const void *src_end)
+/**
+ * @brief Ядро проверки @c size байт на различие; возвращает `true`, если блоки различаются.
+ *
+ * Все байты обрабатываются независимо от их значений, поэтому время работы
+ * зависит только от @c size.
+ */
+typedef bool(ae_memory_raw_differ_kernel)(const ae_u8_t *lhs, const ae_u8_t *rhs, ae_usize_t size);
+
+/**
+ * @brief Ядро подсчета байт, равных @c value.
+ */
+typedef ae_usize_t(ae_memory_raw_count_byte_kernel)(const ae_u8_t *data,
+                                                    ae_usize_t     size,
+                                                    ae_u8_t        value);
+
+/**
+ * @brief Ядро подсчета установленных битов.
+ */
+typedef ae_usize_t(ae_memory_raw_popcount_kernel)(const ae_u8_t *data, ae_usize_t size);
+
+/**
+ * @brief Ядро поиска первого ненулевого байта.
+ */
+typedef const ae_u8_t *(ae_memory_raw_find_nonzero_kernel)(const ae_u8_t *data, ae_usize_t size);
+
+/**
+ * @brief Ядро поиска первого байта вне диапазона ASCII.
+ */
+typedef const ae_u8_t *(ae_memory_raw_find_non_ascii_kernel)(const ae_u8_t *data, ae_usize_t size);
+
+/**
+ * @brief Ядро поиска первого вхождения иглы длиной @c needle_size
+ *        (от 1 до @c haystack_size байт); возвращает начало вхождения или nullptr.
+ */
+typedef const ae_u8_t *(ae_memory_raw_find_kernel)(const ae_u8_t *haystack,
+                                                   ae_usize_t     haystack_size,
+                                                   const ae_u8_t *needle,
+                                                   ae_usize_t     needle_size);
+
+/**
+ * @brief Ядро поиска последнего вхождения иглы длиной @c needle_size
+ *        (от 1 до @c haystack_size байт); возвращает начало вхождения или nullptr.
+ */
+typedef const ae_u8_t *(ae_memory_raw_find_from_end_kernel)(const ae_u8_t *haystack,
+                                                            ae_usize_t     haystack_size,
+                                                            const ae_u8_t *needle,
+                                                            ae_usize_t     needle_size);
+
+/**
+ * @brief Ядро поиска элемента шириной 1, 2 или 4 байта в @c size байтах;
+ *        возвращает начало найденного элемента или nullptr.
+ *
+ * Значение элемента передается как массив байт @c value в порядке хранения в памяти,
+ * а @c size кратен ширине элемента.
+ */
+typedef const ae_u8_t *(ae_memory_raw_find_unit_kernel)(const ae_u8_t *data,
+                                                        ae_usize_t     size,
+                                                        const ae_u8_t *value);
+
+/**
+ * @brief Ядро поиска нулевого элемента шириной @c width (1, 2 или 4 байта)
+ *        в последовательности неизвестной длины.
+ */
+typedef const ae_u8_t *(ae_memory_raw_find_terminator_kernel)(const ae_u8_t *str,
+                                                              ae_usize_t     width);
+
+/**
+ * @brief Вид множества байт, по которому выполняется поиск.
+ */
+typedef enum
 {
-    ae_runtime_assert(dst && src, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+    /** @brief Один из двух байт. */
+    AE_MEMORY_RAW_BYTE_SET_ANY2,
 
-    ae_u8_t       *_dst     = ae_ptr_cast(ae_u8_t, dst);
-    const ae_u8_t *_dst_end = ae_ptr_cast(const ae_u8_t, dst_end);
-    const ae_u8_t *_src     = ae_ptr_cast(const ae_u8_t, src);
-    const ae_u8_t *_src_end = ae_ptr_cast(const ae_u8_t, src_end);
+    /** @brief Один из трех байт. */
+    AE_MEMORY_RAW_BYTE_SET_ANY3,
 
-    while (_dst < _dst_end && _src < _src_end)
-    {
-        const ae_usize_t dst_len = ae_ptr_diff(_dst_end, _dst);
-        const ae_usize_t src_len = ae_ptr_diff(_src_end, _src);
+    /** @brief Любой байт, входящий в класс. */
+    AE_MEMORY_RAW_BYTE_SET_CLASS,
 
-#if defined(AE_COMPILE_OPTION_AVX512)
-        if (dst_len >= 64 && src_len >= 64)
-        {
-            __m512i zmm0 = _mm512_loadu_si512(ae_ptr_cast(const __m512i, _src));
-            _mm512_storeu_si512(ae_ptr_cast(__m512i, _dst), zmm0);
-            _dst += 64;
-            _src += 64;
-            continue;
-        }
-#endif
+    /** @brief Любой байт, не входящий в класс. */
+    AE_MEMORY_RAW_BYTE_SET_NOT_CLASS
+} ae_memory_raw_byte_set_kind_t;
 
-#if defined(AE_COMPILE_OPTION_AVX) || defined(AE_COMPILE_OPTION_AVX2)
-        if (dst_len >= 32 && src_len >= 32)
-        {
-            __m256i ymm0 = _mm256_loadu_si256(ae_ptr_cast(const __m256i, _src));
-            _mm256_storeu_si256(ae_ptr_cast(__m256i, _dst), ymm0);
-            _dst += 32;
-            _src += 32;
-            continue;
-        }
-#endif
+/**
+ * @brief Множество байт для ядер поиска.
+ *
+ * Для двух и трех байт используются значения @c values
+ * (неиспользуемые значения повторяют последнее), для класса - @c cls.
+ */
+typedef struct
+{
+    ae_memory_raw_byte_set_kind_t kind;
+    ae_u8_t                       values[3];
+    const ae_byte_class_t        *cls;
+} ae_memory_raw_byte_set_t;
 
-#ifdef AE_COMPILE_OPTION_SSE
-        if (dst_len >= 16 && src_len >= 16)
-        {
-            __m128i xmm0 = _mm_loadu_si128(ae_ptr_cast(const __m128i, _src));
-            _mm_storeu_si128(ae_ptr_cast(__m128i, _dst), xmm0);
-            _dst += 16;
-            _src += 16;
-            continue;
-        }
-#endif
+/**
+ * @brief Ядро поиска байта из множества @c set в @c size байтах;
+ *        возвращает найденный байт или nullptr.
+ */
+typedef const ae_u8_t *(ae_memory_raw_find_set_kernel)(const ae_u8_t                  *data,
+                                                       ae_usize_t                      size,
+                                                       const ae_memory_raw_byte_set_t *set);
 
-        *_dst++ = *_src++;
-    }
-    return _dst;
+/**
+ * @brief Ядро построения маски байт из множества @c set среди @c size байт
+ *        (не более 64); бит `i` маски соответствует байту `data[i]`.
+ */
+typedef ae_u64_t(ae_memory_raw_match_set_kernel)(const ae_u8_t                  *data,
+                                                 ae_usize_t                      size,
+                                                 const ae_memory_raw_byte_set_t *set);
+
+/**
+ * @brief Ядро заполнения @c size байт периодическим шаблоном.
+ *
+ * Буфер @c unit содержит 32 байта шаблона с периодом @c period (1, 2, 4, 8 или 16),
+ * поэтому из него можно загрузить 16 байт шаблона с любым сдвигом фазы.
+ * При @c non_temporal запись основной части выполняется в обход кэша.
+ */
+typedef void(ae_memory_raw_set_kernel)(ae_u8_t       *dst,
+                                       ae_usize_t     size,
+                                       const ae_u8_t *unit,
+                                       ae_usize_t     period,
+                                       bool           non_temporal);
+
+/**
+ * @brief Ядро замены каждого байта значением из таблицы из 256 элементов.
+ *
+ * Указатели @c dst и @c src могут совпадать.
+ */
+typedef void(ae_memory_raw_translate_kernel)(ae_u8_t       *dst,
+                                             const ae_u8_t *src,
+                                             ae_usize_t     size,
+                                             const ae_u8_t *table);
+
+/**
+ * @brief Ядро смены регистра латинских букв ASCII.
+ *
+ * Байты из диапазона букв, начинающегося с @c first (`'a'` или `'A'`),
+ * копируются с инвертированным битом регистра, остальные - без изменений.
+ * Указатели @c dst и @c src могут совпадать.
+ */
+typedef void(ae_memory_raw_case_kernel)(ae_u8_t       *dst,
+                                        const ae_u8_t *src,
+                                        ae_usize_t     size,
+                                        ae_u8_t        first);
+
+/**
+ * @brief Таблица ядер, выбранных для текущего процессора.
+ */
+typedef struct
+{
+    ae_memory_raw_copy_kernel             *copy;
+    ae_memory_raw_copy_from_end_kernel    *copy_from_end;
+    ae_memory_raw_compare_kernel          *compare;
+    ae_memory_raw_compare_from_end_kernel *compare_from_end;
+    ae_memory_raw_compare_kernel          *compare_icase;
+    ae_memory_raw_differ_kernel           *differ;
+    ae_memory_raw_count_byte_kernel       *count_byte;
+    ae_memory_raw_popcount_kernel         *popcount;
+    ae_memory_raw_find_nonzero_kernel     *find_nonzero;
+    ae_memory_raw_find_non_ascii_kernel   *find_non_ascii;
+    ae_memory_raw_find_kernel             *find;
+    ae_memory_raw_find_from_end_kernel    *find_from_end;
+    ae_memory_raw_find_unit_kernel        *find_byte;
+    ae_memory_raw_find_unit_kernel        *find_byte_from_end;
+    ae_memory_raw_find_unit_kernel        *find_u16;
+    ae_memory_raw_find_unit_kernel        *find_u32;
+    ae_memory_raw_find_terminator_kernel  *find_terminator;
+    ae_memory_raw_find_set_kernel         *find_set;
+    ae_memory_raw_find_set_kernel         *find_set_from_end;
+    ae_memory_raw_match_set_kernel        *match_set;
+    ae_memory_raw_set_kernel              *set;
+    ae_memory_raw_translate_kernel        *translate;
+    ae_memory_raw_case_kernel             *change_case;
+} ae_memory_raw_kernels_t;
+
+/**
+ * @brief Количество латинских букв в каждом регистре.
+ */
+static const ae_u8_t m_memory_raw_case_count =
+    AE_ASCII_MAP_UPPERCASE_Z - AE_ASCII_MAP_UPPERCASE_A + 1;
+
+/**
+ * @brief Бит, которым отличаются заглавная и строчная латинские буквы.
+ */
+static const ae_u8_t m_memory_raw_case_bit = AE_ASCII_MAP_LOWERCASE_A ^ AE_ASCII_MAP_UPPERCASE_A;
+
+/**
+ * @brief Возвращает количество байт в диапазоне или 0, если диапазон пуст.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_usize_t
+ae_memory_raw_range_size(const void *begin, const void *end)
+{
+    return (end > begin) ? ae_ptr_to_addr_diff(end, begin) : 0;
 }
 
-void *
-ae_memory_raw_copy_from_end(const void *dst, void *dst_end, const void *src, const void *src_end)
+/**
+ * @brief Возвращает длину середины иглы, которая проверяется
+ *        после совпадения первого и последнего байта.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_usize_t
+ae_memory_raw_find_middle_size(ae_usize_t needle_size)
 {
-    ae_runtime_assert(dst && src, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+    return (needle_size > 2) ? needle_size - 2 : 0;
+}
+
+/* -------------------------------------------------------------------------------------------- */
+/* Переносимые ядра                                                                             */
+/* -------------------------------------------------------------------------------------------- */
+
+static void
+ae_memory_raw_copy_generic(ae_u8_t *dst, const ae_u8_t *src, ae_usize_t size, bool non_temporal)
+{
+    (void)non_temporal;
 
-    ae_u8_t       *_dst     = ae_ptr_cast(ae_u8_t, dst_end);
-    const ae_u8_t *_src     = ae_ptr_cast(const ae_u8_t, src_end);
-    const ae_u8_t *_dst_end = ae_ptr_cast(const ae_u8_t, dst);
-    const ae_u8_t *_src_end = ae_ptr_cast(const ae_u8_t, src);
+    while (size--)
+    {
+        *dst++ = *src++;
+    }
+}
+
+static void
+ae_memory_raw_copy_from_end_generic(ae_u8_t       *dst_end,
+                                    const ae_u8_t *src_end,
+                                    ae_usize_t     size,
+                                    bool           non_temporal)
+{
+    (void)non_temporal;
 
-    while (_dst > _dst_end && _src > _src_end)
+    while (size--)
     {
-        const ae_usize_t dst_len = ae_ptr_diff(_dst, _dst_end);
-        const ae_usize_t src_len = ae_ptr_diff(_src, _src_end);
+        *--dst_end = *--src_end;
+    }
+}
 
-#if defined(AE_COMPILE_OPTION_AVX512)
-        if (dst_len >= 64 && src_len >= 64)
+static const ae_u8_t *
+ae_memory_raw_compare_generic(const ae_u8_t *lhs, const ae_u8_t *rhs, ae_usize_t size)
+{
+    for (ae_usize_t i = 0; i < size; ++i)
+    {
+        if (lhs[i] != rhs[i])
         {
-            __m512i zmm0 = _mm512_loadu_si512(ae_ptr_cast(const __m512i, _src - 1));
-            _mm512_storeu_si512(ae_ptr_cast(__m512i, _dst - 1), zmm0);
-            _dst -= 64;
-            _src -= 64;
-            continue;
+            return lhs + i;
         }
-#endif
+    }
+    return nullptr;
+}
 
-#if defined(AE_COMPILE_OPTION_AVX) || defined(AE_COMPILE_OPTION_AVX2)
-        if (dst_len >= 32 && src_len >= 32)
+static const ae_u8_t *
+ae_memory_raw_compare_from_end_generic(const ae_u8_t *lhs_end,
+                                       const ae_u8_t *rhs_end,
+                                       ae_usize_t     size)
+{
+    while (size--)
+    {
+        if (*--lhs_end != *--rhs_end)
         {
-            __m256i ymm0 = _mm256_loadu_si256(ae_ptr_cast(const __m256i, _src - 1));
-            _mm256_storeu_si256(ae_ptr_cast(__m256i, _dst - 1), ymm0);
-            _dst -= 32;
-            _src -= 32;
-            continue;
+            return lhs_end;
         }
-#endif
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Приводит латинскую букву ASCII к нижнему регистру,
+ *        остальные байты возвращает без изменений.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_u8_t
+ae_memory_raw_fold_case(ae_u8_t byte)
+{
+    const bool upper = (ae_u8_t)(byte - AE_ASCII_MAP_UPPERCASE_A) < m_memory_raw_case_count;
+    return upper ? byte | m_memory_raw_case_bit : byte;
+}
 
-#ifdef AE_COMPILE_OPTION_SSE
-        if (dst_len >= 16 && src_len >= 16)
+static const ae_u8_t *
+ae_memory_raw_compare_icase_generic(const ae_u8_t *lhs, const ae_u8_t *rhs, ae_usize_t size)
+{
+    for (ae_usize_t i = 0; i < size; ++i)
+    {
+        if (lhs[i] != rhs[i] && ae_memory_raw_fold_case(lhs[i]) != ae_memory_raw_fold_case(rhs[i]))
         {
-            __m128i xmm0 = _mm_loadu_si128(ae_ptr_cast(const __m128i, _src - 1));
-            _mm_storeu_si128(ae_ptr_cast(__m128i, _dst - 1), xmm0);
-            _dst -= 16;
-            _src -= 16;
-            continue;
+            return lhs + i;
         }
-#endif
+    }
+    return nullptr;
+}
 
-        *--_dst = *--_src;
+/*
+ * Ядра проверки на различие накапливают побитовое ИЛИ разностей всех байт
+ * и не выходят из цикла досрочно, поэтому время их работы не зависит
+ * от того, где (и есть ли) различие.
+ */
+
+static bool
+ae_memory_raw_differ_generic(const ae_u8_t *lhs, const ae_u8_t *rhs, ae_usize_t size)
+{
+    ae_u8_t diff = 0;
+
+    for (ae_usize_t i = 0; i < size; ++i)
+    {
+        diff |= lhs[i] ^ rhs[i];
     }
-    return _dst;
+    return diff != 0;
 }
 
-void *
-ae_memory_raw_move(void *dst, const void *dst_end, const void *src, const void *src_end)
+/*
+ * Ядра подсчета суммируют совпадения (или количества битов) в байтовых счетчиках
+ * SIMD-регистра и сворачивают их инструкцией `psadbw` до переполнения счетчиков.
+ */
+
+static ae_usize_t
+ae_memory_raw_count_byte_generic(const ae_u8_t *data, ae_usize_t size, ae_u8_t value)
 {
-    ae_runtime_assert(dst && src, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+    ae_usize_t count = 0;
 
-    if (ae_ptr_range_is_overlapped(dst, src, src_end))
+    for (ae_usize_t i = 0; i < size; ++i)
     {
-        void *_dst_end = ae_ptr_cast(void, dst_end);
-        void *_ptr     = ae_memory_raw_copy_from_end(dst, _dst_end, src, src_end);
-        return ae_ptr_sub_offset(void, _dst_end, ae_ptr_to_addr_diff(_ptr, dst));
+        count += data[i] == value;
     }
-    return ae_memory_raw_copy(dst, dst_end, src, src_end);
+    return count;
 }
 
-const void *
-ae_memory_raw_compare(const void *lhs, const void *lhs_end, const void *rhs, const void *rhs_end)
+static ae_usize_t
+ae_memory_raw_popcount_generic(const ae_u8_t *data, ae_usize_t size)
 {
-    ae_runtime_assert(lhs && rhs, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
-    ae_runtime_return_if(lhs == rhs, nullptr);
+    ae_usize_t count = 0;
 
-    const ae_u8_t *_lhs     = ae_ptr_cast(const ae_u8_t, lhs);
-    const ae_u8_t *_lhs_end = ae_ptr_cast(const ae_u8_t, lhs_end);
-    const ae_u8_t *_rhs     = ae_ptr_cast(const ae_u8_t, rhs);
-    const ae_u8_t *_rhs_end = ae_ptr_cast(const ae_u8_t, rhs_end);
+    /* Порядок байтов в слове не влияет на количество битов. */
+    for (; size >= 8; data += 8, size -= 8)
+    {
+        ae_u64_t word = (ae_u64_t)data[0] | ((ae_u64_t)data[1] << 8) |
+                        ((ae_u64_t)data[2] << 16) | ((ae_u64_t)data[3] << 24) |
+                        ((ae_u64_t)data[4] << 32) | ((ae_u64_t)data[5] << 40) |
+                        ((ae_u64_t)data[6] << 48) | ((ae_u64_t)data[7] << 56);
+
+        word = word - ((word >> 1) & 0x5555555555555555ULL);
+        word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+        word = (word + (word >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        count += (ae_usize_t)((word * 0x0101010101010101ULL) >> 56);
+    }
 
-    while (_lhs < _lhs_end && _rhs < _rhs_end)
+    for (; size != 0; ++data, --size)
     {
-        const ae_usize_t lhs_len = ae_ptr_diff(_lhs_end, _lhs);
-        const ae_usize_t rhs_len = ae_ptr_diff(_rhs_end, _rhs);
+        ae_u8_t byte = *data;
 
-#if defined(AE_COMPILE_OPTION_AVX512)
-        if (lhs_len >= 64 && rhs_len >= 64)
+        for (; byte != 0; byte &= (ae_u8_t)(byte - 1))
         {
-            __m512i   zmm_lhs = _mm512_loadu_si512(ae_ptr_cast(const __m512i, _lhs));
-            __m512i   zmm_rhs = _mm512_loadu_si512(ae_ptr_cast(const __m512i, _rhs));
-            __mmask64 mask    = _mm512_cmpeq_epi8_mask(zmm_lhs, zmm_rhs);
-            if (mask != 0xFFFFFFFFFFFFFFFF)
-            {
-                ae_sint_t index = _tzcnt_u64(~mask);
-                return _lhs + index;
-            }
-            _lhs += 64;
-            _rhs += 64;
-            continue;
+            count++;
         }
-#endif
+    }
+    return count;
+}
 
-#ifdef AE_COMPILE_OPTION_AVX2
-        if (lhs_len >= 32 && rhs_len >= 32)
-        {
-            __m256i   ymm_lhs       = _mm256_loadu_si256(ae_ptr_cast(const __m256i, _lhs));
-            __m256i   ymm_rhs       = _mm256_loadu_si256(ae_ptr_cast(const __m256i, _rhs));
-            __m256i   cmp           = _mm256_cmpeq_epi8(ymm_lhs, ymm_rhs);
-            ae_sint_t mask          = _mm256_movemask_epi8(cmp);
-            ae_uint_t inverted_mask = ~mask;
+/*
+ * Ядра поиска ненулевого байта объединяют побитовым ИЛИ несколько регистров
+ * подряд и проверяют результат один раз на группу, а положение ненулевого
+ * байта определяют только в группе, где он найден.
+ */
 
-            if (inverted_mask != 0)
-            {
-#    if (AE_COMPILER_TYPE == AE_COMPILER_TYPE_GCC || AE_COMPILER_TYPE == AE_COMPILER_TYPE_CLANG)
-                ae_sint_t index = __builtin_ctz(inverted_mask);
-#    elif AE_COMPILER_TYPE == AE_COMPILER_TYPE_MSVC
-                ae_ulong_t index;
-                _BitScanForward(&index, inverted_mask);
-#    endif
-                return _lhs + index;
-            }
-            _lhs += 32;
-            _rhs += 32;
-            continue;
-        }
-#elif defined(AE_COMPILE_OPTION_AVX) || defined(AE_COMPILE_OPTION_SSE)
-        if (lhs_len >= 16 && rhs_len >= 16)
+static const ae_u8_t *
+ae_memory_raw_find_nonzero_generic(const ae_u8_t *data, ae_usize_t size)
+{
+    for (ae_usize_t i = 0; i < size; ++i)
+    {
+        if (data[i] != 0)
         {
-            __m128i   xmm_lhs       = _mm_loadu_si128(ae_ptr_cast(const __m128i, _lhs));
-            __m128i   xmm_rhs       = _mm_loadu_si128(ae_ptr_cast(const __m128i, _rhs));
-            __m128i   cmp           = _mm_cmpeq_epi8(xmm_lhs, xmm_rhs);
-            ae_sint_t mask          = _mm_movemask_epi8(cmp);
-            ae_uint_t inverted_mask = ~mask & 0xFFFF;
-
-            if (inverted_mask != 0)
-            {
-#    if (AE_COMPILER_TYPE == AE_COMPILER_TYPE_GCC || AE_COMPILER_TYPE == AE_COMPILER_TYPE_CLANG)
-                ae_sint_t index = __builtin_ctz(inverted_mask);
-#    elif AE_COMPILER_TYPE == AE_COMPILER_TYPE_MSVC
-                ae_ulong_t index;
-                _BitScanForward(&index, inverted_mask);
-#    else
-#        error "Unsupported compiler for memory raw function compare"
-#    endif
-                return _lhs + index;
-            }
-            _lhs += 16;
-            _rhs += 16;
-            continue;
+            return data + i;
         }
-#endif
-        if (*_lhs != *_rhs)
+    }
+    return nullptr;
+}
+
+static const ae_u8_t *
+ae_memory_raw_find_non_ascii_generic(const ae_u8_t *data, ae_usize_t size)
+{
+    for (ae_usize_t i = 0; i < size; ++i)
+    {
+        if (data[i] & 0x80)
         {
-            return _lhs;
+            return data + i;
         }
-        _lhs++;
-        _rhs++;
     }
-
     return nullptr;
 }
 
-const void *
-ae_memory_raw_compare_from_end(const void *lhs,
-                               const void *lhs_end,
-                               const void *rhs,
-                               const void *rhs_end)
+static const ae_u8_t *
+ae_memory_raw_find_generic(const ae_u8_t *haystack,
+                           ae_usize_t     haystack_size,
+                           const ae_u8_t *needle,
+                           ae_usize_t     needle_size)
 {
-    ae_runtime_assert(lhs && rhs, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+    const ae_u8_t    first  = needle[0];
+    const ae_u8_t    last   = needle[needle_size - 1];
+    const ae_usize_t middle = ae_memory_raw_find_middle_size(needle_size);
 
-    const ae_u8_t *_lhs = ae_ptr_cast(const ae_u8_t, lhs_end - 1);
-    const ae_u8_t *_rhs = ae_ptr_cast(const ae_u8_t, rhs_end - 1);
+    for (ae_usize_t i = 0; i + needle_size <= haystack_size; ++i)
+    {
+        if (haystack[i] == first && haystack[i + needle_size - 1] == last &&
+            !ae_memory_raw_compare_generic(haystack + i + 1, needle + 1, middle))
+        {
+            return haystack + i;
+        }
+    }
+    return nullptr;
+}
 
-    ae_usize_t lhs_len = ae_ptr_diff(lhs_end, lhs);
-    ae_usize_t rhs_len = ae_ptr_diff(rhs_end, rhs);
-    ae_usize_t min_len = (lhs_len < rhs_len) ? lhs_len : rhs_len;
+static const ae_u8_t *
+ae_memory_raw_find_from_end_generic(const ae_u8_t *haystack,
+                                    ae_usize_t     haystack_size,
+                                    const ae_u8_t *needle,
+                                    ae_usize_t     needle_size)
+{
+    const ae_u8_t    first  = needle[0];
+    const ae_u8_t    last   = needle[needle_size - 1];
+    const ae_usize_t middle = ae_memory_raw_find_middle_size(needle_size);
 
-#if defined(AE_COMPILE_OPTION_AVX512)
-    while (min_len >= 64)
+    if (needle_size > haystack_size)
     {
-        const ae_u8_t *_lhs_chunk_start = _lhs - 63;
-        const ae_u8_t *_rhs_chunk_start = _rhs - 63;
+        return nullptr;
+    }
 
-        __m512i   zmm_lhs = _mm512_loadu_si512(ae_ptr_cast(const __m512i, _lhs_chunk_start));
-        __m512i   zmm_rhs = _mm512_loadu_si512(ae_ptr_cast(const __m512i, _rhs_chunk_start));
-        __mmask64 mask    = _mm512_cmpeq_epi8_mask(zmm_lhs, zmm_rhs);
-        if (mask != 0xFFFFFFFFFFFFFFFF)
+    for (ae_usize_t i = haystack_size - needle_size + 1; i-- > 0;)
+    {
+        if (haystack[i] == first && haystack[i + needle_size - 1] == last &&
+            !ae_memory_raw_compare_generic(haystack + i + 1, needle + 1, middle))
         {
-            ae_sint_t index = 63 - _lzcnt_u64(~mask);
-            return _lhs_chunk_start + index;
+            return haystack + i;
         }
-        _lhs = _lhs_chunk_start - 1;
-        _rhs = _rhs_chunk_start - 1;
-        min_len -= 64;
     }
-#endif
+    return nullptr;
+}
 
-#ifdef AE_COMPILE_OPTION_AVX2
-    while (min_len >= 32)
+/**
+ * @brief Ищет элемент шириной @c width байт, сравнивая его побайтово,
+ *        что не требует выравнивания данных.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN const ae_u8_t *
+ae_memory_raw_find_unit_generic(const ae_u8_t *data,
+                                ae_usize_t     size,
+                                const ae_u8_t *value,
+                                ae_usize_t     width)
+{
+    for (ae_usize_t i = 0; i + width <= size; i += width)
     {
-        const ae_u8_t *_lhs_chunk_start = _lhs - 31;
-        const ae_u8_t *_rhs_chunk_start = _rhs - 31;
-
-        __m256i   ymm_lhs       = _mm256_loadu_si256((const __m256i *)_lhs_chunk_start);
-        __m256i   ymm_rhs       = _mm256_loadu_si256((const __m256i *)_rhs_chunk_start);
-        __m256i   cmp           = _mm256_cmpeq_epi8(ymm_lhs, ymm_rhs);
-        ae_sint_t mask          = _mm256_movemask_epi8(cmp);
-        ae_uint_t inverted_mask = ~mask;
+        ae_usize_t j = 0;
+        while (j < width && data[i + j] == value[j])
+        {
+            ++j;
+        }
 
-        if (inverted_mask != 0)
+        if (j == width)
         {
-#    if (AE_COMPILER_TYPE == AE_COMPILER_TYPE_GCC || AE_COMPILER_TYPE == AE_COMPILER_TYPE_CLANG)
-            ae_sint_t index = 31 - __builtin_clz(inverted_mask);
-#    elif AE_COMPILER_TYPE == AE_COMPILER_TYPE_MSVC
-            ae_ulong_t index;
-            _BitScanReverse(&index, inverted_mask);
-#    endif
-            return _lhs_chunk_start + index;
+            return data + i;
         }
-        _lhs = _lhs_chunk_start - 1;
-        _rhs = _rhs_chunk_start - 1;
-        min_len -= 32;
     }
-#endif
+    return nullptr;
+}
+
+static const ae_u8_t *
+ae_memory_raw_find_byte_generic(const ae_u8_t *data, ae_usize_t size, const ae_u8_t *value)
+{
+    return ae_memory_raw_find_unit_generic(data, size, value, 1);
+}
 
-#if defined(AE_COMPILE_OPTION_AVX) || defined(AE_COMPILE_OPTION_SSE)
-    while (min_len >= 16)
+static const ae_u8_t *
+ae_memory_raw_find_byte_from_end_generic(const ae_u8_t *data, ae_usize_t size, const ae_u8_t *value)
+{
+    while (size--)
     {
-        const ae_u8_t *_lhs_chunk_start = _lhs - 15;
-        const ae_u8_t *_rhs_chunk_start = _rhs - 15;
+        if (data[size] == *value)
+        {
+            return data + size;
+        }
+    }
+    return nullptr;
+}
+
+static const ae_u8_t *
+ae_memory_raw_find_u16_generic(const ae_u8_t *data, ae_usize_t size, const ae_u8_t *value)
+{
+    return ae_memory_raw_find_unit_generic(data, size, value, 2);
+}
+
+static const ae_u8_t *
+ae_memory_raw_find_u32_generic(const ae_u8_t *data, ae_usize_t size, const ae_u8_t *value)
+{
+    return ae_memory_raw_find_unit_generic(data, size, value, 4);
+}
 
-        __m128i   xmm_lhs       = _mm_loadu_si128(ae_ptr_cast(const __m128i, _lhs_chunk_start));
-        __m128i   xmm_rhs       = _mm_loadu_si128(ae_ptr_cast(const __m128i, _rhs_chunk_start));
-        __m128i   cmp           = _mm_cmpeq_epi8(xmm_lhs, xmm_rhs);
-        ae_sint_t mask          = _mm_movemask_epi8(cmp);
-        ae_uint_t inverted_mask = ~mask & 0xFFFF;
+static const ae_u8_t *
+ae_memory_raw_find_terminator_generic(const ae_u8_t *str, ae_usize_t width)
+{
+    for (;; str += width)
+    {
+        ae_usize_t j = 0;
+        while (j < width && str[j] == 0)
+        {
+            ++j;
+        }
 
-        if (inverted_mask != 0)
+        if (j == width)
         {
-#    if (AE_COMPILER_TYPE == AE_COMPILER_TYPE_GCC || AE_COMPILER_TYPE == AE_COMPILER_TYPE_CLANG)
-            ae_sint_t index = 15 - __builtin_clz(inverted_mask);
-#    elif AE_COMPILER_TYPE == AE_COMPILER_TYPE_MSVC
-            ae_ulong_t index;
-            _BitScanReverse(&index, inverted_mask);
-#    else
-#        error "Unsupported compiler for memory raw function compare from end"
-#    endif
-            return _lhs_chunk_start + index;
+            return str;
         }
-        _lhs = _lhs_chunk_start - 1;
-        _rhs = _rhs_chunk_start - 1;
-        min_len -= 16;
     }
-#endif
+}
+
+/**
+ * @brief Проверяет, входит ли байт в множество.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN bool
+ae_memory_raw_byte_set_contains(const ae_memory_raw_byte_set_t *set, ae_u8_t value)
+{
+    switch (set->kind)
+    {
+        case AE_MEMORY_RAW_BYTE_SET_ANY2:
+            return value == set->values[0] || value == set->values[1];
+        case AE_MEMORY_RAW_BYTE_SET_ANY3:
+            return value == set->values[0] || value == set->values[1] || value == set->values[2];
+        case AE_MEMORY_RAW_BYTE_SET_CLASS:
+            return (set->cls->bitmap[value >> 3] >> (value & 7)) & 1;
+        default:
+            return !((set->cls->bitmap[value >> 3] >> (value & 7)) & 1);
+    }
+}
 
-    for (ae_usize_t i = 0; i < min_len; ++i)
+static const ae_u8_t *
+ae_memory_raw_find_set_generic(const ae_u8_t                  *data,
+                               ae_usize_t                      size,
+                               const ae_memory_raw_byte_set_t *set)
+{
+    for (ae_usize_t i = 0; i < size; ++i)
     {
-        if (*_lhs != *_rhs)
+        if (ae_memory_raw_byte_set_contains(set, data[i]))
         {
-            return _lhs;
+            return data + i;
         }
-        --_lhs;
-        --_rhs;
     }
-
     return nullptr;
 }
 
-const void *
-ae_memory_raw_find(const void *lhs, const void *lhs_end, const void *rhs, const void *rhs_end)
+static const ae_u8_t *
+ae_memory_raw_find_set_from_end_generic(const ae_u8_t                  *data,
+                                        ae_usize_t                      size,
+                                        const ae_memory_raw_byte_set_t *set)
 {
-    ae_runtime_assert(lhs && rhs, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
-
-    const ae_u8_t *_lhs_end = ae_ptr_cast(ae_u8_t, lhs_end);
-    for (const ae_u8_t *_lhs = lhs; _lhs < _lhs_end; ++_lhs)
+    while (size--)
     {
-        if (!ae_memory_raw_compare(_lhs, lhs_end, rhs, rhs_end))
+        if (ae_memory_raw_byte_set_contains(set, data[size]))
         {
-            return _lhs;
+            return data + size;
         }
     }
     return nullptr;
 }
 
-const void *
-ae_memory_raw_find_from_end(const void *lhs,
-                            const void *lhs_end,
-                            const void *rhs,
-                            const void *rhs_end)
+static ae_u64_t
+ae_memory_raw_match_set_generic(const ae_u8_t                  *data,
+                                ae_usize_t                      size,
+                                const ae_memory_raw_byte_set_t *set)
 {
-    ae_runtime_assert(lhs && rhs, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+    ae_u64_t mask = 0;
 
-    const ae_u8_t *_lhs = ae_ptr_cast(ae_u8_t, lhs);
-    for (const ae_u8_t *_lhs_end = lhs_end; _lhs_end > _lhs; --_lhs_end)
+    for (ae_usize_t i = 0; i < size; ++i)
     {
-        if (!ae_memory_raw_compare_from_end(lhs, _lhs_end, rhs, rhs_end))
+        if (ae_memory_raw_byte_set_contains(set, data[i]))
         {
-            return ae_ptr_sub_offset_unsafe(void, _lhs_end, ae_ptr_to_addr_diff(rhs_end, rhs));
+            mask |= (ae_u64_t)1 << i;
         }
     }
-    return nullptr;
+    return mask;
 }
 
-void *
-ae_memory_raw_set(void *dst, const void *dst_end, const void *src, const void *src_end)
+static void
+ae_memory_raw_set_generic(ae_u8_t       *dst,
+                          ae_usize_t     size,
+                          const ae_u8_t *unit,
+                          ae_usize_t     period,
+                          bool           non_temporal)
 {
-    ae_runtime_try
+    (void)non_temporal;
+
+    for (ae_usize_t i = 0; i < size; ++i)
     {
-        do
-        {
-            dst = ae_memory_raw_move(dst, dst_end, src, src_end);
-        } while (dst < dst_end);
-        ae_runtime_try_return(dst);
+        dst[i] = unit[i & (period - 1)];
+    }
+}
+
+static void
+ae_memory_raw_translate_generic(ae_u8_t       *dst,
+                                const ae_u8_t *src,
+                                ae_usize_t     size,
+                                const ae_u8_t *table)
+{
+    for (; size >= 4; dst += 4, src += 4, size -= 4)
+    {
+        const ae_u8_t b0 = table[src[0]];
+        const ae_u8_t b1 = table[src[1]];
+        const ae_u8_t b2 = table[src[2]];
+        const ae_u8_t b3 = table[src[3]];
+
+        dst[0] = b0;
+        dst[1] = b1;
+        dst[2] = b2;
+        dst[3] = b3;
+    }
+
+    while (size--)
+    {
+        *dst++ = table[*src++];
+    }
+}
+
+static void
+ae_memory_raw_case_generic(ae_u8_t *dst, const ae_u8_t *src, ae_usize_t size, ae_u8_t first)
+{
+    while (size--)
+    {
+        const ae_u8_t byte = *src++;
+        const bool    flip = (ae_u8_t)(byte - first) < m_memory_raw_case_count;
+
+        *dst++ = flip ? byte ^ m_memory_raw_case_bit : byte;
+    }
+}
+
+/* -------------------------------------------------------------------------------------------- */
+/* Ядра SSE2                                                                                    */
+/* -------------------------------------------------------------------------------------------- */
+
+#if AE_CPU_FEATURE_KERNEL_SSE2
+/**
+ * @brief Загружает @c width байт (2, 4, 8 или 16) в младшую часть регистра.
+ */
+AE_ATTRIBUTE(TARGET)("sse2")
+static AE_COMPILER_ATTRIBUTE_BUILTIN __m128i
+ae_memory_raw_load_sse2(const ae_u8_t *src, ae_usize_t width)
+{
+    switch (width)
+    {
+        case 2:
+            return _mm_loadu_si16(src);
+        case 4:
+            return _mm_loadu_si32(src);
+        case 8:
+            return _mm_loadl_epi64(ae_ptr_cast(const __m128i, src));
+        default:
+            return _mm_loadu_si128(ae_ptr_cast(const __m128i, src));
+    }
+}
+
+/**
+ * @brief Записывает @c width байт (2, 4, 8 или 16) из младшей части регистра.
+ */
+AE_ATTRIBUTE(TARGET)("sse2")
+static AE_COMPILER_ATTRIBUTE_BUILTIN void
+ae_memory_raw_store_sse2(ae_u8_t *dst, __m128i value, ae_usize_t width)
+{
+    switch (width)
+    {
+        case 2:
+            _mm_storeu_si16(dst, value);
+            break;
+        case 4:
+            _mm_storeu_si32(dst, value);
+            break;
+        case 8:
+            _mm_storel_epi64(ae_ptr_cast(__m128i, dst), value);
+            break;
+        default:
+            _mm_storeu_si128(ae_ptr_cast(__m128i, dst), value);
+            break;
+    }
+}
+
+/**
+ * @brief Возвращает маску различающихся байт среди первых @c width байт блоков.
+ */
+AE_ATTRIBUTE(TARGET)("sse2")
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_u32_t
+ae_memory_raw_diff_sse2(const ae_u8_t *lhs, const ae_u8_t *rhs, ae_usize_t width)
+{
+    const __m128i  xmm_lhs = ae_memory_raw_load_sse2(lhs, width);
+    const __m128i  xmm_rhs = ae_memory_raw_load_sse2(rhs, width);
+    const ae_u32_t equal   = (ae_u32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(xmm_lhs, xmm_rhs));
+
+    return ~equal & ((1u << width) - 1);
+}
+
+/*
+ * Блоки длиной от `width` до `2 * width` байт обрабатываются двумя перекрывающимися
+ * фрагментами: от начала и от конца блока. Поэтому остаток любой длины обрабатывается
+ * без побайтового цикла, а в основных циклах достаточно одной проверки границы.
+ */
+
+/**
+ * @brief Копирует от @c width до 2 * @c width байт двумя перекрывающимися фрагментами.
+ *
+ * Оба фрагмента читаются до записи, поэтому буферы могут перекрываться.
+ */
+AE_ATTRIBUTE(TARGET)("sse2")
+static AE_COMPILER_ATTRIBUTE_BUILTIN void
+ae_memory_raw_copy_pair_sse2(ae_u8_t *dst, const ae_u8_t *src, ae_usize_t size, ae_usize_t width)
+{
+    const __m128i head = ae_memory_raw_load_sse2(src, width);
+    const __m128i tail = ae_memory_raw_load_sse2(src + size - width, width);
+
+    ae_memory_raw_store_sse2(dst, head, width);
+    ae_memory_raw_store_sse2(dst + size - width, tail, width);
+}
+
+/**
+ * @brief Копирует до 32 байт без циклов.
+ */
+AE_ATTRIBUTE(TARGET)("sse2")
+static AE_COMPILER_ATTRIBUTE_BUILTIN void
+ae_memory_raw_copy_small_sse2(ae_u8_t *dst, const ae_u8_t *src, ae_usize_t size)
+{
+    if (size >= 16)
+    {
+        ae_memory_raw_copy_pair_sse2(dst, src, size, 16);
+    }
+    else if (size >= 8)
+    {
+        ae_memory_raw_copy_pair_sse2(dst, src, size, 8);
+    }
+    else if (size >= 4)
+    {
+        ae_memory_raw_copy_pair_sse2(dst, src, size, 4);
+    }
+    else if (size >= 2)
+    {
+        ae_memory_raw_copy_pair_sse2(dst, src, size, 2);
+    }
+    else if (size == 1)
+    {
+        *dst = *src;
+    }
+}
+
+/**
+ * @brief Сравнивает от @c width до 2 * @c width байт двумя перекрывающимися фрагментами;
+ *        возвращает первое различие в @c lhs или nullptr.
+ */
+AE_ATTRIBUTE(TARGET)("sse2")
+static AE_COMPILER_ATTRIBUTE_BUILTIN const ae_u8_t *
+ae_memory_raw_compare_pair_sse2(const ae_u8_t *lhs,
+                                const ae_u8_t *rhs,
+                                ae_usize_t     size,
+                                ae_usize_t     width)
+{
+    const ae_usize_t last = size - width;
+    ae_u32_t         mask = ae_memory_raw_diff_sse2(lhs, rhs, width);
+
+    if (mask != 0)
+    {
+        return lhs + ae_bit_scan_forward32(mask);
+    }
+
+    mask = ae_memory_raw_diff_sse2(lhs + last, rhs + last, width);
+    return (mask != 0) ? lhs + last + ae_bit_scan_forward32(mask) : nullptr;
+}
+
+/**
+ * @brief Сравнивает от @c width до 2 * @c width байт двумя перекрывающимися фрагментами;
+ *        возвращает последнее различие в @c lhs или nullptr.
+ */
+AE_ATTRIBUTE(TARGET)("sse2")
+static AE_COMPILER_ATTRIBUTE_BUILTIN const ae_u8_t *
+ae_memory_raw_compare_pair_from_end_sse2(const ae_u8_t *lhs,
+                                         const ae_u8_t *rhs,
+                                         ae_usize_t     size,
+                                         ae_usize_t     width)
+{
+    const ae_usize_t last = size - width;
+    ae_u32_t         mask = ae_memory_raw_diff_sse2(lhs + last, rhs + last, width);
+
+    if (mask != 0)
+    {
+        return lhs + last + ae_bit_scan_reverse32(mask);
+    }
+
+    mask = ae_memory_raw_diff_sse2(lhs, rhs, width);
+    return (mask != 0) ? lhs + ae_bit_scan_reverse32(mask) : nullptr;
+}
+
+/**
+ * @brief Сравнивает до 32 байт без циклов; возвращает первое различие в @c lhs или nullptr.
+ */
+AE_ATTRIBUTE(TARGET)("sse2")
+static AE_COMPILER_ATTRIBUTE_BUILTIN const ae_u8_t *
+ae_memory_raw_compare_small_sse2(const ae_u8_t *lhs, const ae_u8_t *rhs, ae_usize_t size)
+{
+    if (size >= 16)
+    {
+        return ae_memory_raw_compare_pair_sse2(lhs, rhs, size, 16);
     }
-    ae_runtime_raise(nullptr);
-}
\ No newline at end of file
+    else if (size >= 8)
+    {
+        return ae_memory_raw_compare_pair_sse2(lhs, rhs, size, 8);
+    }
+    else if (size >= 4)
+    {
+        return ae_memory_raw_compare_pair_sse2(lhs, rhs, size, 4);
+    }
+    else if (size >= 2)
+    {
+        return ae_memory_raw_compare_pair_sse2(lhs, rhs, size, 2);
+    }
+    return (size == 1 && *lhs != *rhs) ? lhs : nullptr;
+}
+
+/**
+ * @brief Сравнивает до 32 байт без циклов; возвращает последнее различие в @c lhs или nullptr.
+ */
+AE_ATTRIBUTE(TARGET)("sse2")
+static AE_COMPILER_ATTRIBUTE_BUILTIN const ae_u8_t *
+ae_memory_raw_compare_small_from_end_sse2(const ae_u8_t *lhs, const ae_u8_t *rhs, ae_usize_t size)
+{
+    if (size >= 16)
+    {
+        return ae_memory_raw_compare_pair_from_end_sse2(lhs, rhs, size, 16);
+    }
+    else if (size >= 8)
+    {
+        return ae_memory_raw_compare_pair_from_end_sse2(lhs, rhs, size, 8);
+    }
+    else if (size >= 4)
+    {
+        return ae_memory_raw_compare_pair_from_end_sse2(lhs, rhs, size, 4);
+    }
+    else if (size >= 2)
+    {
+        return ae_memory_raw_compare_pair_from_end_sse2(lhs, rhs, size, 2);
+    }
+    return (size == 1 && *lhs != *rhs) ? lhs : nullptr;
+}
+
+/**
+ * @brief Копирует до 63 байт без циклов, начиная с начала блока.
+ */
+AE_ATTRIBUTE(TARGET)("sse2")
+static AE_COMPILER_ATTRIBUTE_BUILTIN void
+ae_memory_raw_copy_rest_sse2(ae_u8_t *dst, const ae_u8_t *src, ae_usize_t size)
+{
+    if (size > 32)
+    {
+        ae_memory_raw_copy_small_sse2(dst, src, 32);
+        ae_memory_raw_copy_small_sse2(dst + 32, src + 32, size - 32);
+        return;
+    }
+    ae_memory_raw_copy_small_sse2(dst, src, size);
+}
+
+/**
+ * @brief Копирует до 63 байт без циклов, начиная с конца блока.
+ */
+AE_ATTRIBUTE(TARGET)("sse2")
+static AE_COMPILER_ATTRIBUTE_BUILTIN void
+ae_memory_raw_copy_rest_from_end_sse2(ae_u8_t *dst, const ae_u8_t *src, ae_usize_t size)
+{
+    if (size > 32)
+    {
+        ae_memory_raw_copy_small_sse2(dst + size - 32, src + size - 32, 32);
+        ae_memory_raw_copy_small_sse2(dst, src, size - 32);
+        return;
+    }
+    ae_memory_raw_copy_small_sse2(dst, src, size);
+}
+
+/*
+ * Копирование больших блоков невременными записями: назначение выравнивается
+ * по ширине регистра, основная часть записывается строками кэша (по 64 байта)
+ * в обход кэша с программной предвыборкой источника на
+ * `AE_MEMORY_RAW_PREFETCH_DISTANCE` байт вперед и завершается инструкцией `sfence`.
+ * Невыровненный край блока читается до цикла и записывается последним,
+ * поэтому порядок чтения и записи такой же, как у обычных ядер копирования.
+ */
+
+/**
+ * @brief Копирует более 32 байт невременными записями по 16 байт.
+ */
+AE_ATTRIBUTE(TARGET)("sse2")
+static AE_COMPILER_ATTRIBUTE_BUILTIN void
+ae_memory_raw_copy_stream_sse2(ae_u8_t *dst, const ae_u8_t *src, ae_usize_t size)
+{
+    const __m128i head = _mm_loadu_si128(ae_ptr_cast(const __m128i, src));
+    ae_usize_t    pos  = 16 - (ae_ptr_to_addr(dst) & 15);
+
+    for (; pos + 64 <= size; pos += 64)
+    {
+        _mm_prefetch(ae_ptr_cast(const char, (src + pos + AE_MEMORY_RAW_PREFETCH_DISTANCE)),
+                     _MM_HINT_NTA);
+
+        const __m128i xmm0 = _mm_loadu_si128(ae_ptr_cast(const __m128i, (src + pos)));
+        const __m128i xmm1 = _mm_loadu_si128(ae_ptr_cast(const __m128i, (src + pos + 16)));
+        const __m128i xmm2 = _mm_loadu_si128(ae_ptr_cast(const __m128i, (src + pos + 32)));
+        const __m128i xmm3 = _mm_loadu_si128(ae_ptr_cast(const __m128i, (src + pos + 48)));
+
+        _mm_stream_si128(ae_ptr_cast(__m128i, (dst + pos)), xmm0);
+        _mm_stream_si128(ae_ptr_cast(__m128i, (dst + pos + 16)), xmm1);
+        _mm_stream_si128(ae_ptr_cast(__m128i, (dst + pos + 32)), xmm2);
+        _mm_stream_si128(ae_ptr_cast(__m128i, (dst + pos + 48)), xmm3);
+    }
+    _mm_sfence();
+
+    ae_memory_raw_copy_rest_sse2(dst + pos, src + pos, size - pos);
+    _mm_storeu_si128(ae_ptr_cast(__m128i, dst), head);
+}
+
+/**
+ * @brief Копирует более 32 байт невременными записями по 16 байт от конца к началу.
+ */
+AE_ATTRIBUTE(TARGET)("sse2")
+static AE_COMPILER_ATTRIBUTE_BUILTIN void
+ae_memory_raw_copy_from_end_stream_sse2(ae_u8_t *dst, const ae_u8_t *src, ae_usize_t size)
+{
+    const __m128i tail = _mm_loadu_si128(ae_ptr_cast(const __m128i, (src + size - 16)));
+    ae_usize_t    pos  = size - ((ae_ptr_to_addr(dst) + size) & 15);
+
+    for (; pos >= 64; pos -= 64)
+    {
+        _mm_prefetch(ae_ptr_cast(const char, (src + pos - 64 - AE_MEMORY_RAW_PREFETCH_DISTANCE)),
+                     _MM_HINT_NTA);
+
+        const __m128i xmm0 = _mm_loadu_si128(ae_ptr_cast(const __m128i, (src + pos - 64)));
+        const __m128i xmm1 = _mm_loadu_si128(ae_ptr_cast(const __m128i, (src + pos - 48)));
+        const __m128i xmm2 = _mm_loadu_si128(ae_ptr_cast(const __m128i, (src + pos - 32)));
+        const __m128i xmm3 = _mm_loadu_si128(ae_ptr_cast(const __m128i, (src + pos - 16)));
+
+        _mm_stream_si128(ae_ptr_cast(__m128i, (dst + pos - 64)), xmm0);
+        _mm_stream_si128(ae_ptr_cast(__m128i, (dst + pos - 48)), xmm1);
+        _mm_stream_si128(ae_ptr_cast(__m128i, (dst + pos - 32)), xmm2);
+        _mm_stream_si128(ae_ptr_cast(__m128i, (dst + pos - 16)), xmm3);
+    }
+    _mm_sfence();
+
+    ae_memory_raw_copy_rest_from_end_sse2(dst, src, pos);
+    _mm_storeu_si128(ae_ptr_cast(__m128i, (dst + size - 16)), tail);
+}
+
+/**
+ * @brief Копирует блоки по 16 байт в одном цикле, а остаток - последним блоком,
+ *        перекрывающим уже скопированные данные.
+ *
+ * Последний блок читается до начала цикла, поэтому копирование корректно и в том случае,
+ * когда @c dst перекрывает @c src со стороны начала (см. `ae_memory_raw_move`).
+ */
+AE_ATTRIBUTE(TARGET)("sse2")
+static void
+ae_memory_raw_copy_sse2(ae_u8_t *dst, const ae_u8_t *src, ae_usize_t size, bool non_temporal)
+{
+    if (size <= 32)
+    {
+        ae_memory_raw_copy_small_sse2(dst, src, size);
+        return;
+    }
+
+    if (non_temporal)
+    {
+        ae_memory_raw_copy_stream_sse2(dst, src, size);
+        return;
+    }
+
+    const ae_usize_t last = size - 16;
+    const __m128i    tail = _mm_loadu_si128(ae_ptr_cast(const __m128i, (src + last)));
+
+    for (ae_usize_t pos = 0; pos < last; pos += 16)
+    {
+        __m128i xmm0 = _mm_loadu_si128(ae_ptr_cast(const __m128i, (src + pos)));
+        _mm_storeu_si128(ae_ptr_cast(__m128i, (dst + pos)), xmm0);
+    }
+    _mm_storeu_si128(ae_ptr_cast(__m128i, (dst + last)), tail);
+}
+
+/**
+ * @brief Копирует блоки по 16 байт от конца к началу (см. `ae_memory_raw_copy_sse2`).
+ *
+ * Первый блок читается до начала цикла, поэтому копирование корректно и в том случае,
+ * когда @c dst перекрывает @c src со стороны конца.
+ */
+AE_ATTRIBUTE(TARGET)("sse2")
+static void
+ae_memory_raw_copy_from_end_sse2(ae_u8_t       *dst_end,
+                                 const ae_u8_t *src_end,
+                                 ae_usize_t     size,
+                                 bool           non_temporal)
+{
+    ae_u8_t       *dst = dst_end - size;
+    const ae_u8_t *src = src_end - size;
+
+    if (size <= 32)
+    {
+        ae_memory_raw_copy_small_sse2(dst, src, size);
+        return;
+    }
+
+    if (non_temporal)
+    {
+        ae_memory_raw_copy_from_end_stream_sse2(dst, src, size);
+        return;
+    }
+
+    const __m128i head = _mm_loadu_si128(ae_ptr_cast(const __m128i, src));
+
+    for (ae_usize_t pos = size; pos > 16; pos -= 16)
+    {
+        __m128i xmm0 = _mm_loadu_si128(ae_ptr_cast(const __m128i, (src + pos - 16)));
+        _mm_storeu_si128(ae_ptr_cast(__m128i, (dst + pos - 16)), xmm0);
+    }
+    _mm_storeu_si128(ae_ptr_cast(__m128i, dst), head);
+}
+
+AE_ATTRIBUTE(TARGET)("sse2")
+static const ae_u8_t *
+ae_memory_raw_compare_sse2(const ae_u8_t *lhs, const ae_u8_t *rhs, ae_usize_t size)
+{
+    if (size <= 32)
+    {
+        return ae_memory_raw_compare_small_sse2(lhs, rhs, size);
+    }
+
+    const ae_usize_t last = size - 16;
+    ae_u32_t         mask;
+
+    for (ae_usize_t pos = 0; pos < last; pos += 16)
+    {
+        mask = ae_memory_raw_diff_sse2(lhs + pos, rhs + pos, 16);
+        if (mask != 0)
+        {
+            return lhs + pos + ae_bit_scan_forward32(mask);
+        }
+    }
+
+    mask = ae_memory_raw_diff_sse2(lhs + last, rhs + last, 16);
+    return (mask != 0) ? lhs + last + ae_bit_scan_forward32(mask) : nullptr;
+}
+
+AE_ATTRIBUTE(TARGET)("sse2")
+static const ae_u8_t *
+ae_memory_raw_compare_from_end_sse2(const ae_u8_t *lhs_end,
+                                    const ae_u8_t *rhs_end,
+                                    ae_usize_t     size)
+{
+    const ae_u8_t *lhs = lhs_end - size;
+    const ae_u8_t *rhs = rhs_end - size;
+    ae_u32_t       mask;
+
+    if (size <= 32)
+    {
+        return ae_memory_raw_compare_small_from_end_sse2(lhs, rhs, size);
+    }
+
+    for (ae_usize_t pos = size; pos > 16; pos -= 16)
+    {
+        mask = ae_memory_raw_diff_sse2(lhs + pos - 16, rhs + pos - 16, 16);
+        if (mask != 0)
+        {
+            return lhs + pos - 16 + ae_bit_scan_reverse32(mask);
+        }
+    }
+
+    mask = ae_memory_raw_diff_sse2(lhs, rhs, 16);
+    return (mask != 0) ? lhs + ae_bit_scan_reverse32(mask) : nullptr;
+}
+
+/*
+ * Ядра сравнения без учета регистра приводят латинские буквы обоих блоков
+ * к нижнему регистру в регистрах (см. `ae_memory_raw_case_sse2`) и далее
+ * ищут различие так же, как ядра `ae_memory_raw_compare`.
+ */
+
+/**
+ * @brief Приводит латинские буквы блока к нижнему регистру.
+ */
+AE_ATTRIBUTE(TARGET)("sse2")
+static AE_COMPILER_ATTRIBUTE_BUILTIN __m128i
+ae_memory_raw_fold_case_sse2(__m128i value)
+{
+    const __m128i bias  = _mm_set1_epi8((char)(0x80 - AE_ASCII_MAP_UPPERCASE_A));
+    const __m128i limit = _mm_set1_epi8((char)(0x80 + m_memory_raw_case_count));
+    const __m128i bit   = _mm_set1_epi8((char)m_memory_raw_case_bit);
+    const __m128i upper = _mm_cmplt_epi8(_mm_add_epi8(value, bias), limit);
+
+    return _mm_or_si128(value, _mm_and_si128(upper, bit));
+}
+
+/**
+ * @brief Возвращает маску различающихся без учета регистра байт
+ *        среди первых @c width байт блоков.
+ */
+AE_ATTRIBUTE(TARGET)("sse2")
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_u32_t
+ae_memory_raw_diff_icase_sse2(const ae_u8_t *lhs, const ae_u8_t *rhs, ae_usize_t width)
+{
+    const __m128i  xmm_lhs = ae_memory_raw_fold_case_sse2(ae_memory_raw_load_sse2(lhs, width));
+    const __m128i  xmm_rhs = ae_memory_raw_fold_case_sse2(ae_memory_raw_load_sse2(rhs, width));
+    const ae_u32_t equal   = (ae_u32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(xmm_lhs, xmm_rhs));
+
+    return ~equal & ((1u << width) - 1);
+}
+
+/**
+ * @brief Сравнивает без учета регистра от @c width до 2 * @c width байт
+ *        двумя перекрывающимися фрагментами (см. `ae_memory_raw_compare_pair_sse2`).
+ */
+AE_ATTRIBUTE(TARGET)("sse2")
+static AE_COMPILER_ATTRIBUTE_BUILTIN const ae_u8_t *
+ae_memory_raw_compare_icase_pair_sse2(const ae_u8_t *lhs,
+                                      const ae_u8_t *rhs,
+                                      ae_usize_t     size,
+                                      ae_usize_t     width)
+{
+    const ae_usize_t last = size - width;
+    ae_u32_t         mask = ae_memory_raw_diff_icase_sse2(lhs, rhs, width);
+
+    if (mask != 0)
+    {
+        return lhs + ae_bit_scan_forward32(mask);
+    }
+
+    mask = ae_memory_raw_diff_icase_sse2(lhs + last, rhs + last, width);
+    return (mask != 0) ? lhs + last + ae_bit_scan_forward32(mask) : nullptr;
+}
+
+/**
+ * @brief Сравнивает без учета регистра до 32 байт без циклов
+ *        (см. `ae_memory_raw_compare_small_sse2`).
+ */
+AE_ATTRIBUTE(TARGET)("sse2")
+static AE_COMPILER_ATTRIBUTE_BUILTIN const ae_u8_t *
+ae_memory_raw_compare_icase_small_sse2(const ae_u8_t *lhs, const ae_u8_t *rhs, ae_usize_t size)
+{
+    if (size >= 16)
+    {
+        return ae_memory_raw_compare_icase_pair_sse2(lhs, rhs, size, 16);
+    }
+    else if (size >= 8)
+    {
+        return ae_memory_raw_compare_icase_pair_sse2(lhs, rhs, size, 8);
+    }
+    else if (size >= 4)
+    {
+        return ae_memory_raw_compare_icase_pair_sse2(lhs, rhs, size, 4);
+    }
+    else if (size >= 2)
+    {
+        return ae_memory_raw_compare_icase_pair_sse2(lhs, rhs, size, 2);
+    }
+    return ae_memory_raw_compare_icase_generic(lhs, rhs, size);
+}
+
+AE_ATTRIBUTE(TARGET)("sse2")
+static const ae_u8_t *
+ae_memory_raw_compare_icase_sse2(const ae_u8_t *lhs, const ae_u8_t *rhs, ae_usize_t size)
+{
+    if (size <= 32)
+    {
+        return ae_memory_raw_compare_icase_small_sse2(lhs, rhs, size);
+    }
+
+    const ae_usize_t last = size - 16;
+    ae_u32_t         mask;
+
+    for (ae_usize_t pos = 0; pos < last; pos += 16)
+    {
+        mask = ae_memory_raw_diff_icase_sse2(lhs + pos, rhs + pos, 16);
+        if (mask != 0)
+        {
+            return lhs + pos + ae_bit_scan_forward32(mask);
+        }
+    }
+
+    mask = ae_memory_raw_diff_icase_sse2(lhs + last, rhs + last, 16);
+    return (mask != 0) ? lhs + last + ae_bit_scan_forward32(mask) : nullptr;
+}
+
+/**
+ * @brief Проверяет блоки на различие по 16 байт (см. `ae_memory_raw_differ_generic`).
+ *
+ * Последний блок загружается с перекрытием, поэтому часть байт
+ * может учитываться дважды, что не влияет на результат.
+ */
+AE_ATTRIBUTE(TARGET)("sse2")
+static bool
+ae_memory_raw_differ_sse2(const ae_u8_t *lhs, const ae_u8_t *rhs, ae_usize_t size)
+{
+    if (size < 16)
+    {
+        return ae_memory_raw_differ_generic(lhs, rhs, size);
+    }
+
+    const ae_usize_t last = size - 16;
+    __m128i          acc  = _mm_xor_si128(ae_memory_raw_load_sse2(lhs + last, 16),
+                                          ae_memory_raw_load_sse2(rhs + last, 16));
+
+    for (ae_usize_t pos = 0; pos < last; pos += 16)
+    {
+        acc = _mm_or_si128(acc,
+                           _mm_xor_si128(ae_memory_raw_load_sse2(lhs + pos, 16),
+                                         ae_memory_raw_load_sse2(rhs + pos, 16)));
+    }
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(acc, _mm_setzero_si128())) != 0xFFFF;
+}
+
+/**
+ * @brief Складывает две 64-битные суммы, полученные инструкцией `psadbw`.
+ */
+AE_ATTRIBUTE(TARGET)("sse2")
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_usize_t
+ae_memory_raw_sad_sum_sse2(__m128i sad)
+{
+    return (ae_usize_t)_mm_cvtsi128_si32(sad) + (ae_usize_t)_mm_extract_epi16(sad, 4);
+}
+
+/**
+ * @brief Подсчитывает байты, равные @c value, блоками по 16 байт.
+ *
+ * Результаты сравнения (-1 для совпадения) вычитаются из байтовых счетчиков,
+ * которые сворачиваются каждые 255 блоков.
+ */
+AE_ATTRIBUTE(TARGET)("sse2")
+static ae_usize_t
+ae_memory_raw_count_byte_sse2(const ae_u8_t *data, ae_usize_t size, ae_u8_t value)
+{
+    const __m128i needle = _mm_set1_epi8((char)value);
+    const __m128i zero   = _mm_setzero_si128();
+    ae_usize_t    count  = 0;
+
+    while (size >= 16)
+    {
+        const ae_usize_t blocks = (size / 16 < 255) ? size / 16 : 255;
+        __m128i          acc    = zero;
+
+        for (ae_usize_t i = 0; i < blocks; ++i, data += 16)
+        {
+            const __m128i xmm0 = _mm_loadu_si128(ae_ptr_cast(const __m128i, data));
+            acc                = _mm_sub_epi8(acc, _mm_cmpeq_epi8(xmm0, needle));
+        }
+
+        size -= blocks * 16;
+        count += ae_memory_raw_sad_sum_sse2(_mm_sad_epu8(acc, zero));
+    }
+    return count + ae_memory_raw_count_byte_generic(data, size, value);
+}
+
+/**
+ * @brief Ищет первый ненулевой байт, проверяя по 64 байта за раз.
+ */
+AE_ATTRIBUTE(TARGET)("sse2")
+static const ae_u8_t *
+ae_memory_raw_find_nonzero_sse2(const ae_u8_t *data, ae_usize_t size)
+{
+    const __m128i zero = _mm_setzero_si128();
+    ae_usize_t    pos  = 0;
+
+    for (; pos + 64 <= size; pos += 64)
+    {
+        const __m128i xmm0 = _mm_loadu_si128(ae_ptr_cast(const __m128i, (data + pos)));
+        const __m128i xmm1 = _mm_loadu_si128(ae_ptr_cast(const __m128i, (data + pos + 16)));
+        const __m128i xmm2 = _mm_loadu_si128(ae_ptr_cast(const __m128i, (data + pos + 32)));
+        const __m128i xmm3 = _mm_loadu_si128(ae_ptr_cast(const __m128i, (data + pos + 48)));
+        const __m128i acc  = _mm_or_si128(_mm_or_si128(xmm0, xmm1), _mm_or_si128(xmm2, xmm3));
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(acc, zero)) != 0xFFFF)
+        {
+            break;
+        }
+    }
+
+    for (; pos + 16 <= size; pos += 16)
+    {
+        const __m128i  xmm0 = _mm_loadu_si128(ae_ptr_cast(const __m128i, (data + pos)));
+        const ae_u32_t mask = ~(ae_u32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(xmm0, zero)) & 0xFFFF;
+
+        if (mask != 0)
+        {
+            return data + pos + ae_bit_scan_forward32(mask);
+        }
+    }
+    return ae_memory_raw_find_nonzero_generic(data + pos, size - pos);
+}
+
+/**
+ * @brief Ищет первый байт вне диапазона ASCII, проверяя по 64 байта за раз
+ *        (см. `ae_memory_raw_find_nonzero_sse2`).
+ *
+ * Старшие биты объединенного регистра извлекаются одной инструкцией `pmovmskb`.
+ */
+AE_ATTRIBUTE(TARGET)("sse2")
+static const ae_u8_t *
+ae_memory_raw_find_non_ascii_sse2(const ae_u8_t *data, ae_usize_t size)
+{
+    ae_usize_t pos = 0;
+
+    for (; pos + 64 <= size; pos += 64)
+    {
+        const __m128i xmm0 = _mm_loadu_si128(ae_ptr_cast(const __m128i, (data + pos)));
+        const __m128i xmm1 = _mm_loadu_si128(ae_ptr_cast(const __m128i, (data + pos + 16)));
+        const __m128i xmm2 = _mm_loadu_si128(ae_ptr_cast(const __m128i, (data + pos + 32)));
+        const __m128i xmm3 = _mm_loadu_si128(ae_ptr_cast(const __m128i, (data + pos + 48)));
+        const __m128i acc  = _mm_or_si128(_mm_or_si128(xmm0, xmm1), _mm_or_si128(xmm2, xmm3));
+
+        if (_mm_movemask_epi8(acc) != 0)
+        {
+            break;
+        }
+    }
+
+    for (; pos + 16 <= size; pos += 16)
+    {
+        const __m128i  xmm0 = _mm_loadu_si128(ae_ptr_cast(const __m128i, (data + pos)));
+        const ae_u32_t mask = (ae_u32_t)_mm_movemask_epi8(xmm0);
+
+        if (mask != 0)
+        {
+            return data + pos + ae_bit_scan_forward32(mask);
+        }
+    }
+    return ae_memory_raw_find_non_ascii_generic(data + pos, size - pos);
+}
+
+/**
+ * @brief Подсчитывает установленные биты блоками по 16 байт.
+ *
+ * Количество битов в каждой тетраде выбирается инструкцией `pshufb`
+ * из таблицы на 16 значений; байтовые счетчики (до 8 за блок)
+ * сворачиваются каждые 31 блок.
+ */
+AE_ATTRIBUTE(TARGET)("ssse3")
+static ae_usize_t
+ae_memory_raw_popcount_ssse3(const ae_u8_t *data, ae_usize_t size)
+{
+    const __m128i lookup = _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    const __m128i zero   = _mm_setzero_si128();
+    ae_usize_t    count  = 0;
+
+    while (size >= 16)
+    {
+        const ae_usize_t blocks = (size / 16 < 31) ? size / 16 : 31;
+        __m128i          acc    = zero;
+
+        for (ae_usize_t i = 0; i < blocks; ++i, data += 16)
+        {
+            const __m128i xmm0 = _mm_loadu_si128(ae_ptr_cast(const __m128i, data));
+            const __m128i lo   = _mm_and_si128(xmm0, nibble);
+            const __m128i hi   = _mm_and_si128(_mm_srli_epi16(xmm0, 4), nibble);
+
+            acc = _mm_add_epi8(acc, _mm_shuffle_epi8(lookup, lo));
+            acc = _mm_add_epi8(acc, _mm_shuffle_epi8(lookup, hi));
+        }
+
+        size -= blocks * 16;
+        count += ae_memory_raw_sad_sum_sse2(_mm_sad_epu8(acc, zero));
+    }
+    return count + ae_memory_raw_popcount_generic(data, size);
+}
+
+/*
+ * Ядра поиска отбирают кандидатов сразу для нескольких позиций: байты буфера
+ * сравниваются с первым байтом иглы, а байты, сдвинутые на длину иглы, - с последним.
+ * Полностью проверяется только середина иглы на позициях, где совпали оба байта.
+ */
+
+AE_ATTRIBUTE(TARGET)("sse2")
+static const ae_u8_t *
+ae_memory_raw_find_sse2(const ae_u8_t *haystack,
+                        ae_usize_t     haystack_size,
+                        const ae_u8_t *needle,
+                        ae_usize_t     needle_size)
+{
+    const __m128i    first  = _mm_set1_epi8((char)needle[0]);
+    const __m128i    last   = _mm_set1_epi8((char)needle[needle_size - 1]);
+    const ae_usize_t middle = ae_memory_raw_find_middle_size(needle_size);
+    ae_usize_t       i      = 0;
+
+    for (; i + needle_size + 15 <= haystack_size; i += 16)
+    {
+        const ae_u8_t *block      = haystack + i;
+        const ae_u8_t *block_last = block + needle_size - 1;
+
+        __m128i  xmm_first = _mm_loadu_si128(ae_ptr_cast(const __m128i, block));
+        __m128i  xmm_last  = _mm_loadu_si128(ae_ptr_cast(const __m128i, block_last));
+        ae_u32_t mask      = (ae_u32_t)_mm_movemask_epi8(
+            _mm_and_si128(_mm_cmpeq_epi8(xmm_first, first), _mm_cmpeq_epi8(xmm_last, last)));
+
+        for (; mask != 0; mask &= mask - 1)
+        {
+            const ae_u8_t *candidate = block + ae_bit_scan_forward32(mask);
+            if (!ae_memory_raw_compare_sse2(candidate + 1, needle + 1, middle))
+            {
+                return candidate;
+            }
+        }
+    }
+    return ae_memory_raw_find_generic(haystack + i, haystack_size - i, needle, needle_size);
+}
+
+AE_ATTRIBUTE(TARGET)("sse2")
+static const ae_u8_t *
+ae_memory_raw_find_from_end_sse2(const ae_u8_t *haystack,
+                                 ae_usize_t     haystack_size,
+                                 const ae_u8_t *needle,
+                                 ae_usize_t     needle_size)
+{
+    const __m128i    first  = _mm_set1_epi8((char)needle[0]);
+    const __m128i    last   = _mm_set1_epi8((char)needle[needle_size - 1]);
+    const ae_usize_t middle = ae_memory_raw_find_middle_size(needle_size);
+    ae_usize_t       end    = haystack_size - needle_size + 1;
+
+    for (; end >= 16; end -= 16)
+    {
+        const ae_u8_t *block      = haystack + end - 16;
+        const ae_u8_t *block_last = block + needle_size - 1;
+
+        __m128i  xmm_first = _mm_loadu_si128(ae_ptr_cast(const __m128i, block));
+        __m128i  xmm_last  = _mm_loadu_si128(ae_ptr_cast(const __m128i, block_last));
+        ae_u32_t mask      = (ae_u32_t)_mm_movemask_epi8(
+            _mm_and_si128(_mm_cmpeq_epi8(xmm_first, first), _mm_cmpeq_epi8(xmm_last, last)));
+
+        while (mask != 0)
+        {
+            const ae_u32_t bit       = ae_bit_scan_reverse32(mask);
+            const ae_u8_t *candidate = block + bit;
+
+            if (!ae_memory_raw_compare_sse2(candidate + 1, needle + 1, middle))
+            {
+                return candidate;
+            }
+            mask &= ~((ae_u32_t)1 << bit);
+        }
+    }
+    return ae_memory_raw_find_from_end_generic(haystack,
+                                               end + needle_size - 1,
+                                               needle,
+                                               needle_size);
+}
+
+/**
+ * @brief Возвращает маску байт блока, входящих в элементы, равные @c needle.
+ */
+AE_ATTRIBUTE(TARGET)("sse2")
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_u32_t
+ae_memory_raw_match_sse2(const ae_u8_t *block, __m128i needle, ae_usize_t width)
+{
+    const __m128i xmm0 = _mm_loadu_si128(ae_ptr_cast(const __m128i, block));
+
+    switch (width)
+    {
+        case 1:
+            return (ae_u32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(xmm0, needle));
+        case 2:
+            return (ae_u32_t)_mm_movemask_epi8(_mm_cmpeq_epi16(xmm0, needle));
+        default:
+            return (ae_u32_t)_mm_movemask_epi8(_mm_cmpeq_epi32(xmm0, needle));
+    }
+}
+
+/**
+ * @brief Размножает значение элемента шириной @c width байт в SSE-регистр.
+ */
+AE_ATTRIBUTE(TARGET)("sse2")
+static AE_COMPILER_ATTRIBUTE_BUILTIN __m128i
+ae_memory_raw_broadcast_sse2(const ae_u8_t *value, ae_usize_t width)
+{
+    switch (width)
+    {
+        case 1:
+            return _mm_set1_epi8((char)value[0]);
+        case 2:
+            return _mm_set1_epi16((short)*ae_ptr_cast(const ae_u16_t, value));
+        default:
+            return _mm_set1_epi32((int)*ae_ptr_cast(const ae_u32_t, value));
+    }
+}
+
+/**
+ * @brief Ищет элемент шириной @c width байт блоками по 16 байт.
+ *
+ * Первый блок читается невыровненно, основная часть - блоками,
+ * выровненными на 16 байт, а последний блок перекрывает уже проверенные данные,
+ * в которых совпадений заведомо нет.
+ */
+AE_ATTRIBUTE(TARGET)("sse2")
+static AE_COMPILER_ATTRIBUTE_BUILTIN const ae_u8_t *
+ae_memory_raw_find_unit_sse2(const ae_u8_t *data,
+                             ae_usize_t     size,
+                             const ae_u8_t *value,
+                             ae_usize_t     width)
+{
+    if (size < 16)
+    {
+        return ae_memory_raw_find_unit_generic(data, size, value, width);
+    }
+
+    const __m128i    needle = ae_memory_raw_broadcast_sse2(value, width);
+    const ae_usize_t addr   = ae_ptr_to_addr(data);
+    ae_u32_t         mask   = ae_memory_raw_match_sse2(data, needle, width);
+
+    if (mask != 0)
+    {
+        return data + ae_bit_scan_forward32(mask);
+    }
+
+    /* Выравнивание возможно только без нарушения границ элементов. */
+    ae_usize_t pos = (addr & (width - 1)) ? 16 : 16 - (addr & 15);
+
+    for (; pos + 16 <= size; pos += 16)
+    {
+        mask = ae_memory_raw_match_sse2(data + pos, needle, width);
+        if (mask != 0)
+        {
+            return data + pos + ae_bit_scan_forward32(mask);
+        }
+    }
+
+    if (pos < size)
+    {
+        mask = ae_memory_raw_match_sse2(data + size - 16, needle, width);
+        if (mask != 0)
+        {
+            return data + size - 16 + ae_bit_scan_forward32(mask);
+        }
+    }
+    return nullptr;
+}
+
+AE_ATTRIBUTE(TARGET)("sse2")
+static const ae_u8_t *
+ae_memory_raw_find_byte_sse2(const ae_u8_t *data, ae_usize_t size, const ae_u8_t *value)
+{
+    return ae_memory_raw_find_unit_sse2(data, size, value, 1);
+}
+
+AE_ATTRIBUTE(TARGET)("sse2")
+static const ae_u8_t *
+ae_memory_raw_find_byte_from_end_sse2(const ae_u8_t *data, ae_usize_t size, const ae_u8_t *value)
+{
+    if (size < 16)
+    {
+        return ae_memory_raw_find_byte_from_end_generic(data, size, value);
+    }
+
+    const __m128i needle = _mm_set1_epi8((char)*value);
+    ae_u32_t      mask   = ae_memory_raw_match_sse2(data + size - 16, needle, 1);
+
+    if (mask != 0)
+    {
+        return data + size - 16 + ae_bit_scan_reverse32(mask);
+    }
+
+    ae_usize_t pos = size - ((ae_ptr_to_addr(data) + size) & 15);
+
+    for (; pos >= 16; pos -= 16)
+    {
+        mask = ae_memory_raw_match_sse2(data + pos - 16, needle, 1);
+        if (mask != 0)
+        {
+            return data + pos - 16 + ae_bit_scan_reverse32(mask);
+        }
+    }
+
+    if (pos > 0)
+    {
+        mask = ae_memory_raw_match_sse2(data, needle, 1);
+        if (mask != 0)
+        {
+            return data + ae_bit_scan_reverse32(mask);
+        }
+    }
+    return nullptr;
+}
+
+AE_ATTRIBUTE(TARGET)("sse2")
+static const ae_u8_t *
+ae_memory_raw_find_u16_sse2(const ae_u8_t *data, ae_usize_t size, const ae_u8_t *value)
+{
+    return ae_memory_raw_find_unit_sse2(data, size, value, 2);
+}
+
+AE_ATTRIBUTE(TARGET)("sse2")
+static const ae_u8_t *
+ae_memory_raw_find_u32_sse2(const ae_u8_t *data, ae_usize_t size, const ae_u8_t *value)
+{
+    return ae_memory_raw_find_unit_sse2(data, size, value, 4);
+}
+
+/**
+ * @brief Ищет нулевой элемент шириной @c width байт блоками по 16 байт.
+ *
+ * Все блоки, включая первый, выровнены на 16 байт и поэтому никогда
+ * не пересекают границу страницы: читаются только страницы, содержащие
+ * хотя бы один элемент строки. Совпадения до начала строки отбрасываются маской.
+ */
+AE_ATTRIBUTE(TARGET)("sse2")
+static AE_COMPILER_ATTRIBUTE_BUILTIN const ae_u8_t *
+ae_memory_raw_find_terminator_unit_sse2(const ae_u8_t *str, ae_usize_t width)
+{
+    const ae_usize_t offset = ae_ptr_to_addr(str) & 15;
+
+    /* Элементы, не выровненные на свою ширину, не совпадают с границами блоков. */
+    if (offset & (width - 1))
+    {
+        return ae_memory_raw_find_terminator_generic(str, width);
+    }
+
+    const __m128i  zero  = _mm_setzero_si128();
+    const ae_u8_t *block = str - offset;
+    ae_u32_t       mask  = ae_memory_raw_match_sse2(block, zero, width) & (~0u << offset);
+
+    while (mask == 0)
+    {
+        block += 16;
+        mask = ae_memory_raw_match_sse2(block, zero, width);
+    }
+    return block + ae_bit_scan_forward32(mask);
+}
+
+AE_ATTRIBUTE(TARGET)("sse2")
+AE_ATTRIBUTE(NO_SANITIZE_ADDRESS)
+static const ae_u8_t *
+ae_memory_raw_find_terminator_sse2(const ae_u8_t *str, ae_usize_t width)
+{
+    switch (width)
+    {
+        case 1:
+            return ae_memory_raw_find_terminator_unit_sse2(str, 1);
+        case 2:
+            return ae_memory_raw_find_terminator_unit_sse2(str, 2);
+        default:
+            return ae_memory_raw_find_terminator_unit_sse2(str, 4);
+    }
+}
+
+/**
+ * @brief Заполняет от 16 до 32 байт двумя перекрывающимися записями.
+ */
+AE_ATTRIBUTE(TARGET)("sse2")
+static AE_COMPILER_ATTRIBUTE_BUILTIN void
+ae_memory_raw_set_small_sse2(ae_u8_t *dst, ae_usize_t size, const ae_u8_t *unit, ae_usize_t period)
+{
+    const ae_usize_t tail_offset = size - 16;
+    const ae_u8_t   *tail_unit   = unit + (tail_offset & (period - 1));
+
+    __m128i head = _mm_loadu_si128(ae_ptr_cast(const __m128i, unit));
+    __m128i tail = _mm_loadu_si128(ae_ptr_cast(const __m128i, tail_unit));
+
+    _mm_storeu_si128(ae_ptr_cast(__m128i, dst), head);
+    _mm_storeu_si128(ae_ptr_cast(__m128i, (dst + tail_offset)), tail);
+}
+
+AE_ATTRIBUTE(TARGET)("sse2")
+static void
+ae_memory_raw_set_sse2(ae_u8_t       *dst,
+                       ae_usize_t     size,
+                       const ae_u8_t *unit,
+                       ae_usize_t     period,
+                       bool           non_temporal)
+{
+    if (size < 16)
+    {
+        ae_memory_raw_set_generic(dst, size, unit, period, non_temporal);
+        return;
+    }
+
+    /* Голова и хвост записываются невыровненно, основная часть - выровненными записями. */
+    ae_memory_raw_set_small_sse2(dst, size, unit, period);
+
+    ae_u8_t         *ptr   = dst + 16 - (ae_ptr_to_addr(dst) & 15);
+    const ae_u8_t   *end   = dst + size - 16;
+    const ae_usize_t phase = ae_ptr_to_addr_diff(ptr, dst) & (period - 1);
+    const __m128i    xmm0  = _mm_loadu_si128(ae_ptr_cast(const __m128i, (unit + phase)));
+
+    if (non_temporal)
+    {
+        for (; ptr < end; ptr += 16)
+        {
+            _mm_stream_si128(ae_ptr_cast(__m128i, ptr), xmm0);
+        }
+        _mm_sfence();
+    }
+    else
+    {
+        for (; ptr < end; ptr += 16)
+        {
+            _mm_store_si128(ae_ptr_cast(__m128i, ptr), xmm0);
+        }
+    }
+}
+/*
+ * Ядра поиска по множеству байт. Два или три байта ищутся сравнением блока
+ * с каждым из них. Для класса байт инструкция `pshufb` выбирает по младшей тетраде
+ * каждого байта элемент таблицы `low` или `high` (в зависимости от старшего бита),
+ * а по старшей тетраде - проверяемый бит этого элемента.
+ */
+
+/**
+ * @brief Подготавливает векторы множества байт: значения для сравнения
+ *        или таблицы класса вместе с таблицей битов.
+ */
+AE_ATTRIBUTE(TARGET)("ssse3")
+static AE_COMPILER_ATTRIBUTE_BUILTIN void
+ae_memory_raw_byte_set_load_ssse3(__m128i                        *vectors,
+                                  const ae_memory_raw_byte_set_t *set,
+                                  ae_memory_raw_byte_set_kind_t   kind)
+{
+    if (kind == AE_MEMORY_RAW_BYTE_SET_ANY2 || kind == AE_MEMORY_RAW_BYTE_SET_ANY3)
+    {
+        vectors[0] = _mm_set1_epi8((char)set->values[0]);
+        vectors[1] = _mm_set1_epi8((char)set->values[1]);
+        vectors[2] = _mm_set1_epi8((char)set->values[2]);
+    }
+    else
+    {
+        vectors[0] = _mm_loadu_si128(ae_ptr_cast(const __m128i, set->cls->low));
+        vectors[1] = _mm_loadu_si128(ae_ptr_cast(const __m128i, set->cls->high));
+        vectors[2] = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+    }
+}
+
+/**
+ * @brief Возвращает маску байт блока, входящих в множество (один бит на байт).
+ */
+AE_ATTRIBUTE(TARGET)("ssse3")
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_u32_t
+ae_memory_raw_match_set_ssse3(const ae_u8_t                *block,
+                              const __m128i                *vectors,
+                              ae_memory_raw_byte_set_kind_t kind)
+{
+    const __m128i xmm0 = _mm_loadu_si128(ae_ptr_cast(const __m128i, block));
+
+    if (kind == AE_MEMORY_RAW_BYTE_SET_ANY2 || kind == AE_MEMORY_RAW_BYTE_SET_ANY3)
+    {
+        __m128i hit =
+            _mm_or_si128(_mm_cmpeq_epi8(xmm0, vectors[0]), _mm_cmpeq_epi8(xmm0, vectors[1]));
+
+        if (kind == AE_MEMORY_RAW_BYTE_SET_ANY3)
+        {
+            hit = _mm_or_si128(hit, _mm_cmpeq_epi8(xmm0, vectors[2]));
+        }
+        return (ae_u32_t)_mm_movemask_epi8(hit);
+    }
+
+    const __m128i high   = _mm_xor_si128(xmm0, _mm_set1_epi8(-128));
+    const __m128i nibble = _mm_and_si128(_mm_srli_epi16(xmm0, 4), _mm_set1_epi8(0x0F));
+    const __m128i row    = _mm_or_si128(_mm_shuffle_epi8(vectors[0], xmm0),
+                                        _mm_shuffle_epi8(vectors[1], high));
+    const __m128i bit    = _mm_shuffle_epi8(vectors[2], nibble);
+    const __m128i hit    = _mm_and_si128(row, bit);
+
+    /* Байт не входит в класс, если проверяемый бит сброшен. */
+    const ae_u32_t miss =
+        (ae_u32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(hit, _mm_setzero_si128()));
+
+    return (kind == AE_MEMORY_RAW_BYTE_SET_CLASS) ? (~miss & 0xFFFF) : miss;
+}
+
+/**
+ * @brief Ищет первый байт из множества блоками по 16 байт
+ *        (см. `ae_memory_raw_find_unit_sse2`).
+ */
+AE_ATTRIBUTE(TARGET)("ssse3")
+static AE_COMPILER_ATTRIBUTE_BUILTIN const ae_u8_t *
+ae_memory_raw_scan_set_ssse3(const ae_u8_t                  *data,
+                             ae_usize_t                      size,
+                             const ae_memory_raw_byte_set_t *set,
+                             ae_memory_raw_byte_set_kind_t   kind)
+{
+    if (size < 16)
+    {
+        return ae_memory_raw_find_set_generic(data, size, set);
+    }
+
+    __m128i vectors[3];
+    ae_memory_raw_byte_set_load_ssse3(vectors, set, kind);
+
+    ae_u32_t mask = ae_memory_raw_match_set_ssse3(data, vectors, kind);
+    if (mask != 0)
+    {
+        return data + ae_bit_scan_forward32(mask);
+    }
+
+    ae_usize_t pos = 16 - (ae_ptr_to_addr(data) & 15);
+
+    for (; pos + 16 <= size; pos += 16)
+    {
+        mask = ae_memory_raw_match_set_ssse3(data + pos, vectors, kind);
+        if (mask != 0)
+        {
+            return data + pos + ae_bit_scan_forward32(mask);
+        }
+    }
+
+    if (pos < size)
+    {
+        mask = ae_memory_raw_match_set_ssse3(data + size - 16, vectors, kind);
+        if (mask != 0)
+        {
+            return data + size - 16 + ae_bit_scan_forward32(mask);
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Ищет последний байт из множества блоками по 16 байт
+ *        (см. `ae_memory_raw_find_byte_from_end_sse2`).
+ */
+AE_ATTRIBUTE(TARGET)("ssse3")
+static AE_COMPILER_ATTRIBUTE_BUILTIN const ae_u8_t *
+ae_memory_raw_scan_set_from_end_ssse3(const ae_u8_t                  *data,
+                                      ae_usize_t                      size,
+                                      const ae_memory_raw_byte_set_t *set,
+                                      ae_memory_raw_byte_set_kind_t   kind)
+{
+    if (size < 16)
+    {
+        return ae_memory_raw_find_set_from_end_generic(data, size, set);
+    }
+
+    __m128i vectors[3];
+    ae_memory_raw_byte_set_load_ssse3(vectors, set, kind);
+
+    ae_u32_t mask = ae_memory_raw_match_set_ssse3(data + size - 16, vectors, kind);
+    if (mask != 0)
+    {
+        return data + size - 16 + ae_bit_scan_reverse32(mask);
+    }
+
+    ae_usize_t pos = size - ((ae_ptr_to_addr(data) + size) & 15);
+
+    for (; pos >= 16; pos -= 16)
+    {
+        mask = ae_memory_raw_match_set_ssse3(data + pos - 16, vectors, kind);
+        if (mask != 0)
+        {
+            return data + pos - 16 + ae_bit_scan_reverse32(mask);
+        }
+    }
+
+    if (pos > 0)
+    {
+        mask = ae_memory_raw_match_set_ssse3(data, vectors, kind);
+        if (mask != 0)
+        {
+            return data + ae_bit_scan_reverse32(mask);
+        }
+    }
+    return nullptr;
+}
+
+AE_ATTRIBUTE(TARGET)("ssse3")
+static const ae_u8_t *
+ae_memory_raw_find_set_ssse3(const ae_u8_t                  *data,
+                             ae_usize_t                      size,
+                             const ae_memory_raw_byte_set_t *set)
+{
+    switch (set->kind)
+    {
+        case AE_MEMORY_RAW_BYTE_SET_ANY2:
+            return ae_memory_raw_scan_set_ssse3(data, size, set, AE_MEMORY_RAW_BYTE_SET_ANY2);
+        case AE_MEMORY_RAW_BYTE_SET_ANY3:
+            return ae_memory_raw_scan_set_ssse3(data, size, set, AE_MEMORY_RAW_BYTE_SET_ANY3);
+        case AE_MEMORY_RAW_BYTE_SET_CLASS:
+            return ae_memory_raw_scan_set_ssse3(data, size, set, AE_MEMORY_RAW_BYTE_SET_CLASS);
+        default:
+            return ae_memory_raw_scan_set_ssse3(data, size, set, AE_MEMORY_RAW_BYTE_SET_NOT_CLASS);
+    }
+}
+
+AE_ATTRIBUTE(TARGET)("ssse3")
+static const ae_u8_t *
+ae_memory_raw_find_set_from_end_ssse3(const ae_u8_t                  *data,
+                                      ae_usize_t                      size,
+                                      const ae_memory_raw_byte_set_t *set)
+{
+    switch (set->kind)
+    {
+        case AE_MEMORY_RAW_BYTE_SET_ANY2:
+            return ae_memory_raw_scan_set_from_end_ssse3(data,
+                                                         size,
+                                                         set,
+                                                         AE_MEMORY_RAW_BYTE_SET_ANY2);
+        case AE_MEMORY_RAW_BYTE_SET_ANY3:
+            return ae_memory_raw_scan_set_from_end_ssse3(data,
+                                                         size,
+                                                         set,
+                                                         AE_MEMORY_RAW_BYTE_SET_ANY3);
+        case AE_MEMORY_RAW_BYTE_SET_CLASS:
+            return ae_memory_raw_scan_set_from_end_ssse3(data,
+                                                         size,
+                                                         set,
+                                                         AE_MEMORY_RAW_BYTE_SET_CLASS);
+        default:
+            return ae_memory_raw_scan_set_from_end_ssse3(data,
+                                                         size,
+                                                         set,
+                                                         AE_MEMORY_RAW_BYTE_SET_NOT_CLASS);
+    }
+}
+
+/**
+ * @brief Строит маску байт из множества блоками по 16 байт;
+ *        остаток меньше 16 байт обрабатывается универсальным ядром.
+ */
+AE_ATTRIBUTE(TARGET)("ssse3")
+static ae_u64_t
+ae_memory_raw_match_set_mask_ssse3(const ae_u8_t                  *data,
+                                   ae_usize_t                      size,
+                                   const ae_memory_raw_byte_set_t *set)
+{
+    __m128i    vectors[3];
+    ae_u64_t   mask = 0;
+    ae_usize_t pos  = 0;
+
+    ae_memory_raw_byte_set_load_ssse3(vectors, set, set->kind);
+
+    for (; pos + 16 <= size; pos += 16)
+    {
+        mask |= (ae_u64_t)ae_memory_raw_match_set_ssse3(data + pos, vectors, set->kind) << pos;
+    }
+
+    if (pos < size)
+    {
+        mask |= ae_memory_raw_match_set_generic(data + pos, size - pos, set) << pos;
+    }
+    return mask;
+}
+
+/**
+ * @brief Меняет регистр латинских букв блоками по 16 байт.
+ *
+ * Диапазон букв сдвигается к началу знакового диапазона (-128),
+ * после чего принадлежность проверяется одним знаковым сравнением.
+ */
+AE_ATTRIBUTE(TARGET)("sse2")
+static void
+ae_memory_raw_case_sse2(ae_u8_t *dst, const ae_u8_t *src, ae_usize_t size, ae_u8_t first)
+{
+    const __m128i bias  = _mm_set1_epi8((char)(0x80 - first));
+    const __m128i limit = _mm_set1_epi8((char)(0x80 + m_memory_raw_case_count));
+    const __m128i bit   = _mm_set1_epi8((char)m_memory_raw_case_bit);
+
+    for (; size >= 16; dst += 16, src += 16, size -= 16)
+    {
+        const __m128i xmm0 = _mm_loadu_si128(ae_ptr_cast(const __m128i, src));
+        const __m128i mask = _mm_cmplt_epi8(_mm_add_epi8(xmm0, bias), limit);
+
+        _mm_storeu_si128(ae_ptr_cast(__m128i, dst),
+                         _mm_xor_si128(xmm0, _mm_and_si128(mask, bit)));
+    }
+
+    ae_memory_raw_case_generic(dst, src, size, first);
+}
+
+#endif // AE_CPU_FEATURE_KERNEL_SSE2
+
+/* -------------------------------------------------------------------------------------------- */
+/* Ядра AVX                                                                                     */
+/* -------------------------------------------------------------------------------------------- */
+
+#if AE_CPU_FEATURE_KERNEL_AVX
+/**
+ * @brief Копирует более 32 байт невременными записями по 32 байта
+ *        (см. `ae_memory_raw_copy_stream_sse2`).
+ */
+AE_ATTRIBUTE(TARGET)("avx")
+static AE_COMPILER_ATTRIBUTE_BUILTIN void
+ae_memory_raw_copy_stream_avx(ae_u8_t *dst, const ae_u8_t *src, ae_usize_t size)
+{
+    const __m256i head = _mm256_loadu_si256(ae_ptr_cast(const __m256i, src));
+    ae_usize_t    pos  = 32 - (ae_ptr_to_addr(dst) & 31);
+
+    for (; pos + 64 <= size; pos += 64)
+    {
+        _mm_prefetch(ae_ptr_cast(const char, (src + pos + AE_MEMORY_RAW_PREFETCH_DISTANCE)),
+                     _MM_HINT_NTA);
+
+        const __m256i ymm0 = _mm256_loadu_si256(ae_ptr_cast(const __m256i, (src + pos)));
+        const __m256i ymm1 = _mm256_loadu_si256(ae_ptr_cast(const __m256i, (src + pos + 32)));
+
+        _mm256_stream_si256(ae_ptr_cast(__m256i, (dst + pos)), ymm0);
+        _mm256_stream_si256(ae_ptr_cast(__m256i, (dst + pos + 32)), ymm1);
+    }
+    _mm_sfence();
+
+    ae_memory_raw_copy_rest_sse2(dst + pos, src + pos, size - pos);
+    _mm256_storeu_si256(ae_ptr_cast(__m256i, dst), head);
+}
+
+/**
+ * @brief Копирует более 32 байт невременными записями по 32 байта от конца к началу
+ *        (см. `ae_memory_raw_copy_from_end_stream_sse2`).
+ */
+AE_ATTRIBUTE(TARGET)("avx")
+static AE_COMPILER_ATTRIBUTE_BUILTIN void
+ae_memory_raw_copy_from_end_stream_avx(ae_u8_t *dst, const ae_u8_t *src, ae_usize_t size)
+{
+    const __m256i tail = _mm256_loadu_si256(ae_ptr_cast(const __m256i, (src + size - 32)));
+    ae_usize_t    pos  = size - ((ae_ptr_to_addr(dst) + size) & 31);
+
+    for (; pos >= 64; pos -= 64)
+    {
+        _mm_prefetch(ae_ptr_cast(const char, (src + pos - 64 - AE_MEMORY_RAW_PREFETCH_DISTANCE)),
+                     _MM_HINT_NTA);
+
+        const __m256i ymm0 = _mm256_loadu_si256(ae_ptr_cast(const __m256i, (src + pos - 64)));
+        const __m256i ymm1 = _mm256_loadu_si256(ae_ptr_cast(const __m256i, (src + pos - 32)));
+
+        _mm256_stream_si256(ae_ptr_cast(__m256i, (dst + pos - 64)), ymm0);
+        _mm256_stream_si256(ae_ptr_cast(__m256i, (dst + pos - 32)), ymm1);
+    }
+    _mm_sfence();
+
+    ae_memory_raw_copy_rest_from_end_sse2(dst, src, pos);
+    _mm256_storeu_si256(ae_ptr_cast(__m256i, (dst + size - 32)), tail);
+}
+
+/**
+ * @brief Копирует блоки по 32 байта (см. `ae_memory_raw_copy_sse2`).
+ */
+AE_ATTRIBUTE(TARGET)("avx")
+static void
+ae_memory_raw_copy_avx(ae_u8_t *dst, const ae_u8_t *src, ae_usize_t size, bool non_temporal)
+{
+    if (size <= 32)
+    {
+        ae_memory_raw_copy_small_sse2(dst, src, size);
+        return;
+    }
+
+    if (non_temporal)
+    {
+        ae_memory_raw_copy_stream_avx(dst, src, size);
+        return;
+    }
+
+    const ae_usize_t last = size - 32;
+    const __m256i    tail = _mm256_loadu_si256(ae_ptr_cast(const __m256i, (src + last)));
+
+    for (ae_usize_t pos = 0; pos < last; pos += 32)
+    {
+        __m256i ymm0 = _mm256_loadu_si256(ae_ptr_cast(const __m256i, (src + pos)));
+        _mm256_storeu_si256(ae_ptr_cast(__m256i, (dst + pos)), ymm0);
+    }
+    _mm256_storeu_si256(ae_ptr_cast(__m256i, (dst + last)), tail);
+}
+
+/**
+ * @brief Копирует блоки по 32 байта от конца к началу
+ *        (см. `ae_memory_raw_copy_from_end_sse2`).
+ */
+AE_ATTRIBUTE(TARGET)("avx")
+static void
+ae_memory_raw_copy_from_end_avx(ae_u8_t       *dst_end,
+                                const ae_u8_t *src_end,
+                                ae_usize_t     size,
+                                bool           non_temporal)
+{
+    ae_u8_t       *dst = dst_end - size;
+    const ae_u8_t *src = src_end - size;
+
+    if (size <= 32)
+    {
+        ae_memory_raw_copy_small_sse2(dst, src, size);
+        return;
+    }
+
+    if (non_temporal)
+    {
+        ae_memory_raw_copy_from_end_stream_avx(dst, src, size);
+        return;
+    }
+
+    const __m256i head = _mm256_loadu_si256(ae_ptr_cast(const __m256i, src));
+
+    for (ae_usize_t pos = size; pos > 32; pos -= 32)
+    {
+        __m256i ymm0 = _mm256_loadu_si256(ae_ptr_cast(const __m256i, (src + pos - 32)));
+        _mm256_storeu_si256(ae_ptr_cast(__m256i, (dst + pos - 32)), ymm0);
+    }
+    _mm256_storeu_si256(ae_ptr_cast(__m256i, dst), head);
+}
+
+AE_ATTRIBUTE(TARGET)("avx")
+static void
+ae_memory_raw_set_avx(ae_u8_t       *dst,
+                      ae_usize_t     size,
+                      const ae_u8_t *unit,
+                      ae_usize_t     period,
+                      bool           non_temporal)
+{
+    if (size < 32)
+    {
+        ae_memory_raw_set_sse2(dst, size, unit, period, non_temporal);
+        return;
+    }
+
+    const ae_usize_t tail_offset = size - 32;
+    const ae_u8_t   *tail_unit   = unit + (tail_offset & (period - 1));
+
+    __m128i head = _mm_loadu_si128(ae_ptr_cast(const __m128i, unit));
+    __m128i tail = _mm_loadu_si128(ae_ptr_cast(const __m128i, tail_unit));
+
+    _mm256_storeu_si256(ae_ptr_cast(__m256i, dst), _mm256_set_m128i(head, head));
+    _mm256_storeu_si256(ae_ptr_cast(__m256i, (dst + tail_offset)), _mm256_set_m128i(tail, tail));
+
+    ae_u8_t         *ptr   = dst + 32 - (ae_ptr_to_addr(dst) & 31);
+    const ae_u8_t   *end   = dst + tail_offset;
+    const ae_usize_t phase = ae_ptr_to_addr_diff(ptr, dst) & (period - 1);
+    const __m128i    xmm0  = _mm_loadu_si128(ae_ptr_cast(const __m128i, (unit + phase)));
+    const __m256i    ymm0  = _mm256_set_m128i(xmm0, xmm0);
+
+    if (non_temporal)
+    {
+        for (; ptr < end; ptr += 32)
+        {
+            _mm256_stream_si256(ae_ptr_cast(__m256i, ptr), ymm0);
+        }
+        _mm_sfence();
+    }
+    else
+    {
+        for (; ptr < end; ptr += 32)
+        {
+            _mm256_store_si256(ae_ptr_cast(__m256i, ptr), ymm0);
+        }
+    }
+}
+#endif // AE_CPU_FEATURE_KERNEL_AVX
+
+/* -------------------------------------------------------------------------------------------- */
+/* Ядра AVX2                                                                                    */
+/* -------------------------------------------------------------------------------------------- */
+
+#if AE_CPU_FEATURE_KERNEL_AVX2
+/**
+ * @brief Возвращает маску различающихся байт двух блоков по 32 байта.
+ */
+AE_ATTRIBUTE(TARGET)("avx2")
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_u32_t
+ae_memory_raw_diff_avx2(const ae_u8_t *lhs, const ae_u8_t *rhs)
+{
+    const __m256i ymm_lhs = _mm256_loadu_si256(ae_ptr_cast(const __m256i, lhs));
+    const __m256i ymm_rhs = _mm256_loadu_si256(ae_ptr_cast(const __m256i, rhs));
+    return ~(ae_u32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(ymm_lhs, ymm_rhs));
+}
+
+/**
+ * @brief Сравнивает блоки по 32 байта (см. `ae_memory_raw_compare_sse2`).
+ */
+AE_ATTRIBUTE(TARGET)("avx2")
+static const ae_u8_t *
+ae_memory_raw_compare_avx2(const ae_u8_t *lhs, const ae_u8_t *rhs, ae_usize_t size)
+{
+    if (size <= 32)
+    {
+        return ae_memory_raw_compare_small_sse2(lhs, rhs, size);
+    }
+
+    const ae_usize_t last = size - 32;
+    ae_u32_t         mask;
+
+    for (ae_usize_t pos = 0; pos < last; pos += 32)
+    {
+        mask = ae_memory_raw_diff_avx2(lhs + pos, rhs + pos);
+        if (mask != 0)
+        {
+            return lhs + pos + ae_bit_scan_forward32(mask);
+        }
+    }
+
+    mask = ae_memory_raw_diff_avx2(lhs + last, rhs + last);
+    return (mask != 0) ? lhs + last + ae_bit_scan_forward32(mask) : nullptr;
+}
+
+/**
+ * @brief Сравнивает блоки по 32 байта от конца к началу
+ *        (см. `ae_memory_raw_compare_from_end_sse2`).
+ */
+AE_ATTRIBUTE(TARGET)("avx2")
+static const ae_u8_t *
+ae_memory_raw_compare_from_end_avx2(const ae_u8_t *lhs_end,
+                                    const ae_u8_t *rhs_end,
+                                    ae_usize_t     size)
+{
+    const ae_u8_t *lhs = lhs_end - size;
+    const ae_u8_t *rhs = rhs_end - size;
+    ae_u32_t       mask;
+
+    if (size <= 32)
+    {
+        return ae_memory_raw_compare_small_from_end_sse2(lhs, rhs, size);
+    }
+
+    for (ae_usize_t pos = size; pos > 32; pos -= 32)
+    {
+        mask = ae_memory_raw_diff_avx2(lhs + pos - 32, rhs + pos - 32);
+        if (mask != 0)
+        {
+            return lhs + pos - 32 + ae_bit_scan_reverse32(mask);
+        }
+    }
+
+    mask = ae_memory_raw_diff_avx2(lhs, rhs);
+    return (mask != 0) ? lhs + ae_bit_scan_reverse32(mask) : nullptr;
+}
+
+/**
+ * @brief Возвращает маску различающихся без учета регистра байт двух блоков по 32 байта
+ *        (см. `ae_memory_raw_fold_case_sse2`).
+ */
+AE_ATTRIBUTE(TARGET)("avx2")
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_u32_t
+ae_memory_raw_diff_icase_avx2(const ae_u8_t *lhs, const ae_u8_t *rhs)
+{
+    const __m256i bias    = _mm256_set1_epi8((char)(0x80 - AE_ASCII_MAP_UPPERCASE_A));
+    const __m256i limit   = _mm256_set1_epi8((char)(0x80 + m_memory_raw_case_count));
+    const __m256i bit     = _mm256_set1_epi8((char)m_memory_raw_case_bit);
+    __m256i       ymm_lhs = _mm256_loadu_si256(ae_ptr_cast(const __m256i, lhs));
+    __m256i       ymm_rhs = _mm256_loadu_si256(ae_ptr_cast(const __m256i, rhs));
+
+    ymm_lhs = _mm256_or_si256(
+        ymm_lhs, _mm256_and_si256(_mm256_cmpgt_epi8(limit, _mm256_add_epi8(ymm_lhs, bias)), bit));
+    ymm_rhs = _mm256_or_si256(
+        ymm_rhs, _mm256_and_si256(_mm256_cmpgt_epi8(limit, _mm256_add_epi8(ymm_rhs, bias)), bit));
+
+    return ~(ae_u32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(ymm_lhs, ymm_rhs));
+}
+
+/**
+ * @brief Сравнивает без учета регистра блоками по 32 байта
+ *        (см. `ae_memory_raw_compare_icase_sse2`).
+ */
+AE_ATTRIBUTE(TARGET)("avx2")
+static const ae_u8_t *
+ae_memory_raw_compare_icase_avx2(const ae_u8_t *lhs, const ae_u8_t *rhs, ae_usize_t size)
+{
+    if (size <= 32)
+    {
+        return ae_memory_raw_compare_icase_small_sse2(lhs, rhs, size);
+    }
+
+    const ae_usize_t last = size - 32;
+    ae_u32_t         mask;
+
+    for (ae_usize_t pos = 0; pos < last; pos += 32)
+    {
+        mask = ae_memory_raw_diff_icase_avx2(lhs + pos, rhs + pos);
+        if (mask != 0)
+        {
+            return lhs + pos + ae_bit_scan_forward32(mask);
+        }
+    }
+
+    mask = ae_memory_raw_diff_icase_avx2(lhs + last, rhs + last);
+    return (mask != 0) ? lhs + last + ae_bit_scan_forward32(mask) : nullptr;
+}
+
+/**
+ * @brief Проверяет блоки на различие по 32 байта (см. `ae_memory_raw_differ_sse2`).
+ */
+AE_ATTRIBUTE(TARGET)("avx2")
+static bool
+ae_memory_raw_differ_avx2(const ae_u8_t *lhs, const ae_u8_t *rhs, ae_usize_t size)
+{
+    if (size < 32)
+    {
+        return ae_memory_raw_differ_sse2(lhs, rhs, size);
+    }
+
+    const ae_usize_t last = size - 32;
+    __m256i acc = _mm256_xor_si256(_mm256_loadu_si256(ae_ptr_cast(const __m256i, (lhs + last))),
+                                   _mm256_loadu_si256(ae_ptr_cast(const __m256i, (rhs + last))));
+
+    for (ae_usize_t pos = 0; pos < last; pos += 32)
+    {
+        const __m256i ymm0 = _mm256_loadu_si256(ae_ptr_cast(const __m256i, (lhs + pos)));
+        const __m256i ymm1 = _mm256_loadu_si256(ae_ptr_cast(const __m256i, (rhs + pos)));
+        acc                = _mm256_or_si256(acc, _mm256_xor_si256(ymm0, ymm1));
+    }
+    return !_mm256_testz_si256(acc, acc);
+}
+
+/**
+ * @brief Складывает четыре 64-битные суммы, полученные инструкцией `vpsadbw`.
+ */
+AE_ATTRIBUTE(TARGET)("avx2")
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_usize_t
+ae_memory_raw_sad_sum_avx2(__m256i sad)
+{
+    const __m128i sum = _mm_add_epi64(_mm256_castsi256_si128(sad),
+                                      _mm256_extracti128_si256(sad, 1));
+    return ae_memory_raw_sad_sum_sse2(sum);
+}
+
+/**
+ * @brief Подсчитывает байты, равные @c value, блоками по 32 байта
+ *        (см. `ae_memory_raw_count_byte_sse2`).
+ */
+AE_ATTRIBUTE(TARGET)("avx2")
+static ae_usize_t
+ae_memory_raw_count_byte_avx2(const ae_u8_t *data, ae_usize_t size, ae_u8_t value)
+{
+    const __m256i needle = _mm256_set1_epi8((char)value);
+    const __m256i zero   = _mm256_setzero_si256();
+    ae_usize_t    count  = 0;
+
+    while (size >= 32)
+    {
+        const ae_usize_t blocks = (size / 32 < 255) ? size / 32 : 255;
+        __m256i          acc    = zero;
+
+        for (ae_usize_t i = 0; i < blocks; ++i, data += 32)
+        {
+            const __m256i ymm0 = _mm256_loadu_si256(ae_ptr_cast(const __m256i, data));
+            acc                = _mm256_sub_epi8(acc, _mm256_cmpeq_epi8(ymm0, needle));
+        }
+
+        size -= blocks * 32;
+        count += ae_memory_raw_sad_sum_avx2(_mm256_sad_epu8(acc, zero));
+    }
+    return count + ae_memory_raw_count_byte_sse2(data, size, value);
+}
+
+/**
+ * @brief Ищет первый ненулевой байт, проверяя по 128 байт за раз
+ *        (см. `ae_memory_raw_find_nonzero_sse2`).
+ */
+AE_ATTRIBUTE(TARGET)("avx2")
+static const ae_u8_t *
+ae_memory_raw_find_nonzero_avx2(const ae_u8_t *data, ae_usize_t size)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    ae_usize_t    pos  = 0;
+
+    for (; pos + 128 <= size; pos += 128)
+    {
+        const __m256i ymm0 = _mm256_loadu_si256(ae_ptr_cast(const __m256i, (data + pos)));
+        const __m256i ymm1 = _mm256_loadu_si256(ae_ptr_cast(const __m256i, (data + pos + 32)));
+        const __m256i ymm2 = _mm256_loadu_si256(ae_ptr_cast(const __m256i, (data + pos + 64)));
+        const __m256i ymm3 = _mm256_loadu_si256(ae_ptr_cast(const __m256i, (data + pos + 96)));
+        const __m256i acc =
+            _mm256_or_si256(_mm256_or_si256(ymm0, ymm1), _mm256_or_si256(ymm2, ymm3));
+
+        if (!_mm256_testz_si256(acc, acc))
+        {
+            break;
+        }
+    }
+
+    for (; pos + 32 <= size; pos += 32)
+    {
+        const __m256i  ymm0 = _mm256_loadu_si256(ae_ptr_cast(const __m256i, (data + pos)));
+        const ae_u32_t mask = ~(ae_u32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(ymm0, zero));
+
+        if (mask != 0)
+        {
+            return data + pos + ae_bit_scan_forward32(mask);
+        }
+    }
+    return ae_memory_raw_find_nonzero_sse2(data + pos, size - pos);
+}
+
+/**
+ * @brief Ищет первый байт вне диапазона ASCII, проверяя по 128 байт за раз
+ *        (см. `ae_memory_raw_find_non_ascii_sse2`).
+ */
+AE_ATTRIBUTE(TARGET)("avx2")
+static const ae_u8_t *
+ae_memory_raw_find_non_ascii_avx2(const ae_u8_t *data, ae_usize_t size)
+{
+    ae_usize_t pos = 0;
+
+    for (; pos + 128 <= size; pos += 128)
+    {
+        const __m256i ymm0 = _mm256_loadu_si256(ae_ptr_cast(const __m256i, (data + pos)));
+        const __m256i ymm1 = _mm256_loadu_si256(ae_ptr_cast(const __m256i, (data + pos + 32)));
+        const __m256i ymm2 = _mm256_loadu_si256(ae_ptr_cast(const __m256i, (data + pos + 64)));
+        const __m256i ymm3 = _mm256_loadu_si256(ae_ptr_cast(const __m256i, (data + pos + 96)));
+        const __m256i acc =
+            _mm256_or_si256(_mm256_or_si256(ymm0, ymm1), _mm256_or_si256(ymm2, ymm3));
+
+        if (_mm256_movemask_epi8(acc) != 0)
+        {
+            break;
+        }
+    }
+
+    for (; pos + 32 <= size; pos += 32)
+    {
+        const __m256i  ymm0 = _mm256_loadu_si256(ae_ptr_cast(const __m256i, (data + pos)));
+        const ae_u32_t mask = (ae_u32_t)_mm256_movemask_epi8(ymm0);
+
+        if (mask != 0)
+        {
+            return data + pos + ae_bit_scan_forward32(mask);
+        }
+    }
+    return ae_memory_raw_find_non_ascii_sse2(data + pos, size - pos);
+}
+
+/**
+ * @brief Подсчитывает установленные биты блоками по 32 байта
+ *        (см. `ae_memory_raw_popcount_ssse3`).
+ */
+AE_ATTRIBUTE(TARGET)("avx2")
+static ae_usize_t
+ae_memory_raw_popcount_avx2(const ae_u8_t *data, ae_usize_t size)
+{
+    const __m256i lookup = _mm256_broadcastsi128_si256(
+        _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4));
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    const __m256i zero   = _mm256_setzero_si256();
+    ae_usize_t    count  = 0;
+
+    while (size >= 32)
+    {
+        const ae_usize_t blocks = (size / 32 < 31) ? size / 32 : 31;
+        __m256i          acc    = zero;
+
+        for (ae_usize_t i = 0; i < blocks; ++i, data += 32)
+        {
+            const __m256i ymm0 = _mm256_loadu_si256(ae_ptr_cast(const __m256i, data));
+            const __m256i lo   = _mm256_and_si256(ymm0, nibble);
+            const __m256i hi   = _mm256_and_si256(_mm256_srli_epi16(ymm0, 4), nibble);
+
+            acc = _mm256_add_epi8(acc, _mm256_shuffle_epi8(lookup, lo));
+            acc = _mm256_add_epi8(acc, _mm256_shuffle_epi8(lookup, hi));
+        }
+
+        size -= blocks * 32;
+        count += ae_memory_raw_sad_sum_avx2(_mm256_sad_epu8(acc, zero));
+    }
+    return count + ae_memory_raw_popcount_ssse3(data, size);
+}
+
+AE_ATTRIBUTE(TARGET)("avx2")
+static const ae_u8_t *
+ae_memory_raw_find_avx2(const ae_u8_t *haystack,
+                        ae_usize_t     haystack_size,
+                        const ae_u8_t *needle,
+                        ae_usize_t     needle_size)
+{
+    const __m256i    first  = _mm256_set1_epi8((char)needle[0]);
+    const __m256i    last   = _mm256_set1_epi8((char)needle[needle_size - 1]);
+    const ae_usize_t middle = ae_memory_raw_find_middle_size(needle_size);
+    ae_usize_t       i      = 0;
+
+    for (; i + needle_size + 31 <= haystack_size; i += 32)
+    {
+        const ae_u8_t *block      = haystack + i;
+        const ae_u8_t *block_last = block + needle_size - 1;
+
+        __m256i  ymm_first = _mm256_loadu_si256(ae_ptr_cast(const __m256i, block));
+        __m256i  ymm_last  = _mm256_loadu_si256(ae_ptr_cast(const __m256i, block_last));
+        ae_u32_t mask      = (ae_u32_t)_mm256_movemask_epi8(_mm256_and_si256(
+            _mm256_cmpeq_epi8(ymm_first, first), _mm256_cmpeq_epi8(ymm_last, last)));
+
+        for (; mask != 0; mask &= mask - 1)
+        {
+            const ae_u8_t *candidate = block + ae_bit_scan_forward32(mask);
+            if (!ae_memory_raw_compare_avx2(candidate + 1, needle + 1, middle))
+            {
+                return candidate;
+            }
+        }
+    }
+    return ae_memory_raw_find_sse2(haystack + i, haystack_size - i, needle, needle_size);
+}
+
+AE_ATTRIBUTE(TARGET)("avx2")
+static const ae_u8_t *
+ae_memory_raw_find_from_end_avx2(const ae_u8_t *haystack,
+                                 ae_usize_t     haystack_size,
+                                 const ae_u8_t *needle,
+                                 ae_usize_t     needle_size)
+{
+    const __m256i    first  = _mm256_set1_epi8((char)needle[0]);
+    const __m256i    last   = _mm256_set1_epi8((char)needle[needle_size - 1]);
+    const ae_usize_t middle = ae_memory_raw_find_middle_size(needle_size);
+    ae_usize_t       end    = haystack_size - needle_size + 1;
+
+    for (; end >= 32; end -= 32)
+    {
+        const ae_u8_t *block      = haystack + end - 32;
+        const ae_u8_t *block_last = block + needle_size - 1;
+
+        __m256i  ymm_first = _mm256_loadu_si256(ae_ptr_cast(const __m256i, block));
+        __m256i  ymm_last  = _mm256_loadu_si256(ae_ptr_cast(const __m256i, block_last));
+        ae_u32_t mask      = (ae_u32_t)_mm256_movemask_epi8(_mm256_and_si256(
+            _mm256_cmpeq_epi8(ymm_first, first), _mm256_cmpeq_epi8(ymm_last, last)));
+
+        while (mask != 0)
+        {
+            const ae_u32_t bit       = ae_bit_scan_reverse32(mask);
+            const ae_u8_t *candidate = block + bit;
+
+            if (!ae_memory_raw_compare_avx2(candidate + 1, needle + 1, middle))
+            {
+                return candidate;
+            }
+            mask &= ~((ae_u32_t)1 << bit);
+        }
+    }
+    return ae_memory_raw_find_from_end_sse2(haystack, end + needle_size - 1, needle, needle_size);
+}
+
+/**
+ * @brief Возвращает маску байт блока, входящих в элементы, равные @c needle.
+ */
+AE_ATTRIBUTE(TARGET)("avx2")
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_u32_t
+ae_memory_raw_match_avx2(const ae_u8_t *block, __m256i needle, ae_usize_t width)
+{
+    const __m256i ymm0 = _mm256_loadu_si256(ae_ptr_cast(const __m256i, block));
+
+    switch (width)
+    {
+        case 1:
+            return (ae_u32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(ymm0, needle));
+        case 2:
+            return (ae_u32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi16(ymm0, needle));
+        default:
+            return (ae_u32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi32(ymm0, needle));
+    }
+}
+
+/**
+ * @brief Ищет элемент шириной @c width байт блоками по 32 байта
+ *        (см. `ae_memory_raw_find_unit_sse2`).
+ */
+AE_ATTRIBUTE(TARGET)("avx2")
+static AE_COMPILER_ATTRIBUTE_BUILTIN const ae_u8_t *
+ae_memory_raw_find_unit_avx2(const ae_u8_t *data,
+                             ae_usize_t     size,
+                             const ae_u8_t *value,
+                             ae_usize_t     width)
+{
+    if (size < 32)
+    {
+        return ae_memory_raw_find_unit_sse2(data, size, value, width);
+    }
+
+    const __m128i    xmm0   = ae_memory_raw_broadcast_sse2(value, width);
+    const __m256i    needle = _mm256_broadcastsi128_si256(xmm0);
+    const ae_usize_t addr   = ae_ptr_to_addr(data);
+    ae_u32_t         mask   = ae_memory_raw_match_avx2(data, needle, width);
+
+    if (mask != 0)
+    {
+        return data + ae_bit_scan_forward32(mask);
+    }
+
+    ae_usize_t pos = (addr & (width - 1)) ? 32 : 32 - (addr & 31);
+
+    for (; pos + 32 <= size; pos += 32)
+    {
+        mask = ae_memory_raw_match_avx2(data + pos, needle, width);
+        if (mask != 0)
+        {
+            return data + pos + ae_bit_scan_forward32(mask);
+        }
+    }
+
+    if (pos < size)
+    {
+        mask = ae_memory_raw_match_avx2(data + size - 32, needle, width);
+        if (mask != 0)
+        {
+            return data + size - 32 + ae_bit_scan_forward32(mask);
+        }
+    }
+    return nullptr;
+}
+
+AE_ATTRIBUTE(TARGET)("avx2")
+static const ae_u8_t *
+ae_memory_raw_find_byte_avx2(const ae_u8_t *data, ae_usize_t size, const ae_u8_t *value)
+{
+    return ae_memory_raw_find_unit_avx2(data, size, value, 1);
+}
+
+AE_ATTRIBUTE(TARGET)("avx2")
+static const ae_u8_t *
+ae_memory_raw_find_byte_from_end_avx2(const ae_u8_t *data, ae_usize_t size, const ae_u8_t *value)
+{
+    if (size < 32)
+    {
+        return ae_memory_raw_find_byte_from_end_sse2(data, size, value);
+    }
+
+    const __m256i needle = _mm256_set1_epi8((char)*value);
+    ae_u32_t      mask   = ae_memory_raw_match_avx2(data + size - 32, needle, 1);
+
+    if (mask != 0)
+    {
+        return data + size - 32 + ae_bit_scan_reverse32(mask);
+    }
+
+    ae_usize_t pos = size - ((ae_ptr_to_addr(data) + size) & 31);
+
+    for (; pos >= 32; pos -= 32)
+    {
+        mask = ae_memory_raw_match_avx2(data + pos - 32, needle, 1);
+        if (mask != 0)
+        {
+            return data + pos - 32 + ae_bit_scan_reverse32(mask);
+        }
+    }
+
+    if (pos > 0)
+    {
+        mask = ae_memory_raw_match_avx2(data, needle, 1);
+        if (mask != 0)
+        {
+            return data + ae_bit_scan_reverse32(mask);
+        }
+    }
+    return nullptr;
+}
+
+AE_ATTRIBUTE(TARGET)("avx2")
+static const ae_u8_t *
+ae_memory_raw_find_u16_avx2(const ae_u8_t *data, ae_usize_t size, const ae_u8_t *value)
+{
+    return ae_memory_raw_find_unit_avx2(data, size, value, 2);
+}
+
+AE_ATTRIBUTE(TARGET)("avx2")
+static const ae_u8_t *
+ae_memory_raw_find_u32_avx2(const ae_u8_t *data, ae_usize_t size, const ae_u8_t *value)
+{
+    return ae_memory_raw_find_unit_avx2(data, size, value, 4);
+}
+
+/**
+ * @brief Ищет нулевой элемент шириной @c width байт блоками по 32 байта,
+ *        выровненными на 32 байта (см. `ae_memory_raw_find_terminator_unit_sse2`).
+ */
+AE_ATTRIBUTE(TARGET)("avx2")
+static AE_COMPILER_ATTRIBUTE_BUILTIN const ae_u8_t *
+ae_memory_raw_find_terminator_unit_avx2(const ae_u8_t *str, ae_usize_t width)
+{
+    const ae_usize_t offset = ae_ptr_to_addr(str) & 31;
+
+    if (offset & (width - 1))
+    {
+        return ae_memory_raw_find_terminator_generic(str, width);
+    }
+
+    const __m256i  zero  = _mm256_setzero_si256();
+    const ae_u8_t *block = str - offset;
+    ae_u32_t       mask  = ae_memory_raw_match_avx2(block, zero, width) & (~0u << offset);
+
+    while (mask == 0)
+    {
+        block += 32;
+        mask = ae_memory_raw_match_avx2(block, zero, width);
+    }
+    return block + ae_bit_scan_forward32(mask);
+}
+
+AE_ATTRIBUTE(TARGET)("avx2")
+AE_ATTRIBUTE(NO_SANITIZE_ADDRESS)
+static const ae_u8_t *
+ae_memory_raw_find_terminator_avx2(const ae_u8_t *str, ae_usize_t width)
+{
+    switch (width)
+    {
+        case 1:
+            return ae_memory_raw_find_terminator_unit_avx2(str, 1);
+        case 2:
+            return ae_memory_raw_find_terminator_unit_avx2(str, 2);
+        default:
+            return ae_memory_raw_find_terminator_unit_avx2(str, 4);
+    }
+}
+/**
+ * @brief Подготавливает векторы множества байт для ядер AVX2
+ *        (см. `ae_memory_raw_byte_set_load_ssse3`).
+ */
+AE_ATTRIBUTE(TARGET)("avx2")
+static AE_COMPILER_ATTRIBUTE_BUILTIN void
+ae_memory_raw_byte_set_load_avx2(__m256i                        *vectors,
+                                 const ae_memory_raw_byte_set_t *set,
+                                 ae_memory_raw_byte_set_kind_t   kind)
+{
+    __m128i xmm[3];
+    ae_memory_raw_byte_set_load_ssse3(xmm, set, kind);
+
+    /* Инструкция `vpshufb` работает внутри 128-битных половин, поэтому таблицы дублируются. */
+    vectors[0] = _mm256_broadcastsi128_si256(xmm[0]);
+    vectors[1] = _mm256_broadcastsi128_si256(xmm[1]);
+    vectors[2] = _mm256_broadcastsi128_si256(xmm[2]);
+}
+
+/**
+ * @brief Возвращает маску байт блока, входящих в множество (один бит на байт).
+ */
+AE_ATTRIBUTE(TARGET)("avx2")
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_u32_t
+ae_memory_raw_match_set_avx2(const ae_u8_t                *block,
+                             const __m256i                *vectors,
+                             ae_memory_raw_byte_set_kind_t kind)
+{
+    const __m256i ymm0 = _mm256_loadu_si256(ae_ptr_cast(const __m256i, block));
+
+    if (kind == AE_MEMORY_RAW_BYTE_SET_ANY2 || kind == AE_MEMORY_RAW_BYTE_SET_ANY3)
+    {
+        __m256i hit = _mm256_or_si256(_mm256_cmpeq_epi8(ymm0, vectors[0]),
+                                      _mm256_cmpeq_epi8(ymm0, vectors[1]));
+
+        if (kind == AE_MEMORY_RAW_BYTE_SET_ANY3)
+        {
+            hit = _mm256_or_si256(hit, _mm256_cmpeq_epi8(ymm0, vectors[2]));
+        }
+        return (ae_u32_t)_mm256_movemask_epi8(hit);
+    }
+
+    const __m256i high   = _mm256_xor_si256(ymm0, _mm256_set1_epi8(-128));
+    const __m256i nibble = _mm256_and_si256(_mm256_srli_epi16(ymm0, 4), _mm256_set1_epi8(0x0F));
+    const __m256i row    = _mm256_or_si256(_mm256_shuffle_epi8(vectors[0], ymm0),
+                                           _mm256_shuffle_epi8(vectors[1], high));
+    const __m256i bit    = _mm256_shuffle_epi8(vectors[2], nibble);
+    const __m256i hit    = _mm256_and_si256(row, bit);
+
+    /* Байт не входит в класс, если проверяемый бит сброшен. */
+    const ae_u32_t miss =
+        (ae_u32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(hit, _mm256_setzero_si256()));
+
+    return (kind == AE_MEMORY_RAW_BYTE_SET_CLASS) ? ~miss : miss;
+}
+
+/**
+ * @brief Ищет первый байт из множества блоками по 32 байта
+ *        (см. `ae_memory_raw_find_unit_sse2`).
+ */
+AE_ATTRIBUTE(TARGET)("avx2")
+static AE_COMPILER_ATTRIBUTE_BUILTIN const ae_u8_t *
+ae_memory_raw_scan_set_avx2(const ae_u8_t                  *data,
+                            ae_usize_t                      size,
+                            const ae_memory_raw_byte_set_t *set,
+                            ae_memory_raw_byte_set_kind_t   kind)
+{
+    if (size < 32)
+    {
+        return ae_memory_raw_scan_set_ssse3(data, size, set, kind);
+    }
+
+    __m256i vectors[3];
+    ae_memory_raw_byte_set_load_avx2(vectors, set, kind);
+
+    ae_u32_t mask = ae_memory_raw_match_set_avx2(data, vectors, kind);
+    if (mask != 0)
+    {
+        return data + ae_bit_scan_forward32(mask);
+    }
+
+    ae_usize_t pos = 32 - (ae_ptr_to_addr(data) & 31);
+
+    for (; pos + 32 <= size; pos += 32)
+    {
+        mask = ae_memory_raw_match_set_avx2(data + pos, vectors, kind);
+        if (mask != 0)
+        {
+            return data + pos + ae_bit_scan_forward32(mask);
+        }
+    }
+
+    if (pos < size)
+    {
+        mask = ae_memory_raw_match_set_avx2(data + size - 32, vectors, kind);
+        if (mask != 0)
+        {
+            return data + size - 32 + ae_bit_scan_forward32(mask);
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Ищет последний байт из множества блоками по 32 байта
+ *        (см. `ae_memory_raw_find_byte_from_end_sse2`).
+ */
+AE_ATTRIBUTE(TARGET)("avx2")
+static AE_COMPILER_ATTRIBUTE_BUILTIN const ae_u8_t *
+ae_memory_raw_scan_set_from_end_avx2(const ae_u8_t                  *data,
+                                     ae_usize_t                      size,
+                                     const ae_memory_raw_byte_set_t *set,
+                                     ae_memory_raw_byte_set_kind_t   kind)
+{
+    if (size < 32)
+    {
+        return ae_memory_raw_scan_set_from_end_ssse3(data, size, set, kind);
+    }
+
+    __m256i vectors[3];
+    ae_memory_raw_byte_set_load_avx2(vectors, set, kind);
+
+    ae_u32_t mask = ae_memory_raw_match_set_avx2(data + size - 32, vectors, kind);
+    if (mask != 0)
+    {
+        return data + size - 32 + ae_bit_scan_reverse32(mask);
+    }
+
+    ae_usize_t pos = size - ((ae_ptr_to_addr(data) + size) & 31);
+
+    for (; pos >= 32; pos -= 32)
+    {
+        mask = ae_memory_raw_match_set_avx2(data + pos - 32, vectors, kind);
+        if (mask != 0)
+        {
+            return data + pos - 32 + ae_bit_scan_reverse32(mask);
+        }
+    }
+
+    if (pos > 0)
+    {
+        mask = ae_memory_raw_match_set_avx2(data, vectors, kind);
+        if (mask != 0)
+        {
+            return data + ae_bit_scan_reverse32(mask);
+        }
+    }
+    return nullptr;
+}
+
+AE_ATTRIBUTE(TARGET)("avx2")
+static const ae_u8_t *
+ae_memory_raw_find_set_avx2(const ae_u8_t                  *data,
+                            ae_usize_t                      size,
+                            const ae_memory_raw_byte_set_t *set)
+{
+    switch (set->kind)
+    {
+        case AE_MEMORY_RAW_BYTE_SET_ANY2:
+            return ae_memory_raw_scan_set_avx2(data, size, set, AE_MEMORY_RAW_BYTE_SET_ANY2);
+        case AE_MEMORY_RAW_BYTE_SET_ANY3:
+            return ae_memory_raw_scan_set_avx2(data, size, set, AE_MEMORY_RAW_BYTE_SET_ANY3);
+        case AE_MEMORY_RAW_BYTE_SET_CLASS:
+            return ae_memory_raw_scan_set_avx2(data, size, set, AE_MEMORY_RAW_BYTE_SET_CLASS);
+        default:
+            return ae_memory_raw_scan_set_avx2(data, size, set, AE_MEMORY_RAW_BYTE_SET_NOT_CLASS);
+    }
+}
+
+AE_ATTRIBUTE(TARGET)("avx2")
+static const ae_u8_t *
+ae_memory_raw_find_set_from_end_avx2(const ae_u8_t                  *data,
+                                     ae_usize_t                      size,
+                                     const ae_memory_raw_byte_set_t *set)
+{
+    switch (set->kind)
+    {
+        case AE_MEMORY_RAW_BYTE_SET_ANY2:
+            return ae_memory_raw_scan_set_from_end_avx2(data,
+                                                        size,
+                                                        set,
+                                                        AE_MEMORY_RAW_BYTE_SET_ANY2);
+        case AE_MEMORY_RAW_BYTE_SET_ANY3:
+            return ae_memory_raw_scan_set_from_end_avx2(data,
+                                                        size,
+                                                        set,
+                                                        AE_MEMORY_RAW_BYTE_SET_ANY3);
+        case AE_MEMORY_RAW_BYTE_SET_CLASS:
+            return ae_memory_raw_scan_set_from_end_avx2(data,
+                                                        size,
+                                                        set,
+                                                        AE_MEMORY_RAW_BYTE_SET_CLASS);
+        default:
+            return ae_memory_raw_scan_set_from_end_avx2(data,
+                                                        size,
+                                                        set,
+                                                        AE_MEMORY_RAW_BYTE_SET_NOT_CLASS);
+    }
+}
+
+/**
+ * @brief Строит маску байт из множества блоками по 32 байта
+ *        (см. `ae_memory_raw_match_set_mask_ssse3`).
+ */
+AE_ATTRIBUTE(TARGET)("avx2")
+static ae_u64_t
+ae_memory_raw_match_set_mask_avx2(const ae_u8_t                  *data,
+                                  ae_usize_t                      size,
+                                  const ae_memory_raw_byte_set_t *set)
+{
+    __m256i    vectors[3];
+    ae_u64_t   mask = 0;
+    ae_usize_t pos  = 0;
+
+    ae_memory_raw_byte_set_load_avx2(vectors, set, set->kind);
+
+    for (; pos + 32 <= size; pos += 32)
+    {
+        mask |= (ae_u64_t)ae_memory_raw_match_set_avx2(data + pos, vectors, set->kind) << pos;
+    }
+
+    if (pos < size)
+    {
+        mask |= ae_memory_raw_match_set_mask_ssse3(data + pos, size - pos, set) << pos;
+    }
+    return mask;
+}
+
+/**
+ * @brief Заменяет байты по таблице блоками по 32 байта.
+ *
+ * Таблица рассматривается как 16 строк по 16 байт. На шаге @c k индекс
+ * уменьшается на `16 * k`, а сложение с насыщением с `0x70` оставляет
+ * старший бит сброшенным только у байтов из строки @c k, поэтому `vpshufb`
+ * выбирает значения этой строки и обнуляет остальные байты.
+ */
+AE_ATTRIBUTE(TARGET)("avx2")
+static void
+ae_memory_raw_translate_avx2(ae_u8_t       *dst,
+                             const ae_u8_t *src,
+                             ae_usize_t     size,
+                             const ae_u8_t *table)
+{
+    const __m256i row_step = _mm256_set1_epi8(16);
+    const __m256i row_bias = _mm256_set1_epi8(0x70);
+    __m256i       rows[16];
+
+    for (ae_usize_t k = 0; k < 16; ++k)
+    {
+        rows[k] = _mm256_broadcastsi128_si256(
+            _mm_loadu_si128(ae_ptr_cast(const __m128i, (table + k * 16))));
+    }
+
+    for (; size >= 32; dst += 32, src += 32, size -= 32)
+    {
+        __m256i index = _mm256_loadu_si256(ae_ptr_cast(const __m256i, src));
+        __m256i ymm0  = _mm256_setzero_si256();
+
+        for (ae_usize_t k = 0; k < 16; ++k)
+        {
+            const __m256i row_index = _mm256_adds_epu8(index, row_bias);
+
+            ymm0  = _mm256_or_si256(ymm0, _mm256_shuffle_epi8(rows[k], row_index));
+            index = _mm256_sub_epi8(index, row_step);
+        }
+
+        _mm256_storeu_si256(ae_ptr_cast(__m256i, dst), ymm0);
+    }
+
+    ae_memory_raw_translate_generic(dst, src, size, table);
+}
+
+/**
+ * @brief Меняет регистр латинских букв блоками по 32 байта
+ *        (см. `ae_memory_raw_case_sse2`).
+ */
+AE_ATTRIBUTE(TARGET)("avx2")
+static void
+ae_memory_raw_case_avx2(ae_u8_t *dst, const ae_u8_t *src, ae_usize_t size, ae_u8_t first)
+{
+    const __m256i bias  = _mm256_set1_epi8((char)(0x80 - first));
+    const __m256i limit = _mm256_set1_epi8((char)(0x80 + m_memory_raw_case_count));
+    const __m256i bit   = _mm256_set1_epi8((char)m_memory_raw_case_bit);
+
+    for (; size >= 32; dst += 32, src += 32, size -= 32)
+    {
+        const __m256i ymm0 = _mm256_loadu_si256(ae_ptr_cast(const __m256i, src));
+        const __m256i mask = _mm256_cmpgt_epi8(limit, _mm256_add_epi8(ymm0, bias));
+
+        _mm256_storeu_si256(ae_ptr_cast(__m256i, dst),
+                            _mm256_xor_si256(ymm0, _mm256_and_si256(mask, bit)));
+    }
+
+    ae_memory_raw_case_sse2(dst, src, size, first);
+}
+
+#endif // AE_CPU_FEATURE_KERNEL_AVX2
+
+/* -------------------------------------------------------------------------------------------- */
+/* Ядра AVX-512                                                                                 */
+/* -------------------------------------------------------------------------------------------- */
+
+#if AE_CPU_FEATURE_KERNEL_AVX512
+/**
+ * @brief Возвращает маску первых @c size байт блока (от 0 до 64).
+ */
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static AE_COMPILER_ATTRIBUTE_BUILTIN __mmask64
+ae_memory_raw_head_mask_avx512(ae_usize_t size)
+{
+    return (size != 0) ? (~(ae_u64_t)0) >> (64 - size) : 0;
+}
+
+/**
+ * @brief Копирует более 64 байт невременными записями по 64 байта
+ *        (см. `ae_memory_raw_copy_stream_sse2`).
+ */
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static AE_COMPILER_ATTRIBUTE_BUILTIN void
+ae_memory_raw_copy_stream_avx512(ae_u8_t *dst, const ae_u8_t *src, ae_usize_t size)
+{
+    const __m512i head = _mm512_loadu_si512(ae_ptr_cast(const void, src));
+    ae_usize_t    pos  = 64 - (ae_ptr_to_addr(dst) & 63);
+
+    for (; pos + 64 <= size; pos += 64)
+    {
+        _mm_prefetch(ae_ptr_cast(const char, (src + pos + AE_MEMORY_RAW_PREFETCH_DISTANCE)),
+                     _MM_HINT_NTA);
+
+        const __m512i zmm0 = _mm512_loadu_si512(ae_ptr_cast(const void, (src + pos)));
+        _mm512_stream_si512(ae_ptr_cast(void, (dst + pos)), zmm0);
+    }
+    _mm_sfence();
+
+    const __mmask64 mask = ae_memory_raw_head_mask_avx512(size - pos);
+    _mm512_mask_storeu_epi8(dst + pos, mask, _mm512_maskz_loadu_epi8(mask, src + pos));
+    _mm512_storeu_si512(ae_ptr_cast(void, dst), head);
+}
+
+/**
+ * @brief Копирует более 64 байт невременными записями по 64 байта от конца к началу
+ *        (см. `ae_memory_raw_copy_from_end_stream_sse2`).
+ */
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static AE_COMPILER_ATTRIBUTE_BUILTIN void
+ae_memory_raw_copy_from_end_stream_avx512(ae_u8_t *dst, const ae_u8_t *src, ae_usize_t size)
+{
+    const __m512i tail = _mm512_loadu_si512(ae_ptr_cast(const void, (src + size - 64)));
+    ae_usize_t    pos  = size - ((ae_ptr_to_addr(dst) + size) & 63);
+
+    for (; pos >= 64; pos -= 64)
+    {
+        _mm_prefetch(ae_ptr_cast(const char, (src + pos - 64 - AE_MEMORY_RAW_PREFETCH_DISTANCE)),
+                     _MM_HINT_NTA);
+
+        const __m512i zmm0 = _mm512_loadu_si512(ae_ptr_cast(const void, (src + pos - 64)));
+        _mm512_stream_si512(ae_ptr_cast(void, (dst + pos - 64)), zmm0);
+    }
+    _mm_sfence();
+
+    const __mmask64 mask = ae_memory_raw_head_mask_avx512(pos);
+    _mm512_mask_storeu_epi8(dst, mask, _mm512_maskz_loadu_epi8(mask, src));
+    _mm512_storeu_si512(ae_ptr_cast(void, (dst + size - 64)), tail);
+}
+
+/**
+ * @brief Копирует блоки по 64 байта (см. `ae_memory_raw_copy_sse2`).
+ *
+ * Блоки до 64 байт копируются одной парой маскированных чтения и записи.
+ */
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static void
+ae_memory_raw_copy_avx512(ae_u8_t *dst, const ae_u8_t *src, ae_usize_t size, bool non_temporal)
+{
+    if (size <= 64)
+    {
+        const __mmask64 mask = ae_memory_raw_head_mask_avx512(size);
+        _mm512_mask_storeu_epi8(dst, mask, _mm512_maskz_loadu_epi8(mask, src));
+        return;
+    }
+
+    if (non_temporal)
+    {
+        ae_memory_raw_copy_stream_avx512(dst, src, size);
+        return;
+    }
+
+    const ae_usize_t last = size - 64;
+    const __m512i    tail = _mm512_loadu_si512(ae_ptr_cast(const void, (src + last)));
+
+    for (ae_usize_t pos = 0; pos < last; pos += 64)
+    {
+        __m512i zmm0 = _mm512_loadu_si512(ae_ptr_cast(const void, (src + pos)));
+        _mm512_storeu_si512(ae_ptr_cast(void, (dst + pos)), zmm0);
+    }
+    _mm512_storeu_si512(ae_ptr_cast(void, (dst + last)), tail);
+}
+
+/**
+ * @brief Копирует блоки по 64 байта от конца к началу
+ *        (см. `ae_memory_raw_copy_from_end_sse2`).
+ */
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static void
+ae_memory_raw_copy_from_end_avx512(ae_u8_t       *dst_end,
+                                   const ae_u8_t *src_end,
+                                   ae_usize_t     size,
+                                   bool           non_temporal)
+{
+    ae_u8_t       *dst = dst_end - size;
+    const ae_u8_t *src = src_end - size;
+
+    if (size <= 64)
+    {
+        const __mmask64 mask = ae_memory_raw_head_mask_avx512(size);
+        _mm512_mask_storeu_epi8(dst, mask, _mm512_maskz_loadu_epi8(mask, src));
+        return;
+    }
+
+    if (non_temporal)
+    {
+        ae_memory_raw_copy_from_end_stream_avx512(dst, src, size);
+        return;
+    }
+
+    const __m512i head = _mm512_loadu_si512(ae_ptr_cast(const void, src));
+
+    for (ae_usize_t pos = size; pos > 64; pos -= 64)
+    {
+        __m512i zmm0 = _mm512_loadu_si512(ae_ptr_cast(const void, (src + pos - 64)));
+        _mm512_storeu_si512(ae_ptr_cast(void, (dst + pos - 64)), zmm0);
+    }
+    _mm512_storeu_si512(ae_ptr_cast(void, dst), head);
+}
+
+/**
+ * @brief Возвращает маску различающихся байт среди байт блоков, выбранных маской @c mask.
+ */
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_u64_t
+ae_memory_raw_diff_avx512(const ae_u8_t *lhs, const ae_u8_t *rhs, __mmask64 mask)
+{
+    const __m512i zmm_lhs = _mm512_maskz_loadu_epi8(mask, lhs);
+    const __m512i zmm_rhs = _mm512_maskz_loadu_epi8(mask, rhs);
+    return _mm512_mask_cmpneq_epi8_mask(mask, zmm_lhs, zmm_rhs);
+}
+
+/**
+ * @brief Сравнивает блоки по 64 байта (см. `ae_memory_raw_compare_sse2`).
+ *
+ * Блоки до 64 байт сравниваются одним маскированным чтением.
+ */
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static const ae_u8_t *
+ae_memory_raw_compare_avx512(const ae_u8_t *lhs, const ae_u8_t *rhs, ae_usize_t size)
+{
+    ae_u64_t mask;
+
+    if (size <= 64)
+    {
+        mask = ae_memory_raw_diff_avx512(lhs, rhs, ae_memory_raw_head_mask_avx512(size));
+        return (mask != 0) ? lhs + ae_bit_scan_forward64(mask) : nullptr;
+    }
+
+    const ae_usize_t last = size - 64;
+
+    for (ae_usize_t pos = 0; pos < last; pos += 64)
+    {
+        mask = ae_memory_raw_diff_avx512(lhs + pos, rhs + pos, ~(__mmask64)0);
+        if (mask != 0)
+        {
+            return lhs + pos + ae_bit_scan_forward64(mask);
+        }
+    }
+
+    mask = ae_memory_raw_diff_avx512(lhs + last, rhs + last, ~(__mmask64)0);
+    return (mask != 0) ? lhs + last + ae_bit_scan_forward64(mask) : nullptr;
+}
+
+/**
+ * @brief Сравнивает блоки по 64 байта от конца к началу
+ *        (см. `ae_memory_raw_compare_from_end_sse2`).
+ */
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static const ae_u8_t *
+ae_memory_raw_compare_from_end_avx512(const ae_u8_t *lhs_end,
+                                      const ae_u8_t *rhs_end,
+                                      ae_usize_t     size)
+{
+    const ae_u8_t *lhs = lhs_end - size;
+    const ae_u8_t *rhs = rhs_end - size;
+    ae_u64_t       mask;
+
+    if (size <= 64)
+    {
+        mask = ae_memory_raw_diff_avx512(lhs, rhs, ae_memory_raw_head_mask_avx512(size));
+        return (mask != 0) ? lhs + ae_bit_scan_reverse64(mask) : nullptr;
+    }
+
+    for (ae_usize_t pos = size; pos > 64; pos -= 64)
+    {
+        mask = ae_memory_raw_diff_avx512(lhs + pos - 64, rhs + pos - 64, ~(__mmask64)0);
+        if (mask != 0)
+        {
+            return lhs + pos - 64 + ae_bit_scan_reverse64(mask);
+        }
+    }
+
+    mask = ae_memory_raw_diff_avx512(lhs, rhs, ~(__mmask64)0);
+    return (mask != 0) ? lhs + ae_bit_scan_reverse64(mask) : nullptr;
+}
+
+/**
+ * @brief Возвращает маску различающихся без учета регистра байт среди байт блоков,
+ *        выбранных маской @c mask (см. `ae_memory_raw_case_avx512`).
+ */
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_u64_t
+ae_memory_raw_diff_icase_avx512(const ae_u8_t *lhs, const ae_u8_t *rhs, __mmask64 mask)
+{
+    const __m512i   base      = _mm512_set1_epi8((char)AE_ASCII_MAP_UPPERCASE_A);
+    const __m512i   count     = _mm512_set1_epi8((char)m_memory_raw_case_count);
+    const __m512i   bit       = _mm512_set1_epi8((char)m_memory_raw_case_bit);
+    const __m512i   zmm_lhs   = _mm512_maskz_loadu_epi8(mask, lhs);
+    const __m512i   zmm_rhs   = _mm512_maskz_loadu_epi8(mask, rhs);
+    const __mmask64 upper_lhs = _mm512_cmplt_epu8_mask(_mm512_sub_epi8(zmm_lhs, base), count);
+    const __mmask64 upper_rhs = _mm512_cmplt_epu8_mask(_mm512_sub_epi8(zmm_rhs, base), count);
+    const __m512i   fold_lhs  = _mm512_or_si512(zmm_lhs, _mm512_maskz_mov_epi8(upper_lhs, bit));
+    const __m512i   fold_rhs  = _mm512_or_si512(zmm_rhs, _mm512_maskz_mov_epi8(upper_rhs, bit));
+
+    return _mm512_mask_cmpneq_epi8_mask(mask, fold_lhs, fold_rhs);
+}
+
+/**
+ * @brief Сравнивает без учета регистра блоками по 64 байта
+ *        (см. `ae_memory_raw_compare_avx512`).
+ */
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static const ae_u8_t *
+ae_memory_raw_compare_icase_avx512(const ae_u8_t *lhs, const ae_u8_t *rhs, ae_usize_t size)
+{
+    ae_u64_t mask;
+
+    if (size <= 64)
+    {
+        mask = ae_memory_raw_diff_icase_avx512(lhs, rhs, ae_memory_raw_head_mask_avx512(size));
+        return (mask != 0) ? lhs + ae_bit_scan_forward64(mask) : nullptr;
+    }
+
+    const ae_usize_t last = size - 64;
+
+    for (ae_usize_t pos = 0; pos < last; pos += 64)
+    {
+        mask = ae_memory_raw_diff_icase_avx512(lhs + pos, rhs + pos, ~(__mmask64)0);
+        if (mask != 0)
+        {
+            return lhs + pos + ae_bit_scan_forward64(mask);
+        }
+    }
+
+    mask = ae_memory_raw_diff_icase_avx512(lhs + last, rhs + last, ~(__mmask64)0);
+    return (mask != 0) ? lhs + last + ae_bit_scan_forward64(mask) : nullptr;
+}
+
+/**
+ * @brief Проверяет блоки на различие по 64 байта (см. `ae_memory_raw_differ_sse2`).
+ *
+ * Блоки до 64 байт проверяются одной парой маскированных чтений.
+ */
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static bool
+ae_memory_raw_differ_avx512(const ae_u8_t *lhs, const ae_u8_t *rhs, ae_usize_t size)
+{
+    if (size <= 64)
+    {
+        const __mmask64 mask = ae_memory_raw_head_mask_avx512(size);
+        return ae_memory_raw_diff_avx512(lhs, rhs, mask) != 0;
+    }
+
+    const ae_usize_t last = size - 64;
+    __m512i acc = _mm512_xor_si512(_mm512_loadu_si512(ae_ptr_cast(const void, (lhs + last))),
+                                   _mm512_loadu_si512(ae_ptr_cast(const void, (rhs + last))));
+
+    for (ae_usize_t pos = 0; pos < last; pos += 64)
+    {
+        const __m512i zmm0 = _mm512_loadu_si512(ae_ptr_cast(const void, (lhs + pos)));
+        const __m512i zmm1 = _mm512_loadu_si512(ae_ptr_cast(const void, (rhs + pos)));
+        acc                = _mm512_or_si512(acc, _mm512_xor_si512(zmm0, zmm1));
+    }
+    return _mm512_test_epi64_mask(acc, acc) != 0;
+}
+
+/**
+ * @brief Подсчитывает байты, равные @c value, блоками по 64 байта
+ *        (см. `ae_memory_raw_count_byte_sse2`).
+ *
+ * Остаток меньше 64 байт сравнивается под маской.
+ */
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static ae_usize_t
+ae_memory_raw_count_byte_avx512(const ae_u8_t *data, ae_usize_t size, ae_u8_t value)
+{
+    const __m512i needle = _mm512_set1_epi8((char)value);
+    const __m512i zero   = _mm512_setzero_si512();
+    __m512i       sum    = zero;
+
+    while (size >= 64)
+    {
+        const ae_usize_t blocks = (size / 64 < 255) ? size / 64 : 255;
+        __m512i          acc    = zero;
+
+        for (ae_usize_t i = 0; i < blocks; ++i, data += 64)
+        {
+            const __m512i   zmm0  = _mm512_loadu_si512(ae_ptr_cast(const void, data));
+            const __mmask64 equal = _mm512_cmpeq_epi8_mask(zmm0, needle);
+
+            acc = _mm512_sub_epi8(acc, _mm512_movm_epi8(equal));
+        }
+
+        size -= blocks * 64;
+        sum = _mm512_add_epi64(sum, _mm512_sad_epu8(acc, zero));
+    }
+
+    const __mmask64 mask  = ae_memory_raw_head_mask_avx512(size);
+    const __m512i   zmm0  = _mm512_maskz_loadu_epi8(mask, data);
+    const __mmask64 equal = _mm512_mask_cmpeq_epi8_mask(mask, zmm0, needle);
+    const __m512i   tail  = _mm512_sub_epi8(zero, _mm512_movm_epi8(equal));
+
+    sum = _mm512_add_epi64(sum, _mm512_sad_epu8(tail, zero));
+    return (ae_usize_t)_mm512_reduce_add_epi64(sum);
+}
+
+/**
+ * @brief Ищет первый ненулевой байт, проверяя по 256 байт за раз
+ *        (см. `ae_memory_raw_find_nonzero_sse2`).
+ *
+ * Остаток меньше 64 байт загружается под маской с заполнением нулями.
+ */
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static const ae_u8_t *
+ae_memory_raw_find_nonzero_avx512(const ae_u8_t *data, ae_usize_t size)
+{
+    ae_usize_t pos = 0;
+
+    for (; pos + 256 <= size; pos += 256)
+    {
+        const __m512i zmm0 = _mm512_loadu_si512(ae_ptr_cast(const void, (data + pos)));
+        const __m512i zmm1 = _mm512_loadu_si512(ae_ptr_cast(const void, (data + pos + 64)));
+        const __m512i zmm2 = _mm512_loadu_si512(ae_ptr_cast(const void, (data + pos + 128)));
+        const __m512i zmm3 = _mm512_loadu_si512(ae_ptr_cast(const void, (data + pos + 192)));
+        const __m512i acc =
+            _mm512_or_si512(_mm512_or_si512(zmm0, zmm1), _mm512_or_si512(zmm2, zmm3));
+
+        if (_mm512_test_epi64_mask(acc, acc) != 0)
+        {
+            break;
+        }
+    }
+
+    for (; pos < size; pos += 64)
+    {
+        const ae_usize_t left    = size - pos;
+        const __mmask64  mask    = ae_memory_raw_head_mask_avx512((left < 64) ? left : 64);
+        const __m512i    zmm0    = _mm512_maskz_loadu_epi8(mask, data + pos);
+        const ae_u64_t   nonzero = _mm512_test_epi8_mask(zmm0, zmm0);
+
+        if (nonzero != 0)
+        {
+            return data + pos + ae_bit_scan_forward64(nonzero);
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Ищет первый байт вне диапазона ASCII, проверяя по 256 байт за раз
+ *        (см. `ae_memory_raw_find_non_ascii_sse2`).
+ *
+ * Остаток меньше 64 байт загружается под маской с заполнением нулями.
+ */
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static const ae_u8_t *
+ae_memory_raw_find_non_ascii_avx512(const ae_u8_t *data, ae_usize_t size)
+{
+    ae_usize_t pos = 0;
+
+    for (; pos + 256 <= size; pos += 256)
+    {
+        const __m512i zmm0 = _mm512_loadu_si512(ae_ptr_cast(const void, (data + pos)));
+        const __m512i zmm1 = _mm512_loadu_si512(ae_ptr_cast(const void, (data + pos + 64)));
+        const __m512i zmm2 = _mm512_loadu_si512(ae_ptr_cast(const void, (data + pos + 128)));
+        const __m512i zmm3 = _mm512_loadu_si512(ae_ptr_cast(const void, (data + pos + 192)));
+        const __m512i acc =
+            _mm512_or_si512(_mm512_or_si512(zmm0, zmm1), _mm512_or_si512(zmm2, zmm3));
+
+        if (_mm512_movepi8_mask(acc) != 0)
+        {
+            break;
+        }
+    }
+
+    for (; pos < size; pos += 64)
+    {
+        const ae_usize_t left  = size - pos;
+        const __mmask64  mask  = ae_memory_raw_head_mask_avx512((left < 64) ? left : 64);
+        const __m512i    zmm0  = _mm512_maskz_loadu_epi8(mask, data + pos);
+        const ae_u64_t   high  = _mm512_movepi8_mask(zmm0);
+
+        if (high != 0)
+        {
+            return data + pos + ae_bit_scan_forward64(high);
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Подсчитывает установленные биты блоками по 64 байта
+ *        (см. `ae_memory_raw_popcount_ssse3`).
+ *
+ * Остаток меньше 64 байт загружается под маской с заполнением нулями.
+ */
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static ae_usize_t
+ae_memory_raw_popcount_avx512(const ae_u8_t *data, ae_usize_t size)
+{
+    const __m512i lookup = _mm512_broadcast_i32x4(
+        _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4));
+    const __m512i nibble = _mm512_set1_epi8(0x0F);
+    const __m512i zero   = _mm512_setzero_si512();
+    __m512i       sum    = zero;
+
+    for (ae_usize_t pos = 0; pos < size; pos += 64)
+    {
+        const ae_usize_t left = size - pos;
+        const __mmask64  mask = ae_memory_raw_head_mask_avx512((left < 64) ? left : 64);
+        const __m512i    zmm0 = _mm512_maskz_loadu_epi8(mask, data + pos);
+        const __m512i    lo   = _mm512_and_si512(zmm0, nibble);
+        const __m512i    hi   = _mm512_and_si512(_mm512_srli_epi16(zmm0, 4), nibble);
+        const __m512i    bits = _mm512_add_epi8(_mm512_shuffle_epi8(lookup, lo),
+                                             _mm512_shuffle_epi8(lookup, hi));
+
+        sum = _mm512_add_epi64(sum, _mm512_sad_epu8(bits, zero));
+    }
+    return (ae_usize_t)_mm512_reduce_add_epi64(sum);
+}
+
+/**
+ * @brief Подсчитывает установленные биты по 64 бита инструкцией `vpopcntq`.
+ */
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw,avx512vpopcntdq")
+static ae_usize_t
+ae_memory_raw_popcount_avx512vpopcntdq(const ae_u8_t *data, ae_usize_t size)
+{
+    __m512i sum = _mm512_setzero_si512();
+
+    for (ae_usize_t pos = 0; pos < size; pos += 64)
+    {
+        const ae_usize_t left = size - pos;
+        const __mmask64  mask = ae_memory_raw_head_mask_avx512((left < 64) ? left : 64);
+        const __m512i    zmm0 = _mm512_maskz_loadu_epi8(mask, data + pos);
+
+        sum = _mm512_add_epi64(sum, _mm512_popcnt_epi64(zmm0));
+    }
+    return (ae_usize_t)_mm512_reduce_add_epi64(sum);
+}
+
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static const ae_u8_t *
+ae_memory_raw_find_avx512(const ae_u8_t *haystack,
+                          ae_usize_t     haystack_size,
+                          const ae_u8_t *needle,
+                          ae_usize_t     needle_size)
+{
+    const __m512i    first  = _mm512_set1_epi8((char)needle[0]);
+    const __m512i    last   = _mm512_set1_epi8((char)needle[needle_size - 1]);
+    const ae_usize_t middle = ae_memory_raw_find_middle_size(needle_size);
+    ae_usize_t       i      = 0;
+
+    for (; i + needle_size + 63 <= haystack_size; i += 64)
+    {
+        const ae_u8_t *block      = haystack + i;
+        const ae_u8_t *block_last = block + needle_size - 1;
+
+        __m512i  zmm_first = _mm512_loadu_si512(ae_ptr_cast(const void, block));
+        __m512i  zmm_last  = _mm512_loadu_si512(ae_ptr_cast(const void, block_last));
+        ae_u64_t mask      = _mm512_mask_cmpeq_epi8_mask(_mm512_cmpeq_epi8_mask(zmm_first, first),
+                                                         zmm_last,
+                                                         last);
+
+        for (; mask != 0; mask &= mask - 1)
+        {
+            const ae_u8_t *candidate = block + ae_bit_scan_forward64(mask);
+            if (!ae_memory_raw_compare_avx512(candidate + 1, needle + 1, middle))
+            {
+                return candidate;
+            }
+        }
+    }
+    return ae_memory_raw_find_avx2(haystack + i, haystack_size - i, needle, needle_size);
+}
+
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static const ae_u8_t *
+ae_memory_raw_find_from_end_avx512(const ae_u8_t *haystack,
+                                   ae_usize_t     haystack_size,
+                                   const ae_u8_t *needle,
+                                   ae_usize_t     needle_size)
+{
+    const __m512i    first  = _mm512_set1_epi8((char)needle[0]);
+    const __m512i    last   = _mm512_set1_epi8((char)needle[needle_size - 1]);
+    const ae_usize_t middle = ae_memory_raw_find_middle_size(needle_size);
+    ae_usize_t       end    = haystack_size - needle_size + 1;
+
+    for (; end >= 64; end -= 64)
+    {
+        const ae_u8_t *block      = haystack + end - 64;
+        const ae_u8_t *block_last = block + needle_size - 1;
+
+        __m512i  zmm_first = _mm512_loadu_si512(ae_ptr_cast(const void, block));
+        __m512i  zmm_last  = _mm512_loadu_si512(ae_ptr_cast(const void, block_last));
+        ae_u64_t mask      = _mm512_mask_cmpeq_epi8_mask(_mm512_cmpeq_epi8_mask(zmm_first, first),
+                                                         zmm_last,
+                                                         last);
+
+        while (mask != 0)
+        {
+            const ae_u32_t bit       = ae_bit_scan_reverse64(mask);
+            const ae_u8_t *candidate = block + bit;
+
+            if (!ae_memory_raw_compare_avx512(candidate + 1, needle + 1, middle))
+            {
+                return candidate;
+            }
+            mask &= ~((ae_u64_t)1 << bit);
+        }
+    }
+    return ae_memory_raw_find_from_end_avx2(haystack, end + needle_size - 1, needle, needle_size);
+}
+
+/**
+ * @brief Возвращает маску элементов блока, равных @c needle (один бит на элемент).
+ */
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_u64_t
+ae_memory_raw_mask_avx512(const ae_u8_t *block, __m512i needle, ae_usize_t width)
+{
+    const __m512i zmm0 = _mm512_loadu_si512(ae_ptr_cast(const void, block));
+
+    switch (width)
+    {
+        case 1:
+            return _mm512_cmpeq_epi8_mask(zmm0, needle);
+        case 2:
+            return _mm512_cmpeq_epi16_mask(zmm0, needle);
+        default:
+            return _mm512_cmpeq_epi32_mask(zmm0, needle);
+    }
+}
+
+/**
+ * @brief Возвращает смещение первого байта блока, входящего в элемент,
+ *        равный @c needle, или 64, если таких элементов нет.
+ */
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_usize_t
+ae_memory_raw_match_avx512(const ae_u8_t *block, __m512i needle, ae_usize_t width)
+{
+    const ae_u64_t mask = ae_memory_raw_mask_avx512(block, needle, width);
+    return (mask != 0) ? ae_bit_scan_forward64(mask) * width : 64;
+}
+
+/**
+ * @brief Ищет элемент шириной @c width байт блоками по 64 байта
+ *        (см. `ae_memory_raw_find_unit_sse2`).
+ */
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static AE_COMPILER_ATTRIBUTE_BUILTIN const ae_u8_t *
+ae_memory_raw_find_unit_avx512(const ae_u8_t *data,
+                               ae_usize_t     size,
+                               const ae_u8_t *value,
+                               ae_usize_t     width)
+{
+    if (size < 64)
+    {
+        return ae_memory_raw_find_unit_avx2(data, size, value, width);
+    }
+
+    const __m512i    needle = _mm512_broadcast_i32x4(ae_memory_raw_broadcast_sse2(value, width));
+    const ae_usize_t addr   = ae_ptr_to_addr(data);
+    ae_usize_t       index  = ae_memory_raw_match_avx512(data, needle, width);
+
+    if (index != 64)
+    {
+        return data + index;
+    }
+
+    ae_usize_t pos = (addr & (width - 1)) ? 64 : 64 - (addr & 63);
+
+    for (; pos + 64 <= size; pos += 64)
+    {
+        index = ae_memory_raw_match_avx512(data + pos, needle, width);
+        if (index != 64)
+        {
+            return data + pos + index;
+        }
+    }
+
+    if (pos < size)
+    {
+        index = ae_memory_raw_match_avx512(data + size - 64, needle, width);
+        if (index != 64)
+        {
+            return data + size - 64 + index;
+        }
+    }
+    return nullptr;
+}
+
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static const ae_u8_t *
+ae_memory_raw_find_byte_avx512(const ae_u8_t *data, ae_usize_t size, const ae_u8_t *value)
+{
+    return ae_memory_raw_find_unit_avx512(data, size, value, 1);
+}
+
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static const ae_u8_t *
+ae_memory_raw_find_byte_from_end_avx512(const ae_u8_t *data,
+                                        ae_usize_t     size,
+                                        const ae_u8_t *value)
+{
+    if (size < 64)
+    {
+        return ae_memory_raw_find_byte_from_end_avx2(data, size, value);
+    }
+
+    const __m512i needle = _mm512_set1_epi8((char)*value);
+    const ae_u8_t *block  = data + size - 64;
+    ae_u64_t       mask   =
+        _mm512_cmpeq_epi8_mask(_mm512_loadu_si512(ae_ptr_cast(const void, block)), needle);
+
+    if (mask != 0)
+    {
+        return block + ae_bit_scan_reverse64(mask);
+    }
+
+    ae_usize_t pos = size - ((ae_ptr_to_addr(data) + size) & 63);
+
+    for (; pos >= 64; pos -= 64)
+    {
+        block = data + pos - 64;
+        mask  = _mm512_cmpeq_epi8_mask(_mm512_loadu_si512(ae_ptr_cast(const void, block)), needle);
+
+        if (mask != 0)
+        {
+            return block + ae_bit_scan_reverse64(mask);
+        }
+    }
+
+    if (pos > 0)
+    {
+        mask = _mm512_cmpeq_epi8_mask(_mm512_loadu_si512(ae_ptr_cast(const void, data)), needle);
+        if (mask != 0)
+        {
+            return data + ae_bit_scan_reverse64(mask);
+        }
+    }
+    return nullptr;
+}
+
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static const ae_u8_t *
+ae_memory_raw_find_u16_avx512(const ae_u8_t *data, ae_usize_t size, const ae_u8_t *value)
+{
+    return ae_memory_raw_find_unit_avx512(data, size, value, 2);
+}
+
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static const ae_u8_t *
+ae_memory_raw_find_u32_avx512(const ae_u8_t *data, ae_usize_t size, const ae_u8_t *value)
+{
+    return ae_memory_raw_find_unit_avx512(data, size, value, 4);
+}
+
+/**
+ * @brief Ищет нулевой элемент шириной @c width байт блоками по 64 байта,
+ *        выровненными на 64 байта (см. `ae_memory_raw_find_terminator_unit_sse2`).
+ */
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static AE_COMPILER_ATTRIBUTE_BUILTIN const ae_u8_t *
+ae_memory_raw_find_terminator_unit_avx512(const ae_u8_t *str, ae_usize_t width)
+{
+    const ae_usize_t offset = ae_ptr_to_addr(str) & 63;
+
+    if (offset & (width - 1))
+    {
+        return ae_memory_raw_find_terminator_generic(str, width);
+    }
+
+    const __m512i  zero  = _mm512_setzero_si512();
+    const ae_u8_t *block = str - offset;
+    const ae_u64_t head  = ~(ae_u64_t)0 << (offset / width);
+    ae_u64_t       mask  = ae_memory_raw_mask_avx512(block, zero, width) & head;
+
+    while (mask == 0)
+    {
+        block += 64;
+        mask = ae_memory_raw_mask_avx512(block, zero, width);
+    }
+    return block + ae_bit_scan_forward64(mask) * width;
+}
+
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+AE_ATTRIBUTE(NO_SANITIZE_ADDRESS)
+static const ae_u8_t *
+ae_memory_raw_find_terminator_avx512(const ae_u8_t *str, ae_usize_t width)
+{
+    switch (width)
+    {
+        case 1:
+            return ae_memory_raw_find_terminator_unit_avx512(str, 1);
+        case 2:
+            return ae_memory_raw_find_terminator_unit_avx512(str, 2);
+        default:
+            return ae_memory_raw_find_terminator_unit_avx512(str, 4);
+    }
+}
+
+AE_ATTRIBUTE(TARGET)("avx512f")
+static void
+ae_memory_raw_set_avx512(ae_u8_t       *dst,
+                         ae_usize_t     size,
+                         const ae_u8_t *unit,
+                         ae_usize_t     period,
+                         bool           non_temporal)
+{
+    if (size < 64)
+    {
+        ae_memory_raw_set_avx(dst, size, unit, period, non_temporal);
+        return;
+    }
+
+    const ae_usize_t tail_offset = size - 64;
+    const ae_u8_t   *tail_unit   = unit + (tail_offset & (period - 1));
+
+    __m128i head = _mm_loadu_si128(ae_ptr_cast(const __m128i, unit));
+    __m128i tail = _mm_loadu_si128(ae_ptr_cast(const __m128i, tail_unit));
+
+    _mm512_storeu_si512(ae_ptr_cast(void, dst), _mm512_broadcast_i32x4(head));
+    _mm512_storeu_si512(ae_ptr_cast(void, (dst + tail_offset)), _mm512_broadcast_i32x4(tail));
+
+    ae_u8_t         *ptr   = dst + 64 - (ae_ptr_to_addr(dst) & 63);
+    const ae_u8_t   *end   = dst + tail_offset;
+    const ae_usize_t phase = ae_ptr_to_addr_diff(ptr, dst) & (period - 1);
+    const __m512i    zmm0  =
+        _mm512_broadcast_i32x4(_mm_loadu_si128(ae_ptr_cast(const __m128i, (unit + phase))));
+
+    if (non_temporal)
+    {
+        for (; ptr < end; ptr += 64)
+        {
+            _mm512_stream_si512(ae_ptr_cast(void, ptr), zmm0);
+        }
+        _mm_sfence();
+    }
+    else
+    {
+        for (; ptr < end; ptr += 64)
+        {
+            _mm512_store_si512(ae_ptr_cast(void, ptr), zmm0);
+        }
+    }
+}
+/**
+ * @brief Подготавливает векторы множества байт для ядер AVX-512
+ *        (см. `ae_memory_raw_byte_set_load_ssse3`).
+ */
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static AE_COMPILER_ATTRIBUTE_BUILTIN void
+ae_memory_raw_byte_set_load_avx512(__m512i                        *vectors,
+                                   const ae_memory_raw_byte_set_t *set,
+                                   ae_memory_raw_byte_set_kind_t   kind)
+{
+    __m128i xmm[3];
+    ae_memory_raw_byte_set_load_ssse3(xmm, set, kind);
+
+    vectors[0] = _mm512_broadcast_i32x4(xmm[0]);
+    vectors[1] = _mm512_broadcast_i32x4(xmm[1]);
+    vectors[2] = _mm512_broadcast_i32x4(xmm[2]);
+}
+
+/**
+ * @brief Возвращает маску байт блока, входящих в множество (один бит на байт).
+ */
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_u64_t
+ae_memory_raw_match_set_avx512(const ae_u8_t                *block,
+                               const __m512i                *vectors,
+                               ae_memory_raw_byte_set_kind_t kind)
+{
+    const __m512i zmm0 = _mm512_loadu_si512(ae_ptr_cast(const void, block));
+
+    if (kind == AE_MEMORY_RAW_BYTE_SET_ANY2 || kind == AE_MEMORY_RAW_BYTE_SET_ANY3)
+    {
+        ae_u64_t mask = _mm512_cmpeq_epi8_mask(zmm0, vectors[0]) |
+                        _mm512_cmpeq_epi8_mask(zmm0, vectors[1]);
+
+        if (kind == AE_MEMORY_RAW_BYTE_SET_ANY3)
+        {
+            mask |= _mm512_cmpeq_epi8_mask(zmm0, vectors[2]);
+        }
+        return mask;
+    }
+
+    const __m512i high   = _mm512_xor_si512(zmm0, _mm512_set1_epi8(-128));
+    const __m512i nibble = _mm512_and_si512(_mm512_srli_epi16(zmm0, 4), _mm512_set1_epi8(0x0F));
+    const __m512i row    = _mm512_or_si512(_mm512_shuffle_epi8(vectors[0], zmm0),
+                                           _mm512_shuffle_epi8(vectors[1], high));
+    const __m512i bit    = _mm512_shuffle_epi8(vectors[2], nibble);
+
+    return (kind == AE_MEMORY_RAW_BYTE_SET_CLASS) ? _mm512_test_epi8_mask(row, bit)
+                                                  : _mm512_testn_epi8_mask(row, bit);
+}
+
+/**
+ * @brief Ищет первый байт из множества блоками по 64 байта
+ *        (см. `ae_memory_raw_find_unit_sse2`).
+ */
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static AE_COMPILER_ATTRIBUTE_BUILTIN const ae_u8_t *
+ae_memory_raw_scan_set_avx512(const ae_u8_t                  *data,
+                              ae_usize_t                      size,
+                              const ae_memory_raw_byte_set_t *set,
+                              ae_memory_raw_byte_set_kind_t   kind)
+{
+    if (size < 64)
+    {
+        return ae_memory_raw_scan_set_avx2(data, size, set, kind);
+    }
+
+    __m512i vectors[3];
+    ae_memory_raw_byte_set_load_avx512(vectors, set, kind);
+
+    ae_u64_t mask = ae_memory_raw_match_set_avx512(data, vectors, kind);
+    if (mask != 0)
+    {
+        return data + ae_bit_scan_forward64(mask);
+    }
+
+    ae_usize_t pos = 64 - (ae_ptr_to_addr(data) & 63);
+
+    for (; pos + 64 <= size; pos += 64)
+    {
+        mask = ae_memory_raw_match_set_avx512(data + pos, vectors, kind);
+        if (mask != 0)
+        {
+            return data + pos + ae_bit_scan_forward64(mask);
+        }
+    }
+
+    if (pos < size)
+    {
+        mask = ae_memory_raw_match_set_avx512(data + size - 64, vectors, kind);
+        if (mask != 0)
+        {
+            return data + size - 64 + ae_bit_scan_forward64(mask);
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Ищет последний байт из множества блоками по 64 байта
+ *        (см. `ae_memory_raw_find_byte_from_end_sse2`).
+ */
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static AE_COMPILER_ATTRIBUTE_BUILTIN const ae_u8_t *
+ae_memory_raw_scan_set_from_end_avx512(const ae_u8_t                  *data,
+                                       ae_usize_t                      size,
+                                       const ae_memory_raw_byte_set_t *set,
+                                       ae_memory_raw_byte_set_kind_t   kind)
+{
+    if (size < 64)
+    {
+        return ae_memory_raw_scan_set_from_end_avx2(data, size, set, kind);
+    }
+
+    __m512i vectors[3];
+    ae_memory_raw_byte_set_load_avx512(vectors, set, kind);
+
+    ae_u64_t mask = ae_memory_raw_match_set_avx512(data + size - 64, vectors, kind);
+    if (mask != 0)
+    {
+        return data + size - 64 + ae_bit_scan_reverse64(mask);
+    }
+
+    ae_usize_t pos = size - ((ae_ptr_to_addr(data) + size) & 63);
+
+    for (; pos >= 64; pos -= 64)
+    {
+        mask = ae_memory_raw_match_set_avx512(data + pos - 64, vectors, kind);
+        if (mask != 0)
+        {
+            return data + pos - 64 + ae_bit_scan_reverse64(mask);
+        }
+    }
+
+    if (pos > 0)
+    {
+        mask = ae_memory_raw_match_set_avx512(data, vectors, kind);
+        if (mask != 0)
+        {
+            return data + ae_bit_scan_reverse64(mask);
+        }
+    }
+    return nullptr;
+}
+
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static const ae_u8_t *
+ae_memory_raw_find_set_avx512(const ae_u8_t                  *data,
+                              ae_usize_t                      size,
+                              const ae_memory_raw_byte_set_t *set)
+{
+    switch (set->kind)
+    {
+        case AE_MEMORY_RAW_BYTE_SET_ANY2:
+            return ae_memory_raw_scan_set_avx512(data, size, set, AE_MEMORY_RAW_BYTE_SET_ANY2);
+        case AE_MEMORY_RAW_BYTE_SET_ANY3:
+            return ae_memory_raw_scan_set_avx512(data, size, set, AE_MEMORY_RAW_BYTE_SET_ANY3);
+        case AE_MEMORY_RAW_BYTE_SET_CLASS:
+            return ae_memory_raw_scan_set_avx512(data, size, set, AE_MEMORY_RAW_BYTE_SET_CLASS);
+        default:
+            return ae_memory_raw_scan_set_avx512(data,
+                                                 size,
+                                                 set,
+                                                 AE_MEMORY_RAW_BYTE_SET_NOT_CLASS);
+    }
+}
+
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static const ae_u8_t *
+ae_memory_raw_find_set_from_end_avx512(const ae_u8_t                  *data,
+                                       ae_usize_t                      size,
+                                       const ae_memory_raw_byte_set_t *set)
+{
+    switch (set->kind)
+    {
+        case AE_MEMORY_RAW_BYTE_SET_ANY2:
+            return ae_memory_raw_scan_set_from_end_avx512(data,
+                                                          size,
+                                                          set,
+                                                          AE_MEMORY_RAW_BYTE_SET_ANY2);
+        case AE_MEMORY_RAW_BYTE_SET_ANY3:
+            return ae_memory_raw_scan_set_from_end_avx512(data,
+                                                          size,
+                                                          set,
+                                                          AE_MEMORY_RAW_BYTE_SET_ANY3);
+        case AE_MEMORY_RAW_BYTE_SET_CLASS:
+            return ae_memory_raw_scan_set_from_end_avx512(data,
+                                                          size,
+                                                          set,
+                                                          AE_MEMORY_RAW_BYTE_SET_CLASS);
+        default:
+            return ae_memory_raw_scan_set_from_end_avx512(data,
+                                                          size,
+                                                          set,
+                                                          AE_MEMORY_RAW_BYTE_SET_NOT_CLASS);
+    }
+}
+
+/**
+ * @brief Строит маску байт из множества для блока из 64 байт одним сравнением
+ *        (см. `ae_memory_raw_match_set_mask_ssse3`).
+ *
+ * Блоки короче 64 байт обрабатываются ядром AVX2, чтобы не читать байты за концом блока.
+ */
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static ae_u64_t
+ae_memory_raw_match_set_mask_avx512(const ae_u8_t                  *data,
+                                    ae_usize_t                      size,
+                                    const ae_memory_raw_byte_set_t *set)
+{
+    if (size < 64)
+    {
+        return ae_memory_raw_match_set_mask_avx2(data, size, set);
+    }
+
+    __m512i vectors[3];
+    ae_memory_raw_byte_set_load_avx512(vectors, set, set->kind);
+    return ae_memory_raw_match_set_avx512(data, vectors, set->kind);
+}
+
+/**
+ * @brief Заменяет байты по таблице блоками по 64 байта
+ *        (см. `ae_memory_raw_translate_avx2`).
+ *
+ * Остаток меньше 64 байт обрабатывается маскированными загрузкой и записью.
+ */
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static void
+ae_memory_raw_translate_avx512(ae_u8_t       *dst,
+                               const ae_u8_t *src,
+                               ae_usize_t     size,
+                               const ae_u8_t *table)
+{
+    const __m512i row_step = _mm512_set1_epi8(16);
+    const __m512i row_bias = _mm512_set1_epi8(0x70);
+    __m512i       rows[16];
+
+    for (ae_usize_t k = 0; k < 16; ++k)
+    {
+        rows[k] = _mm512_broadcast_i32x4(
+            _mm_loadu_si128(ae_ptr_cast(const __m128i, (table + k * 16))));
+    }
+
+    for (ae_usize_t pos = 0; pos < size; pos += 64)
+    {
+        const ae_usize_t left  = size - pos;
+        const __mmask64  mask  = ae_memory_raw_head_mask_avx512((left < 64) ? left : 64);
+        __m512i          index = _mm512_maskz_loadu_epi8(mask, src + pos);
+        __m512i          zmm0  = _mm512_setzero_si512();
+
+        for (ae_usize_t k = 0; k < 16; ++k)
+        {
+            const __m512i row_index = _mm512_adds_epu8(index, row_bias);
+
+            zmm0  = _mm512_or_si512(zmm0, _mm512_shuffle_epi8(rows[k], row_index));
+            index = _mm512_sub_epi8(index, row_step);
+        }
+
+        _mm512_mask_storeu_epi8(dst + pos, mask, zmm0);
+    }
+}
+
+/**
+ * @brief Заменяет байты по таблице блоками по 64 байта инструкцией `vpermi2b`.
+ *
+ * Каждая инструкция выбирает значения из половины таблицы (128 байт)
+ * по младшим 7 битам индекса, а старший бит выбирает половину.
+ */
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw,avx512vbmi")
+static void
+ae_memory_raw_translate_avx512vbmi(ae_u8_t       *dst,
+                                   const ae_u8_t *src,
+                                   ae_usize_t     size,
+                                   const ae_u8_t *table)
+{
+    const __m512i t0 = _mm512_loadu_si512(ae_ptr_cast(const void, table));
+    const __m512i t1 = _mm512_loadu_si512(ae_ptr_cast(const void, (table + 64)));
+    const __m512i t2 = _mm512_loadu_si512(ae_ptr_cast(const void, (table + 128)));
+    const __m512i t3 = _mm512_loadu_si512(ae_ptr_cast(const void, (table + 192)));
+
+    for (ae_usize_t pos = 0; pos < size; pos += 64)
+    {
+        const ae_usize_t left  = size - pos;
+        const __mmask64  mask  = ae_memory_raw_head_mask_avx512((left < 64) ? left : 64);
+        const __m512i    index = _mm512_maskz_loadu_epi8(mask, src + pos);
+        const __m512i    lower = _mm512_permutex2var_epi8(t0, index, t1);
+        const __m512i    upper = _mm512_permutex2var_epi8(t2, index, t3);
+
+        _mm512_mask_storeu_epi8(dst + pos,
+                                mask,
+                                _mm512_mask_blend_epi8(_mm512_movepi8_mask(index), lower, upper));
+    }
+}
+
+/**
+ * @brief Меняет регистр латинских букв блоками по 64 байта.
+ *
+ * Остаток меньше 64 байт обрабатывается маскированными загрузкой и записью.
+ */
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static void
+ae_memory_raw_case_avx512(ae_u8_t *dst, const ae_u8_t *src, ae_usize_t size, ae_u8_t first)
+{
+    const __m512i base  = _mm512_set1_epi8((char)first);
+    const __m512i count = _mm512_set1_epi8((char)m_memory_raw_case_count);
+    const __m512i bit   = _mm512_set1_epi8((char)m_memory_raw_case_bit);
+
+    for (ae_usize_t pos = 0; pos < size; pos += 64)
+    {
+        const ae_usize_t left    = size - pos;
+        const __mmask64  mask    = ae_memory_raw_head_mask_avx512((left < 64) ? left : 64);
+        const __m512i    zmm0    = _mm512_maskz_loadu_epi8(mask, src + pos);
+        const __m512i    zmm1    = _mm512_xor_si512(zmm0, bit);
+        const __mmask64  letters = _mm512_cmplt_epu8_mask(_mm512_sub_epi8(zmm0, base), count);
+
+        _mm512_mask_storeu_epi8(dst + pos, mask, _mm512_mask_blend_epi8(letters, zmm0, zmm1));
+    }
+}
+
+#endif // AE_CPU_FEATURE_KERNEL_AVX512
+
+/* -------------------------------------------------------------------------------------------- */
+/* Выбор ядер                                                                                   */
+/* -------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief Ядра, используемые функциями модуля.
+ *
+ * До выполнения конструктора `ae_memory_raw_dispatch_init` содержит переносимые ядра,
+ * поэтому функции модуля корректны в любой момент загрузки библиотеки.
+ * Таблица заполняется один раз и разделяется всеми потоками.
+ */
+ae_memory_raw_kernels_t m_memory_raw_kernels = {
+    ae_memory_raw_copy_generic,
+    ae_memory_raw_copy_from_end_generic,
+    ae_memory_raw_compare_generic,
+    ae_memory_raw_compare_from_end_generic,
+    ae_memory_raw_compare_icase_generic,
+    ae_memory_raw_differ_generic,
+    ae_memory_raw_count_byte_generic,
+    ae_memory_raw_popcount_generic,
+    ae_memory_raw_find_nonzero_generic,
+    ae_memory_raw_find_non_ascii_generic,
+    ae_memory_raw_find_generic,
+    ae_memory_raw_find_from_end_generic,
+    ae_memory_raw_find_byte_generic,
+    ae_memory_raw_find_byte_from_end_generic,
+    ae_memory_raw_find_u16_generic,
+    ae_memory_raw_find_u32_generic,
+    ae_memory_raw_find_terminator_generic,
+    ae_memory_raw_find_set_generic,
+    ae_memory_raw_find_set_from_end_generic,
+    ae_memory_raw_match_set_generic,
+    ae_memory_raw_set_generic,
+    ae_memory_raw_translate_generic,
+    ae_memory_raw_case_generic,
+};
+
+/**
+ * @brief Размер области в байтах, начиная с которого копирование и заполнение
+ *        выполняются невременными инструкциями записи.
+ *
+ * При загрузке библиотеки устанавливается конструктором `ae_memory_raw_dispatch_init`
+ * (см. `ae_memory_raw_default_non_temporal_threshold`).
+ */
+ae_usize_t m_memory_raw_non_temporal_threshold = AE_MEMORY_RAW_NON_TEMPORAL_THRESHOLD;
+
+/**
+ * @brief Возвращает порог невременной записи по умолчанию.
+ *
+ * Блоки больше кэша последнего уровня все равно не помещаются в кэш,
+ * поэтому порог равен его размеру, а если размер кэша не удалось определить -
+ * значению `AE_MEMORY_RAW_NON_TEMPORAL_THRESHOLD`.
+ */
+static ae_usize_t
+ae_memory_raw_default_non_temporal_threshold()
+{
+    const ae_usize_t cache_size = ae_cpu_feature_cache_size();
+    return (cache_size != 0) ? cache_size : AE_MEMORY_RAW_NON_TEMPORAL_THRESHOLD;
+}
+
+void
+ae_memory_raw_dispatch(ae_u32_t features)
+{
+    ae_memory_raw_kernels_t kernels = {
+        ae_memory_raw_copy_generic,
+        ae_memory_raw_copy_from_end_generic,
+        ae_memory_raw_compare_generic,
+        ae_memory_raw_compare_from_end_generic,
+        ae_memory_raw_compare_icase_generic,
+        ae_memory_raw_differ_generic,
+        ae_memory_raw_count_byte_generic,
+        ae_memory_raw_popcount_generic,
+        ae_memory_raw_find_nonzero_generic,
+        ae_memory_raw_find_non_ascii_generic,
+        ae_memory_raw_find_generic,
+        ae_memory_raw_find_from_end_generic,
+        ae_memory_raw_find_byte_generic,
+        ae_memory_raw_find_byte_from_end_generic,
+        ae_memory_raw_find_u16_generic,
+        ae_memory_raw_find_u32_generic,
+        ae_memory_raw_find_terminator_generic,
+        ae_memory_raw_find_set_generic,
+        ae_memory_raw_find_set_from_end_generic,
+        ae_memory_raw_match_set_generic,
+        ae_memory_raw_set_generic,
+        ae_memory_raw_translate_generic,
+        ae_memory_raw_case_generic,
+    };
+
+    features &= ae_cpu_feature_get();
+
+#if AE_CPU_FEATURE_KERNEL_SSE2
+    if (features & AE_CPU_FEATURE_SSE2)
+    {
+        kernels.copy               = ae_memory_raw_copy_sse2;
+        kernels.copy_from_end      = ae_memory_raw_copy_from_end_sse2;
+        kernels.compare            = ae_memory_raw_compare_sse2;
+        kernels.compare_from_end   = ae_memory_raw_compare_from_end_sse2;
+        kernels.compare_icase      = ae_memory_raw_compare_icase_sse2;
+        kernels.differ             = ae_memory_raw_differ_sse2;
+        kernels.count_byte         = ae_memory_raw_count_byte_sse2;
+        kernels.find_nonzero       = ae_memory_raw_find_nonzero_sse2;
+        kernels.find_non_ascii     = ae_memory_raw_find_non_ascii_sse2;
+        kernels.find               = ae_memory_raw_find_sse2;
+        kernels.find_from_end      = ae_memory_raw_find_from_end_sse2;
+        kernels.find_byte          = ae_memory_raw_find_byte_sse2;
+        kernels.find_byte_from_end = ae_memory_raw_find_byte_from_end_sse2;
+        kernels.find_u16           = ae_memory_raw_find_u16_sse2;
+        kernels.find_u32           = ae_memory_raw_find_u32_sse2;
+        kernels.find_terminator    = ae_memory_raw_find_terminator_sse2;
+        kernels.set                = ae_memory_raw_set_sse2;
+        kernels.change_case        = ae_memory_raw_case_sse2;
+    }
+
+    if ((features & AE_CPU_FEATURE_SSE2) && (features & AE_CPU_FEATURE_SSSE3))
+    {
+        kernels.find_set          = ae_memory_raw_find_set_ssse3;
+        kernels.find_set_from_end = ae_memory_raw_find_set_from_end_ssse3;
+        kernels.match_set         = ae_memory_raw_match_set_mask_ssse3;
+        kernels.popcount          = ae_memory_raw_popcount_ssse3;
+    }
+#endif
+
+#if AE_CPU_FEATURE_KERNEL_AVX
+    if (features & AE_CPU_FEATURE_AVX)
+    {
+        kernels.copy          = ae_memory_raw_copy_avx;
+        kernels.copy_from_end = ae_memory_raw_copy_from_end_avx;
+        kernels.set           = ae_memory_raw_set_avx;
+    }
+#endif
+
+#if AE_CPU_FEATURE_KERNEL_AVX2
+    if (features & AE_CPU_FEATURE_AVX2)
+    {
+        kernels.compare            = ae_memory_raw_compare_avx2;
+        kernels.compare_from_end   = ae_memory_raw_compare_from_end_avx2;
+        kernels.compare_icase      = ae_memory_raw_compare_icase_avx2;
+        kernels.differ             = ae_memory_raw_differ_avx2;
+        kernels.count_byte         = ae_memory_raw_count_byte_avx2;
+        kernels.find_nonzero       = ae_memory_raw_find_nonzero_avx2;
+        kernels.find_non_ascii     = ae_memory_raw_find_non_ascii_avx2;
+        kernels.popcount           = ae_memory_raw_popcount_avx2;
+        kernels.find               = ae_memory_raw_find_avx2;
+        kernels.find_from_end      = ae_memory_raw_find_from_end_avx2;
+        kernels.find_byte          = ae_memory_raw_find_byte_avx2;
+        kernels.find_byte_from_end = ae_memory_raw_find_byte_from_end_avx2;
+        kernels.find_u16           = ae_memory_raw_find_u16_avx2;
+        kernels.find_u32           = ae_memory_raw_find_u32_avx2;
+        kernels.find_terminator    = ae_memory_raw_find_terminator_avx2;
+        kernels.find_set           = ae_memory_raw_find_set_avx2;
+        kernels.find_set_from_end  = ae_memory_raw_find_set_from_end_avx2;
+        kernels.match_set          = ae_memory_raw_match_set_mask_avx2;
+        kernels.translate          = ae_memory_raw_translate_avx2;
+        kernels.change_case        = ae_memory_raw_case_avx2;
+    }
+#endif
+
+#if AE_CPU_FEATURE_KERNEL_AVX512
+    if (features & AE_CPU_FEATURE_AVX512F)
+    {
+        kernels.set = ae_memory_raw_set_avx512;
+    }
+
+    if ((features & AE_CPU_FEATURE_AVX512F) && (features & AE_CPU_FEATURE_AVX512BW))
+    {
+        kernels.copy               = ae_memory_raw_copy_avx512;
+        kernels.copy_from_end      = ae_memory_raw_copy_from_end_avx512;
+        kernels.compare            = ae_memory_raw_compare_avx512;
+        kernels.compare_from_end   = ae_memory_raw_compare_from_end_avx512;
+        kernels.compare_icase      = ae_memory_raw_compare_icase_avx512;
+        kernels.differ             = ae_memory_raw_differ_avx512;
+        kernels.count_byte         = ae_memory_raw_count_byte_avx512;
+        kernels.find_nonzero       = ae_memory_raw_find_nonzero_avx512;
+        kernels.find_non_ascii     = ae_memory_raw_find_non_ascii_avx512;
+        kernels.popcount           = ae_memory_raw_popcount_avx512;
+        kernels.find               = ae_memory_raw_find_avx512;
+        kernels.find_from_end      = ae_memory_raw_find_from_end_avx512;
+        kernels.find_byte          = ae_memory_raw_find_byte_avx512;
+        kernels.find_byte_from_end = ae_memory_raw_find_byte_from_end_avx512;
+        kernels.find_u16           = ae_memory_raw_find_u16_avx512;
+        kernels.find_u32           = ae_memory_raw_find_u32_avx512;
+        kernels.find_terminator    = ae_memory_raw_find_terminator_avx512;
+        kernels.find_set           = ae_memory_raw_find_set_avx512;
+        kernels.find_set_from_end  = ae_memory_raw_find_set_from_end_avx512;
+        kernels.match_set          = ae_memory_raw_match_set_mask_avx512;
+        kernels.translate          = ae_memory_raw_translate_avx512;
+        kernels.change_case        = ae_memory_raw_case_avx512;
+    }
+
+    if ((features & AE_CPU_FEATURE_AVX512BW) && (features & AE_CPU_FEATURE_AVX512VBMI))
+    {
+        kernels.translate = ae_memory_raw_translate_avx512vbmi;
+    }
+
+    if ((features & AE_CPU_FEATURE_AVX512BW) && (features & AE_CPU_FEATURE_AVX512VPOPCNTDQ))
+    {
+        kernels.popcount = ae_memory_raw_popcount_avx512vpopcntdq;
+    }
+#endif
+
+    m_memory_raw_kernels = kernels;
+}
+
+/**
+ * @brief Конструктор, выбирающий ядра модуля при загрузке библиотеки.
+ *
+ * Выбираются наилучшие собранные варианты ядер,
+ * которые поддерживаются текущим процессором.
+ */
+ae_compiler_constructor(ae_memory_raw_dispatch_init)
+{
+    ae_memory_raw_dispatch(AE_CPU_FEATURE_ALL);
+    m_memory_raw_non_temporal_threshold = ae_memory_raw_default_non_temporal_threshold();
+}
+
+/* -------------------------------------------------------------------------------------------- */
+/* Функции модуля                                                                               */
+/* -------------------------------------------------------------------------------------------- */
+
+void
+ae_memory_raw_set_non_temporal_threshold(ae_usize_t size)
+{
+    m_memory_raw_non_temporal_threshold =
+        (size != 0) ? size : ae_memory_raw_default_non_temporal_threshold();
+}
+
+ae_usize_t
+ae_memory_raw_get_non_temporal_threshold()
+{
+    return m_memory_raw_non_temporal_threshold;
+}
+
+void *
+ae_memory_raw_copy(void *dst, const void *dst_end, const void *src, const void *src_end)
+{
+    ae_runtime_assert(dst && src, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+
+    const ae_usize_t dst_size = ae_memory_raw_range_size(dst, dst_end);
+    const ae_usize_t src_size = ae_memory_raw_range_size(src, src_end);
+    const ae_usize_t size     = (dst_size < src_size) ? dst_size : src_size;
+
+    m_memory_raw_kernels.copy(ae_ptr_cast(ae_u8_t, dst),
+                              ae_ptr_cast(const ae_u8_t, src),
+                              size,
+                              size >= m_memory_raw_non_temporal_threshold);
+    return ae_ptr_add_offset_unsafe(void, dst, size);
+}
+
+void *
+ae_memory_raw_copy_from_end(const void *dst, void *dst_end, const void *src, const void *src_end)
+{
+    ae_runtime_assert(dst && src, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+
+    const ae_usize_t dst_size = ae_memory_raw_range_size(dst, dst_end);
+    const ae_usize_t src_size = ae_memory_raw_range_size(src, src_end);
+    const ae_usize_t size     = (dst_size < src_size) ? dst_size : src_size;
+
+    m_memory_raw_kernels.copy_from_end(ae_ptr_cast(ae_u8_t, dst_end),
+                                       ae_ptr_cast(const ae_u8_t, src_end),
+                                       size,
+                                       size >= m_memory_raw_non_temporal_threshold);
+    return ae_ptr_sub_offset_unsafe(void, dst_end, size);
+}
+
+void *
+ae_memory_raw_move(void *dst, const void *dst_end, const void *src, const void *src_end)
+{
+    ae_runtime_assert(dst && src, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+
+    const ae_usize_t dst_size = ae_memory_raw_range_size(dst, dst_end);
+    const ae_usize_t src_size = ae_memory_raw_range_size(src, src_end);
+    const ae_usize_t size     = (dst_size < src_size) ? dst_size : src_size;
+
+    ae_u8_t       *_dst         = ae_ptr_cast(ae_u8_t, dst);
+    const ae_u8_t *_src         = ae_ptr_cast(const ae_u8_t, src);
+    const bool     non_temporal = size >= m_memory_raw_non_temporal_threshold;
+
+    if (ae_ptr_range_is_overlapped(_dst, _src, _src + size))
+    {
+        m_memory_raw_kernels.copy_from_end(_dst + size, _src + size, size, non_temporal);
+    }
+    else
+    {
+        m_memory_raw_kernels.copy(_dst, _src, size, non_temporal);
+    }
+    return _dst + size;
+}
+
+const void *
+ae_memory_raw_compare(const void *lhs, const void *lhs_end, const void *rhs, const void *rhs_end)
+{
+    ae_runtime_assert(lhs && rhs, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+    ae_runtime_return_if(lhs == rhs, nullptr);
+
+    const ae_usize_t lhs_size = ae_memory_raw_range_size(lhs, lhs_end);
+    const ae_usize_t rhs_size = ae_memory_raw_range_size(rhs, rhs_end);
+    const ae_usize_t size     = (lhs_size < rhs_size) ? lhs_size : rhs_size;
+
+    return m_memory_raw_kernels.compare(ae_ptr_cast(const ae_u8_t, lhs),
+                                        ae_ptr_cast(const ae_u8_t, rhs),
+                                        size);
+}
+
+bool
+ae_memory_raw_equal_constant_time(const void *lhs,
+                                  const void *lhs_end,
+                                  const void *rhs,
+                                  const void *rhs_end)
+{
+    ae_runtime_assert(lhs && rhs, AE_RUNTIME_ERROR_NULL_POINTER, false);
+
+    const ae_usize_t lhs_size = ae_memory_raw_range_size(lhs, lhs_end);
+    const ae_usize_t rhs_size = ae_memory_raw_range_size(rhs, rhs_end);
+
+    /* Длины не считаются секретными и сравниваются сразу. */
+    ae_runtime_return_if(lhs_size != rhs_size, false);
+
+    return !m_memory_raw_kernels.differ(ae_ptr_cast(const ae_u8_t, lhs),
+                                        ae_ptr_cast(const ae_u8_t, rhs),
+                                        lhs_size);
+}
+
+ae_sint_t
+ae_memory_raw_order(const void *lhs, const void *lhs_end, const void *rhs, const void *rhs_end)
+{
+    ae_runtime_assert(lhs && rhs, AE_RUNTIME_ERROR_NULL_POINTER, 0);
+
+    const ae_usize_t lhs_size = ae_memory_raw_range_size(lhs, lhs_end);
+    const ae_usize_t rhs_size = ae_memory_raw_range_size(rhs, rhs_end);
+    const ae_usize_t size     = (lhs_size < rhs_size) ? lhs_size : rhs_size;
+
+    const ae_u8_t *_lhs = ae_ptr_cast(const ae_u8_t, lhs);
+    const ae_u8_t *_rhs = ae_ptr_cast(const ae_u8_t, rhs);
+
+    if (_lhs != _rhs)
+    {
+        const ae_u8_t *mismatch = m_memory_raw_kernels.compare(_lhs, _rhs, size);
+
+        if (mismatch != nullptr)
+        {
+            return (ae_sint_t)*mismatch - (ae_sint_t)_rhs[mismatch - _lhs];
+        }
+    }
+
+    /* Общая часть совпадает: порядок определяется длиной. */
+    return (lhs_size > rhs_size) - (lhs_size < rhs_size);
+}
+
+const void *
+ae_memory_raw_compare_from_end(const void *lhs,
+                               const void *lhs_end,
+                               const void *rhs,
+                               const void *rhs_end)
+{
+    ae_runtime_assert(lhs && rhs, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+
+    const ae_usize_t lhs_size = ae_memory_raw_range_size(lhs, lhs_end);
+    const ae_usize_t rhs_size = ae_memory_raw_range_size(rhs, rhs_end);
+    const ae_usize_t size     = (lhs_size < rhs_size) ? lhs_size : rhs_size;
+
+    return m_memory_raw_kernels.compare_from_end(ae_ptr_cast(const ae_u8_t, lhs_end),
+                                                 ae_ptr_cast(const ae_u8_t, rhs_end),
+                                                 size);
+}
+
+const void *
+ae_memory_raw_compare_icase(const void *lhs,
+                            const void *lhs_end,
+                            const void *rhs,
+                            const void *rhs_end)
+{
+    ae_runtime_assert(lhs && rhs, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+    ae_runtime_return_if(lhs == rhs, nullptr);
+
+    const ae_usize_t lhs_size = ae_memory_raw_range_size(lhs, lhs_end);
+    const ae_usize_t rhs_size = ae_memory_raw_range_size(rhs, rhs_end);
+    const ae_usize_t size     = (lhs_size < rhs_size) ? lhs_size : rhs_size;
+
+    return m_memory_raw_kernels.compare_icase(ae_ptr_cast(const ae_u8_t, lhs),
+                                              ae_ptr_cast(const ae_u8_t, rhs),
+                                              size);
+}
+
+const void *
+ae_memory_raw_find(const void *lhs, const void *lhs_end, const void *rhs, const void *rhs_end)
+{
+    ae_runtime_assert(lhs && rhs, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+
+    const ae_usize_t lhs_size = ae_memory_raw_range_size(lhs, lhs_end);
+    const ae_usize_t rhs_size = ae_memory_raw_range_size(rhs, rhs_end);
+
+    ae_runtime_return_if(lhs_size == 0 || rhs_size > lhs_size, nullptr);
+    ae_runtime_return_if(rhs_size == 0, lhs);
+
+    const ae_u8_t *_lhs = ae_ptr_cast(const ae_u8_t, lhs);
+    const ae_u8_t *_rhs = ae_ptr_cast(const ae_u8_t, rhs);
+
+    if (rhs_size == 1)
+    {
+        return m_memory_raw_kernels.find_byte(_lhs, lhs_size, _rhs);
+    }
+
+    if (rhs_size <= AE_MEMORY_SEARCHER_SHORT_NEEDLE_SIZE)
+    {
+        return m_memory_raw_kernels.find(_lhs, lhs_size, _rhs, rhs_size);
+    }
+
+    ae_memory_searcher_t searcher;
+    ae_memory_searcher_init(&searcher, rhs, rhs_end);
+    return ae_memory_searcher_find(&searcher, lhs, lhs_end);
+}
+
+const void *
+ae_memory_raw_find_from_end(const void *lhs,
+                            const void *lhs_end,
+                            const void *rhs,
+                            const void *rhs_end)
+{
+    ae_runtime_assert(lhs && rhs, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+
+    const ae_usize_t lhs_size = ae_memory_raw_range_size(lhs, lhs_end);
+    const ae_usize_t rhs_size = ae_memory_raw_range_size(rhs, rhs_end);
+
+    ae_runtime_return_if(lhs_size == 0 || rhs_size > lhs_size, nullptr);
+    ae_runtime_return_if(rhs_size == 0, lhs_end);
+
+    const ae_u8_t *_lhs = ae_ptr_cast(const ae_u8_t, lhs);
+    const ae_u8_t *_rhs = ae_ptr_cast(const ae_u8_t, rhs);
+
+    if (rhs_size == 1)
+    {
+        return m_memory_raw_kernels.find_byte_from_end(_lhs, lhs_size, _rhs);
+    }
+
+    if (rhs_size <= AE_MEMORY_SEARCHER_SHORT_NEEDLE_SIZE)
+    {
+        return m_memory_raw_kernels.find_from_end(_lhs, lhs_size, _rhs, rhs_size);
+    }
+
+    ae_memory_searcher_t searcher;
+    ae_memory_searcher_init(&searcher, rhs, rhs_end);
+    return ae_memory_searcher_find_from_end(&searcher, lhs, lhs_end);
+}
+
+const void *
+ae_memory_raw_find_byte(const void *begin, const void *end, ae_u8_t value)
+{
+    ae_runtime_assert(begin, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+
+    return m_memory_raw_kernels.find_byte(ae_ptr_cast(const ae_u8_t, begin),
+                                          ae_memory_raw_range_size(begin, end),
+                                          &value);
+}
+
+const void *
+ae_memory_raw_find_byte_from_end(const void *begin, const void *end, ae_u8_t value)
+{
+    ae_runtime_assert(begin, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+
+    return m_memory_raw_kernels.find_byte_from_end(ae_ptr_cast(const ae_u8_t, begin),
+                                                   ae_memory_raw_range_size(begin, end),
+                                                   &value);
+}
+
+ae_usize_t
+ae_memory_raw_count_byte(const void *begin, const void *end, ae_u8_t value)
+{
+    ae_runtime_assert(begin, AE_RUNTIME_ERROR_NULL_POINTER, 0);
+
+    return m_memory_raw_kernels.count_byte(ae_ptr_cast(const ae_u8_t, begin),
+                                           ae_memory_raw_range_size(begin, end),
+                                           value);
+}
+
+ae_usize_t
+ae_memory_raw_popcount(const void *begin, const void *end)
+{
+    ae_runtime_assert(begin, AE_RUNTIME_ERROR_NULL_POINTER, 0);
+
+    return m_memory_raw_kernels.popcount(ae_ptr_cast(const ae_u8_t, begin),
+                                         ae_memory_raw_range_size(begin, end));
+}
+
+const void *
+ae_memory_raw_find_nonzero(const void *begin, const void *end)
+{
+    ae_runtime_assert(begin, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+
+    return m_memory_raw_kernels.find_nonzero(ae_ptr_cast(const ae_u8_t, begin),
+                                             ae_memory_raw_range_size(begin, end));
+}
+
+bool
+ae_memory_raw_is_zero(const void *begin, const void *end)
+{
+    ae_runtime_assert(begin, AE_RUNTIME_ERROR_NULL_POINTER, false);
+
+    return ae_memory_raw_find_nonzero(begin, end) == nullptr;
+}
+
+const void *
+ae_memory_raw_find_non_ascii(const void *begin, const void *end)
+{
+    ae_runtime_assert(begin, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+
+    return m_memory_raw_kernels.find_non_ascii(ae_ptr_cast(const ae_u8_t, begin),
+                                               ae_memory_raw_range_size(begin, end));
+}
+
+bool
+ae_memory_raw_is_ascii(const void *begin, const void *end)
+{
+    ae_runtime_assert(begin, AE_RUNTIME_ERROR_NULL_POINTER, false);
+
+    return ae_memory_raw_find_non_ascii(begin, end) == nullptr;
+}
+
+const void *
+ae_memory_raw_find_u16(const void *begin, const void *end, ae_u16_t value)
+{
+    ae_runtime_assert(begin, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+
+    const ae_usize_t size = ae_memory_raw_range_size(begin, end) & ~(ae_usize_t)1;
+    return m_memory_raw_kernels.find_u16(ae_ptr_cast(const ae_u8_t, begin),
+                                         size,
+                                         ae_ptr_cast(const ae_u8_t, &value));
+}
+
+const void *
+ae_memory_raw_find_u32(const void *begin, const void *end, ae_u32_t value)
+{
+    ae_runtime_assert(begin, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+
+    const ae_usize_t size = ae_memory_raw_range_size(begin, end) & ~(ae_usize_t)3;
+    return m_memory_raw_kernels.find_u32(ae_ptr_cast(const ae_u8_t, begin),
+                                         size,
+                                         ae_ptr_cast(const ae_u8_t, &value));
+}
+
+/**
+ * @brief Ищет байт из множества в блоке памяти в заданном направлении.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN const void *
+ae_memory_raw_find_set(const void                     *begin,
+                       const void                     *end,
+                       const ae_memory_raw_byte_set_t *set,
+                       bool                            from_end)
+{
+    const ae_u8_t   *data = ae_ptr_cast(const ae_u8_t, begin);
+    const ae_usize_t size = ae_memory_raw_range_size(begin, end);
+
+    return from_end ? m_memory_raw_kernels.find_set_from_end(data, size, set)
+                    : m_memory_raw_kernels.find_set(data, size, set);
+}
+
+const void *
+ae_memory_raw_find_byte2(const void *begin, const void *end, ae_u8_t first, ae_u8_t second)
+{
+    ae_runtime_assert(begin, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+
+    const ae_memory_raw_byte_set_t set = {
+        AE_MEMORY_RAW_BYTE_SET_ANY2, {first, second, second}, nullptr};
+    return ae_memory_raw_find_set(begin, end, &set, false);
+}
+
+const void *
+ae_memory_raw_find_byte3(const void *begin,
+                         const void *end,
+                         ae_u8_t     first,
+                         ae_u8_t     second,
+                         ae_u8_t     third)
+{
+    ae_runtime_assert(begin, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+
+    const ae_memory_raw_byte_set_t set = {
+        AE_MEMORY_RAW_BYTE_SET_ANY3, {first, second, third}, nullptr};
+    return ae_memory_raw_find_set(begin, end, &set, false);
+}
+
+const void *
+ae_memory_raw_find_class(const void *begin, const void *end, const ae_byte_class_t *cls)
+{
+    ae_runtime_assert(begin && cls, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+
+    const ae_memory_raw_byte_set_t set = {AE_MEMORY_RAW_BYTE_SET_CLASS, {0, 0, 0}, cls};
+    return ae_memory_raw_find_set(begin, end, &set, false);
+}
+
+const void *
+ae_memory_raw_find_class_from_end(const void *begin, const void *end, const ae_byte_class_t *cls)
+{
+    ae_runtime_assert(begin && cls, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+
+    const ae_memory_raw_byte_set_t set = {AE_MEMORY_RAW_BYTE_SET_CLASS, {0, 0, 0}, cls};
+    return ae_memory_raw_find_set(begin, end, &set, true);
+}
+
+const void *
+ae_memory_raw_find_not_class(const void *begin, const void *end, const ae_byte_class_t *cls)
+{
+    ae_runtime_assert(begin && cls, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+
+    const ae_memory_raw_byte_set_t set = {AE_MEMORY_RAW_BYTE_SET_NOT_CLASS, {0, 0, 0}, cls};
+    return ae_memory_raw_find_set(begin, end, &set, false);
+}
+
+const void *
+ae_memory_raw_find_not_class_from_end(const void            *begin,
+                                      const void            *end,
+                                      const ae_byte_class_t *cls)
+{
+    ae_runtime_assert(begin && cls, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+
+    const ae_memory_raw_byte_set_t set = {AE_MEMORY_RAW_BYTE_SET_NOT_CLASS, {0, 0, 0}, cls};
+    return ae_memory_raw_find_set(begin, end, &set, true);
+}
+
+ae_u64_t
+ae_memory_raw_match_class(const void *begin, const void *end, const ae_byte_class_t *cls)
+{
+    ae_runtime_assert(begin && cls, AE_RUNTIME_ERROR_NULL_POINTER, 0);
+
+    const ae_memory_raw_byte_set_t set  = {AE_MEMORY_RAW_BYTE_SET_CLASS, {0, 0, 0}, cls};
+    const ae_usize_t               size = ae_memory_raw_range_size(begin, end);
+
+    return m_memory_raw_kernels.match_set(ae_ptr_cast(const ae_u8_t, begin),
+                                          (size < 64) ? size : 64,
+                                          &set);
+}
+
+const void *
+ae_memory_raw_find_null_terminator(const void *str, ae_usize_t width)
+{
+    ae_runtime_assert(str, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+    ae_runtime_assert(width == 1 || width == 2 || width == 4,
+                      AE_RUNTIME_ERROR_INVALID_ARGUMENT,
+                      nullptr);
+
+    return m_memory_raw_kernels.find_terminator(ae_ptr_cast(const ae_u8_t, str), width);
+}
+
+/**
+ * @brief Заполняет @c dst_size байт повторяющимся шаблоном.
+ *
+ * @param dst Указатель на начало области.
+ * @param dst_size Размер области (больше 0).
+ * @param src Указатель на шаблон.
+ * @param src_size Длина шаблона (больше 0).
+ * @param non_temporal Записывать ли область в обход кэша.
+ */
+static void
+ae_memory_raw_set_bytes(ae_u8_t       *dst,
+                        ae_usize_t     dst_size,
+                        const ae_u8_t *src,
+                        ae_usize_t     src_size,
+                        bool           non_temporal)
+{
+    /* Шаблоны длиной 1, 2, 4, 8 и 16 байт размножаются в SIMD-регистры. */
+    if (src_size <= 16 && ae_bit_is_single(src_size))
+    {
+        ae_u8_t unit[32];
+        for (ae_usize_t i = 0; i < sizeof(unit); ++i)
+        {
+            unit[i] = src[i & (src_size - 1)];
+        }
+
+        m_memory_raw_kernels.set(dst, dst_size, unit, src_size, non_temporal);
+        return;
+    }
+
+    /*
+     * Шаблоны другой длины копируются один раз, после чего уже заполненная часть
+     * удваивается: на каждом шаге копируется кратное длине шаблона число байт,
+     * поэтому фаза шаблона сохраняется, а количество вызовов ядра логарифмично.
+     */
+    ae_usize_t filled = (src_size < dst_size) ? src_size : dst_size;
+    ae_memory_raw_move(dst, dst + filled, src, src + filled);
+
+    while (filled < dst_size)
+    {
+        const ae_usize_t remaining = dst_size - filled;
+        const ae_usize_t size      = (filled < remaining) ? filled : remaining;
+
+        m_memory_raw_kernels.copy(dst + filled, dst, size, false);
+        filled += size;
+    }
+}
+
+void *
+ae_memory_raw_set(void *dst, const void *dst_end, const void *src, const void *src_end)
+{
+    ae_runtime_assert(dst && src, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+
+    const ae_usize_t dst_size = ae_memory_raw_range_size(dst, dst_end);
+    const ae_usize_t src_size = ae_memory_raw_range_size(src, src_end);
+
+    ae_runtime_return_if(dst_size == 0 || src_size == 0, dst);
+
+    ae_memory_raw_set_bytes(ae_ptr_cast(ae_u8_t, dst),
+                            dst_size,
+                            ae_ptr_cast(const ae_u8_t, src),
+                            src_size,
+                            dst_size >= m_memory_raw_non_temporal_threshold);
+    return ae_ptr_add_offset_unsafe(void, dst, dst_size);
+}
+
+void *
+ae_memory_raw_translate(void          *dst,
+                        const void    *dst_end,
+                        const void    *src,
+                        const void    *src_end,
+                        const ae_u8_t *table)
+{
+    ae_runtime_assert(dst && src && table, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+
+    const ae_usize_t dst_size = ae_memory_raw_range_size(dst, dst_end);
+    const ae_usize_t src_size = ae_memory_raw_range_size(src, src_end);
+    const ae_usize_t size     = (dst_size < src_size) ? dst_size : src_size;
+
+    m_memory_raw_kernels.translate(ae_ptr_cast(ae_u8_t, dst),
+                                   ae_ptr_cast(const ae_u8_t, src),
+                                   size,
+                                   table);
+    return ae_ptr_add_offset_unsafe(void, dst, size);
+}
+
+/**
+ * @brief Копирует данные, меняя регистр латинских букв, начинающихся с @c first.
+ */
+static void *
+ae_memory_raw_change_case(void       *dst,
+                          const void *dst_end,
+                          const void *src,
+                          const void *src_end,
+                          ae_u8_t     first)
+{
+    ae_runtime_assert(dst && src, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+
+    const ae_usize_t dst_size = ae_memory_raw_range_size(dst, dst_end);
+    const ae_usize_t src_size = ae_memory_raw_range_size(src, src_end);
+    const ae_usize_t size     = (dst_size < src_size) ? dst_size : src_size;
+
+    m_memory_raw_kernels.change_case(ae_ptr_cast(ae_u8_t, dst),
+                                     ae_ptr_cast(const ae_u8_t, src),
+                                     size,
+                                     first);
+    return ae_ptr_add_offset_unsafe(void, dst, size);
+}
+
+void *
+ae_memory_raw_to_upper(void *dst, const void *dst_end, const void *src, const void *src_end)
+{
+    return ae_memory_raw_change_case(dst, dst_end, src, src_end, AE_ASCII_MAP_LOWERCASE_A);
+}
+
+void *
+ae_memory_raw_to_lower(void *dst, const void *dst_end, const void *src, const void *src_end)
+{
+    return ae_memory_raw_change_case(dst, dst_end, src, src_end, AE_ASCII_MAP_UPPERCASE_A);
+}
+
+/**
+ * @brief Операция, выполняемая над частями блока.
+ */
+typedef enum
+{
+    AE_MEMORY_RAW_PARALLEL_COPY,    /**< Копирование. */
+    AE_MEMORY_RAW_PARALLEL_SET,     /**< Заполнение шаблоном. */
+    AE_MEMORY_RAW_PARALLEL_COMPARE, /**< Сравнение. */
+} ae_memory_raw_parallel_op_t;
+
+/**
+ * @brief Контекст параллельной операции над блоком памяти.
+ *
+ * Блок делится на части, границы которых (кроме начала и конца блока)
+ * выровнены по строке кэша относительно основного блока, поэтому разные
+ * потоки не записывают в одну и ту же строку кэша.
+ */
+typedef struct
+{
+    ae_memory_raw_parallel_op_t op;           /**< Выполняемая операция. */
+    ae_u8_t                    *dst;          /**< Блок назначения (копирование, заполнение). */
+    const ae_u8_t              *lhs;          /**< Левый блок сравнения. */
+    const ae_u8_t              *src;          /**< Источник, шаблон или правый блок сравнения. */
+    ae_usize_t                  src_size;     /**< Длина шаблона заполнения. */
+    ae_usize_t                  size;         /**< Размер блока. */
+    ae_usize_t                  head;         /**< Смещение первой выровненной границы. */
+    ae_usize_t                  chunk;        /**< Размер частей (кратен 64 байтам). */
+    bool                        non_temporal; /**< Записывать ли блок в обход кэша. */
+
+    /**
+     * @brief Первое несовпадение в каждой части (nullptr, если его нет).
+     */
+    const ae_u8_t *mismatch[AE_WORKER_POOL_MAX_SIZE * AE_MEMORY_RAW_PARALLEL_CHUNKS_PER_THREAD];
+} ae_memory_raw_parallel_t;
+
+/**
+ * @brief Выполняет операцию над одной частью блока (см. `ae_worker_pool_task_t`).
+ */
+static bool
+ae_memory_raw_parallel_task(void *context, ae_usize_t index)
+{
+    ae_memory_raw_parallel_t *self = ae_ptr_cast(ae_memory_raw_parallel_t, context);
+
+    const ae_usize_t next  = self->head + (index + 1) * self->chunk;
+    const ae_usize_t begin = (index == 0) ? 0 : next - self->chunk;
+    const ae_usize_t end   = (next < self->size) ? next : self->size;
+
+    ae_runtime_return_if(begin >= end, true);
+
+    switch (self->op)
+    {
+    case AE_MEMORY_RAW_PARALLEL_COPY:
+        m_memory_raw_kernels.copy(self->dst + begin,
+                                  self->src + begin,
+                                  end - begin,
+                                  self->non_temporal);
+        return true;
+
+    case AE_MEMORY_RAW_PARALLEL_SET:
+    {
+        /* Часть начинается с середины шаблона: сначала дописывается его остаток. */
+        const ae_usize_t phase = begin % self->src_size;
+        ae_usize_t       pos   = begin;
+
+        if (phase != 0)
+        {
+            const ae_usize_t rest = self->src_size - phase;
+            const ae_usize_t size = (rest < end - pos) ? rest : end - pos;
+
+            m_memory_raw_kernels.copy(self->dst + pos, self->src + phase, size, false);
+            pos += size;
+        }
+
+        if (pos < end)
+        {
+            ae_memory_raw_set_bytes(self->dst + pos,
+                                    end - pos,
+                                    self->src,
+                                    self->src_size,
+                                    self->non_temporal);
+        }
+        return true;
+    }
+
+    case AE_MEMORY_RAW_PARALLEL_COMPARE:
+        /* После несовпадения части с большими номерами больше не выдаются. */
+        self->mismatch[index] =
+            m_memory_raw_kernels.compare(self->lhs + begin, self->src + begin, end - begin);
+        return self->mismatch[index] == nullptr;
+    }
+    return true;
+}
+
+/**
+ * @brief Делит блок на части и выполняет операцию потоками пула.
+ *
+ * @param self Контекст операции с заполненными полями операции, блоков и размера.
+ * @param base Указатель, относительно которого выравниваются границы частей.
+ * @param threads Число участников пула.
+ *
+ * @return Количество частей.
+ */
+static ae_usize_t
+ae_memory_raw_parallel_run(ae_memory_raw_parallel_t *self, const void *base, ae_usize_t threads)
+{
+    const ae_usize_t count = threads * AE_MEMORY_RAW_PARALLEL_CHUNKS_PER_THREAD;
+
+    self->head  = (64 - (ae_ptr_to_addr(base) & 63)) & 63;
+    self->chunk = ((self->size - self->head + count - 1) / count + 63) & ~(ae_usize_t)63;
+
+    ae_worker_pool_run(ae_memory_raw_parallel_task, self, count);
+    return count;
+}
+
+void *
+ae_memory_raw_copy_parallel(void *dst, const void *dst_end, const void *src, const void *src_end)
+{
+    ae_runtime_assert(dst && src, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+
+    const ae_usize_t dst_size = ae_memory_raw_range_size(dst, dst_end);
+    const ae_usize_t src_size = ae_memory_raw_range_size(src, src_end);
+    const ae_usize_t size     = (dst_size < src_size) ? dst_size : src_size;
+    const ae_usize_t threads  = ae_worker_pool_get_size();
+
+    ae_u8_t       *_dst = ae_ptr_cast(ae_u8_t, dst);
+    const ae_u8_t *_src = ae_ptr_cast(const ae_u8_t, src);
+
+    /* Перекрывающиеся блоки нельзя копировать независимыми частями. */
+    if (size < AE_MEMORY_RAW_PARALLEL_THRESHOLD || threads == 1 ||
+        ae_ptr_range_is_overlapped(_dst, _src, _src + size) ||
+        ae_ptr_range_is_overlapped(_src, _dst, _dst + size))
+    {
+        return ae_memory_raw_move(dst, dst_end, src, src_end);
+    }
+
+    ae_memory_raw_parallel_t context;
+    context.op           = AE_MEMORY_RAW_PARALLEL_COPY;
+    context.dst          = _dst;
+    context.src          = _src;
+    context.size         = size;
+    context.non_temporal = size >= m_memory_raw_non_temporal_threshold;
+
+    ae_memory_raw_parallel_run(&context, _dst, threads);
+    return _dst + size;
+}
+
+void *
+ae_memory_raw_set_parallel(void *dst, const void *dst_end, const void *src, const void *src_end)
+{
+    ae_runtime_assert(dst && src, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+
+    const ae_usize_t dst_size = ae_memory_raw_range_size(dst, dst_end);
+    const ae_usize_t src_size = ae_memory_raw_range_size(src, src_end);
+    const ae_usize_t threads  = ae_worker_pool_get_size();
+
+    if (dst_size < AE_MEMORY_RAW_PARALLEL_THRESHOLD || src_size == 0 || threads == 1)
+    {
+        return ae_memory_raw_set(dst, dst_end, src, src_end);
+    }
+
+    ae_memory_raw_parallel_t context;
+    context.op           = AE_MEMORY_RAW_PARALLEL_SET;
+    context.dst          = ae_ptr_cast(ae_u8_t, dst);
+    context.src          = ae_ptr_cast(const ae_u8_t, src);
+    context.src_size     = src_size;
+    context.size         = dst_size;
+    context.non_temporal = dst_size >= m_memory_raw_non_temporal_threshold;
+
+    ae_memory_raw_parallel_run(&context, dst, threads);
+    return ae_ptr_add_offset_unsafe(void, dst, dst_size);
+}
+
+const void *
+ae_memory_raw_compare_parallel(const void *lhs,
+                               const void *lhs_end,
+                               const void *rhs,
+                               const void *rhs_end)
+{
+    ae_runtime_assert(lhs && rhs, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+    ae_runtime_return_if(lhs == rhs, nullptr);
+
+    const ae_usize_t lhs_size = ae_memory_raw_range_size(lhs, lhs_end);
+    const ae_usize_t rhs_size = ae_memory_raw_range_size(rhs, rhs_end);
+    const ae_usize_t size     = (lhs_size < rhs_size) ? lhs_size : rhs_size;
+    const ae_usize_t threads  = ae_worker_pool_get_size();
+
+    if (size < AE_MEMORY_RAW_PARALLEL_THRESHOLD || threads == 1)
+    {
+        return ae_memory_raw_compare(lhs, lhs_end, rhs, rhs_end);
+    }
+
+    ae_memory_raw_parallel_t context;
+    context.op   = AE_MEMORY_RAW_PARALLEL_COMPARE;
+    context.lhs  = ae_ptr_cast(const ae_u8_t, lhs);
+    context.src  = ae_ptr_cast(const ae_u8_t, rhs);
+    context.size = size;
+
+    for (ae_usize_t i = 0; i < ae_array_size(context.mismatch); ++i)
+    {
+        context.mismatch[i] = nullptr;
+    }
+
+    /*
+     * Части выдаются по возрастанию номера, поэтому все части до первой
+     * найденной разницы уже проверены: результатом является первое
+     * несовпадение в части с наименьшим номером.
+     */
+    const ae_usize_t count = ae_memory_raw_parallel_run(&context, lhs, threads);
+    for (ae_usize_t i = 0; i < count; ++i)
+    {
+        ae_runtime_return_if(context.mismatch[i] != nullptr, context.mismatch[i]);
+    }
+    return nullptr;
+}
@@ -0,0 +1,272 @@
+#include <ae/memory_searcher.h>
+/* Дополнительные модули */
+#include <ae/runtime_error_code.h>
+#include <ae/runtime_return_if.h>
+#include <ae/runtime_assert.h>
+#include <ae/numeric_fixed_types.h>
+#include <ae/memory_raw.h>
+#include <ae/ptr_traits.h>
+#include <ae/nullptr.h>
+
+/**
+ * @brief Возвращает байт последовательности с учетом направления поиска.
+ *
+ * При обратном направлении последовательность читается с конца,
+ * что позволяет использовать один и тот же алгоритм для поиска
+ * первого и последнего вхождения.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_u8_t
+ae_memory_searcher_at(const ae_u8_t *data, ae_usize_t size, ae_usize_t index, bool reverse)
+{
+    return reverse ? data[size - 1 - index] : data[index];
+}
+
+/**
+ * @brief Вычисляет максимальный суффикс иглы для заданного порядка байт.
+ *
+ * @param needle Указатель на иглу.
+ * @param size Длина иглы.
+ * @param reverse Направление чтения иглы.
+ * @param greater Использовать обратный порядок сравнения байт.
+ * @param period Указатель для записи периода максимального суффикса.
+ *
+ * @return Позиция начала максимального суффикса.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_usize_t
+ae_memory_searcher_maximal_suffix(const ae_u8_t *needle,
+                                  ae_usize_t     size,
+                                  bool           reverse,
+                                  bool           greater,
+                                  ae_usize_t    *period)
+{
+    /* Позиции хранятся со сдвигом на единицу, чтобы начальное значение было равно 0. */
+    ae_usize_t suffix = 0;
+    ae_usize_t j      = 1;
+    ae_usize_t k      = 1;
+    ae_usize_t p      = 1;
+
+    while (j + k <= size)
+    {
+        const ae_u8_t a = ae_memory_searcher_at(needle, size, suffix + k - 1, reverse);
+        const ae_u8_t b = ae_memory_searcher_at(needle, size, j + k - 1, reverse);
+
+        if (a == b)
+        {
+            if (k == p)
+            {
+                j += p;
+                k = 1;
+            }
+            else
+            {
+                k++;
+            }
+        }
+        else if (greater ? (a < b) : (a > b))
+        {
+            j += k;
+            k = 1;
+            p = j - suffix;
+        }
+        else
+        {
+            suffix = j++;
+            k = p = 1;
+        }
+    }
+
+    *period = p;
+    return suffix;
+}
+
+/**
+ * @brief Подготавливает данные алгоритма Two-Way для одного направления.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN void
+ae_memory_searcher_plan_init(ae_memory_searcher_plan_t *plan,
+                             const ae_u8_t             *needle,
+                             ae_usize_t                 size,
+                             bool                       reverse)
+{
+    ae_usize_t period_less;
+    ae_usize_t period_greater;
+
+    const ae_usize_t suffix_less =
+        ae_memory_searcher_maximal_suffix(needle, size, reverse, false, &period_less);
+    const ae_usize_t suffix_greater =
+        ae_memory_searcher_maximal_suffix(needle, size, reverse, true, &period_greater);
+
+    /* Критическая позиция - наибольший из двух максимальных суффиксов. */
+    const bool       use_greater  = suffix_greater > suffix_less;
+    const ae_usize_t critical_pos = use_greater ? suffix_greater : suffix_less;
+    ae_usize_t       period       = use_greater ? period_greater : period_less;
+
+    /* Игла периодична, если левая часть повторяется через период. */
+    bool periodic = period + critical_pos <= size;
+    for (ae_usize_t i = 0; periodic && i < critical_pos; ++i)
+    {
+        periodic = ae_memory_searcher_at(needle, size, i, reverse) ==
+                   ae_memory_searcher_at(needle, size, i + period, reverse);
+    }
+
+    if (periodic)
+    {
+        plan->memory = size - period;
+    }
+    else
+    {
+        const ae_usize_t left  = critical_pos - 1;
+        const ae_usize_t right = size - critical_pos;
+        plan->memory           = 0;
+        period                 = ((left > right) ? left : right) + 1;
+    }
+
+    plan->critical_pos = critical_pos;
+    plan->period       = period;
+
+    for (ae_usize_t i = 0; i < 256; ++i)
+    {
+        plan->shift[i] = 0;
+    }
+
+    for (ae_usize_t i = 0; i < size; ++i)
+    {
+        plan->shift[ae_memory_searcher_at(needle, size, i, reverse)] = i + 1;
+    }
+}
+
+/**
+ * @brief Выполняет поиск алгоритмом Two-Way в заданном направлении.
+ *
+ * @return Указатель на начало найденного вхождения (в исходных координатах буфера)
+ *         или nullptr.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN const ae_u8_t *
+ae_memory_searcher_two_way(const ae_memory_searcher_plan_t *plan,
+                           const ae_u8_t                   *needle,
+                           ae_usize_t                       needle_size,
+                           const ae_u8_t                   *haystack,
+                           ae_usize_t                       haystack_size,
+                           bool                             reverse)
+{
+    ae_runtime_return_if(needle_size > haystack_size, nullptr);
+
+    const ae_usize_t critical_pos = plan->critical_pos;
+    const ae_usize_t last_pos     = haystack_size - needle_size;
+    ae_usize_t       memory       = 0;
+    ae_usize_t       pos          = 0;
+
+    while (pos <= last_pos)
+    {
+        /* Быстрый пропуск по последнему байту окна. */
+        const ae_u8_t last =
+            ae_memory_searcher_at(haystack, haystack_size, pos + needle_size - 1, reverse);
+        ae_usize_t k = needle_size - plan->shift[last];
+
+        if (k != 0)
+        {
+            pos += (k < memory) ? memory : k;
+            memory = 0;
+            continue;
+        }
+
+        /* Сравнение правой части иглы. */
+        for (k = (critical_pos > memory) ? critical_pos : memory;
+             k < needle_size &&
+             ae_memory_searcher_at(needle, needle_size, k, reverse) ==
+                 ae_memory_searcher_at(haystack, haystack_size, pos + k, reverse);
+             ++k)
+        {
+        }
+
+        if (k < needle_size)
+        {
+            pos += k - critical_pos + 1;
+            memory = 0;
+            continue;
+        }
+
+        /* Сравнение левой части иглы. */
+        for (k = critical_pos;
+             k > memory &&
+             ae_memory_searcher_at(needle, needle_size, k - 1, reverse) ==
+                 ae_memory_searcher_at(haystack, haystack_size, pos + k - 1, reverse);
+             --k)
+        {
+        }
+
+        if (k <= memory)
+        {
+            return reverse ? haystack + (haystack_size - pos - needle_size) : haystack + pos;
+        }
+
+        pos += plan->period;
+        memory = plan->memory;
+    }
+
+    return nullptr;
+}
+
+void
+ae_memory_searcher_init(ae_memory_searcher_t *self, const void *needle, const void *needle_end)
+{
+    ae_runtime_assert(self && needle, AE_RUNTIME_ERROR_NULL_POINTER, );
+
+    self->needle     = needle;
+    self->needle_end = (needle_end > needle) ? needle_end : needle;
+
+    const ae_usize_t size = ae_ptr_to_addr_diff(self->needle_end, self->needle);
+
+    /* Короткие иглы ищутся SIMD-фильтром, которому подготовка не нужна. */
+    if (size > AE_MEMORY_SEARCHER_SHORT_NEEDLE_SIZE)
+    {
+        ae_memory_searcher_plan_init(&self->forward, needle, size, false);
+        ae_memory_searcher_plan_init(&self->backward, needle, size, true);
+    }
+}
+
+const void *
+ae_memory_searcher_find(const ae_memory_searcher_t *self, const void *begin, const void *end)
+{
+    ae_runtime_assert(self && begin, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+
+    const ae_usize_t needle_size = ae_ptr_to_addr_diff(self->needle_end, self->needle);
+
+    if (needle_size <= AE_MEMORY_SEARCHER_SHORT_NEEDLE_SIZE)
+    {
+        return ae_memory_raw_find(begin, end, self->needle, self->needle_end);
+    }
+
+    ae_runtime_return_if(end <= begin, nullptr);
+
+    return ae_memory_searcher_two_way(&self->forward,
+                                      self->needle,
+                                      needle_size,
+                                      begin,
+                                      ae_ptr_to_addr_diff(end, begin),
+                                      false);
+}
+
+const void *
+ae_memory_searcher_find_from_end(const ae_memory_searcher_t *self,
+                                 const void                 *begin,
+                                 const void                 *end)
+{
+    ae_runtime_assert(self && begin, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+
+    const ae_usize_t needle_size = ae_ptr_to_addr_diff(self->needle_end, self->needle);
+
+    if (needle_size <= AE_MEMORY_SEARCHER_SHORT_NEEDLE_SIZE)
+    {
+        return ae_memory_raw_find_from_end(begin, end, self->needle, self->needle_end);
+    }
+
+    ae_runtime_return_if(end <= begin, nullptr);
+
+    return ae_memory_searcher_two_way(&self->backward,
+                                      self->needle,
+                                      needle_size,
+                                      begin,
+                                      ae_ptr_to_addr_diff(end, begin),
+                                      true);
+}
@@ -0,0 +1,392 @@
+#include <ae/pool_allocator.h>
+/* Дополнительные модули */
+#include <ae/memory_allocator_initializer.h>
+#include <ae/runtime_error_code.h>
+#include <ae/runtime_return_if.h>
+#include <ae/runtime_assert.h>
+#include <ae/addr_traits.h>
+#include <ae/ptr_traits.h>
+#include <ae/bit_scan.h>
+#include <ae/str_raw.h>
+#include <ae/nullptr.h>
+
+#if (AE_POOL_ALLOCATOR_SLAB_SIZE & (AE_POOL_ALLOCATOR_SLAB_SIZE - 1)) != 0 ||                      \
+    AE_POOL_ALLOCATOR_SLAB_SIZE < 2 * AE_POOL_ALLOCATOR_MAX_SIZE
+#    error "AE_POOL_ALLOCATOR_SLAB_SIZE must be a power of two of at least 2 * MAX_SIZE"
+#endif
+
+/**
+ * @brief Размер заголовка слэба (одна строка кэша).
+ */
+#define AE_POOL_ALLOCATOR_HEADER_SIZE 64
+
+/**
+ * @brief Индекс класса, которым помечаются крупные блоки.
+ */
+#define AE_POOL_ALLOCATOR_LARGE_CLASS AE_POOL_ALLOCATOR_CLASS_COUNT
+
+/**
+ * @brief Заголовок слэба или крупного блока, расположенный в его начале.
+ */
+typedef struct ae_pool_allocator_slab
+{
+    /**
+     * @brief Предыдущий элемент списка слэбов пула.
+     */
+    struct ae_pool_allocator_slab *prev;
+
+    /**
+     * @brief Следующий элемент списка слэбов пула.
+     */
+    struct ae_pool_allocator_slab *next;
+
+    /**
+     * @brief Индекс класса блоков слэба или `AE_POOL_ALLOCATOR_LARGE_CLASS`.
+     */
+    ae_usize_t class_index;
+
+    /**
+     * @brief Размер области данных крупного блока в байтах.
+     */
+    ae_usize_t capacity;
+} ae_pool_allocator_slab_t;
+
+/**
+ * @brief Возвращает индекс наименьшего класса, вмещающего @c size байт.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_usize_t
+ae_pool_allocator_class_index(ae_usize_t size)
+{
+    ae_runtime_return_if(size <= AE_POOL_ALLOCATOR_MIN_SIZE, 0);
+    return ae_bit_scan_reverse64(size - 1) - 3;
+}
+
+/**
+ * @brief Возвращает размер блоков класса.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_usize_t
+ae_pool_allocator_class_size(ae_usize_t class_index)
+{
+    return (ae_usize_t)AE_POOL_ALLOCATOR_MIN_SIZE << class_index;
+}
+
+/**
+ * @brief Возвращает слэб, которому принадлежит блок.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_pool_allocator_slab_t *
+ae_pool_allocator_slab_of(const void *ptr)
+{
+    const ae_uaddr_t addr = ae_ptr_to_addr(ptr) & ~(ae_uaddr_t)(AE_POOL_ALLOCATOR_SLAB_SIZE - 1);
+    return ae_addr_to_ptr(ae_pool_allocator_slab_t, addr);
+}
+
+/**
+ * @brief Добавляет слэб в начало списка слэбов пула.
+ */
+static void
+ae_pool_allocator_link(ae_pool_allocator_t *self, ae_pool_allocator_slab_t *slab)
+{
+    slab->prev = nullptr;
+    slab->next = self->slabs;
+
+    if (self->slabs)
+    {
+        self->slabs->prev = slab;
+    }
+    self->slabs = slab;
+}
+
+/**
+ * @brief Удаляет слэб из списка слэбов пула.
+ */
+static void
+ae_pool_allocator_unlink(ae_pool_allocator_t *self, ae_pool_allocator_slab_t *slab)
+{
+    if (slab->prev)
+    {
+        slab->prev->next = slab->next;
+    }
+    else
+    {
+        self->slabs = slab->next;
+    }
+
+    if (slab->next)
+    {
+        slab->next->prev = slab->prev;
+    }
+}
+
+/**
+ * @brief Запрашивает у родительского аллокатора новый слэб класса
+ *        и делает его текущим для нарезки блоков.
+ */
+static bool
+ae_pool_allocator_add_slab(ae_pool_allocator_t *self, ae_usize_t class_index)
+{
+    ae_pool_allocator_slab_t *slab = ae_memory_allocator_align_alloc(self->parent,
+                                                                     AE_POOL_ALLOCATOR_SLAB_SIZE,
+                                                                     AE_POOL_ALLOCATOR_SLAB_SIZE);
+    ae_runtime_return_if_not(slab, false);
+
+    slab->class_index = class_index;
+    slab->capacity    = 0;
+    ae_pool_allocator_link(self, slab);
+    ++self->stats.slab_count;
+
+    // Блоки начинаются со смещения, кратного их размеру, поэтому выровнены по нему.
+    const ae_usize_t block_size = ae_pool_allocator_class_size(class_index);
+    const ae_usize_t offset     = (block_size > AE_POOL_ALLOCATOR_HEADER_SIZE)
+                                      ? block_size
+                                      : AE_POOL_ALLOCATOR_HEADER_SIZE;
+    const ae_usize_t count      = (AE_POOL_ALLOCATOR_SLAB_SIZE - offset) / block_size;
+
+    ae_pool_allocator_class_t *cls = &self->classes[class_index];
+
+    cls->cursor = ae_ptr_add_offset_unsafe(void, slab, offset);
+    cls->limit  = ae_ptr_add_offset_unsafe(void, cls->cursor, count * block_size);
+    return true;
+}
+
+/**
+ * @brief Выдает блок класса: сначала последний освобожденный, затем из текущего слэба.
+ */
+static void *
+ae_pool_allocator_take(ae_pool_allocator_t *self, ae_usize_t class_index)
+{
+    ae_pool_allocator_class_t       *cls   = &self->classes[class_index];
+    ae_pool_allocator_class_stats_t *stats = &self->stats.classes[class_index];
+    void                            *ptr   = cls->free_list;
+
+    if (ptr)
+    {
+        cls->free_list = *ae_ptr_cast(void *, ptr);
+        --stats->cached;
+    }
+    else
+    {
+        if (cls->cursor == cls->limit)
+        {
+            ae_runtime_return_if_not(ae_pool_allocator_add_slab(self, class_index), nullptr);
+        }
+
+        ptr         = cls->cursor;
+        cls->cursor = ae_ptr_add_offset_unsafe(void, ptr, stats->block_size);
+    }
+
+    ++stats->in_use;
+    ++stats->total_allocs;
+    return ptr;
+}
+
+/**
+ * @brief Выделяет крупный блок отдельным запросом к родительскому аллокатору.
+ *
+ * Заголовок размещается в начале области, выровненной по размеру слэба,
+ * а данные - ближе размера слэба к нему, поэтому заголовок находится по адресу блока
+ * так же, как заголовок слэба.
+ */
+static void *
+ae_pool_allocator_take_large(ae_pool_allocator_t *self, ae_usize_t size, ae_usize_t alignment)
+{
+    const ae_usize_t offset =
+        (alignment > AE_POOL_ALLOCATOR_HEADER_SIZE) ? alignment : AE_POOL_ALLOCATOR_HEADER_SIZE;
+
+    ae_runtime_return_if(offset >= AE_POOL_ALLOCATOR_SLAB_SIZE, nullptr);
+    ae_runtime_return_if(size > AE_USIZE_T_MAX - offset, nullptr);
+
+    ae_pool_allocator_slab_t *slab =
+        ae_memory_allocator_align_alloc(self->parent, offset + size, AE_POOL_ALLOCATOR_SLAB_SIZE);
+    ae_runtime_return_if_not(slab, nullptr);
+
+    slab->class_index = AE_POOL_ALLOCATOR_LARGE_CLASS;
+    slab->capacity    = size;
+    ae_pool_allocator_link(self, slab);
+
+    ++self->stats.large_in_use;
+    ++self->stats.large_total_allocs;
+    return ae_ptr_add_offset_unsafe(void, slab, offset);
+}
+
+/**
+ * @brief Выделяет блок размером @c size, выровненный по @c alignment.
+ */
+static void *
+ae_pool_allocator_take_aligned(ae_pool_allocator_t *self, ae_usize_t size, ae_usize_t alignment)
+{
+    const ae_usize_t required = (size > alignment) ? size : alignment;
+
+    if (required <= AE_POOL_ALLOCATOR_MAX_SIZE)
+    {
+        return ae_pool_allocator_take(self, ae_pool_allocator_class_index(required));
+    }
+    return ae_pool_allocator_take_large(self, size, alignment);
+}
+
+/**
+ * @brief Проверяет, что блок размером @c new_size с выравниванием @c alignment
+ *        был бы выделен в том же классе, что и блок @c ptr, и может остаться на месте.
+ */
+static bool
+ae_pool_allocator_fits(const void *ptr, ae_usize_t new_size, ae_usize_t alignment)
+{
+    const ae_pool_allocator_slab_t *slab     = ae_pool_allocator_slab_of(ptr);
+    const ae_usize_t                required = (new_size > alignment) ? new_size : alignment;
+
+    if (slab->class_index == AE_POOL_ALLOCATOR_LARGE_CLASS)
+    {
+        return required > AE_POOL_ALLOCATOR_MAX_SIZE && new_size <= slab->capacity &&
+               ae_ptr_is_aligned(ptr, alignment);
+    }
+
+    return required <= AE_POOL_ALLOCATOR_MAX_SIZE &&
+           ae_pool_allocator_class_index(required) == slab->class_index;
+}
+
+/**
+ * @brief Функция выделения памяти интерфейса пула.
+ */
+static void *
+ae_pool_allocator_alloc(void *context, ae_usize_t size)
+{
+    return ae_pool_allocator_take_aligned(context, size, AE_POOL_ALLOCATOR_MIN_SIZE);
+}
+
+/**
+ * @brief Функция освобождения памяти интерфейса пула: возвращает блок в список класса
+ *        или крупный блок родительскому аллокатору.
+ */
+static void
+ae_pool_allocator_free(void *context, void *ptr)
+{
+    ae_pool_allocator_t      *self = context;
+    ae_pool_allocator_slab_t *slab = ae_pool_allocator_slab_of(ptr);
+
+    if (slab->class_index == AE_POOL_ALLOCATOR_LARGE_CLASS)
+    {
+        ae_pool_allocator_unlink(self, slab);
+        ae_memory_allocator_align_free(self->parent, slab);
+        --self->stats.large_in_use;
+        return;
+    }
+
+    ae_pool_allocator_class_t       *cls   = &self->classes[slab->class_index];
+    ae_pool_allocator_class_stats_t *stats = &self->stats.classes[slab->class_index];
+
+    *ae_ptr_cast(void *, ptr) = cls->free_list;
+    cls->free_list            = ptr;
+
+    --stats->in_use;
+    ++stats->cached;
+}
+
+/**
+ * @brief Функция изменения размера блока на месте: размер меняется,
+ *        пока новый размер относится к классу блока.
+ */
+static bool
+ae_pool_allocator_expand(void *context, void *ptr, ae_usize_t old_size, ae_usize_t new_size)
+{
+    (void)context;
+    (void)old_size;
+    return ae_pool_allocator_fits(ptr, new_size, AE_POOL_ALLOCATOR_MIN_SIZE);
+}
+
+/**
+ * @brief Функция выделения выровненной памяти интерфейса пула.
+ */
+static void *
+ae_pool_allocator_align_alloc(void *context, ae_usize_t size, ae_usize_t alignment)
+{
+    return ae_pool_allocator_take_aligned(context, size, alignment);
+}
+
+/**
+ * @brief Функция изменения размера выровненного блока: блок остается на месте,
+ *        если новый размер относится к его классу, иначе копируется в блок подходящего класса.
+ */
+static void *
+ae_pool_allocator_align_realloc(void      *context,
+                                void      *ptr,
+                                ae_usize_t old_size,
+                                ae_usize_t new_size,
+                                ae_usize_t alignment)
+{
+    ae_runtime_return_if(ae_pool_allocator_fits(ptr, new_size, alignment), ptr);
+
+    void *new_ptr = ae_pool_allocator_take_aligned(context, new_size, alignment);
+
+    if (new_ptr)
+    {
+        ae_str_raw_copy(new_ptr, new_size, ptr, old_size);
+        ae_pool_allocator_free(context, ptr);
+    }
+    return new_ptr;
+}
+
+void
+ae_pool_allocator_init(ae_pool_allocator_t *self, const ae_memory_allocator_t *parent)
+{
+    ae_runtime_assert(self && parent, AE_RUNTIME_ERROR_NULL_POINTER, );
+
+    const ae_memory_allocator_t allocator =
+        ae_memory_allocator_initializer(ae_pool_allocator_alloc,
+                                        ae_pool_allocator_free,
+                                        self,
+                                        nullptr,
+                                        ae_pool_allocator_expand,
+                                        ae_pool_allocator_align_alloc,
+                                        ae_pool_allocator_free,
+                                        ae_pool_allocator_align_realloc,
+                                        nullptr);
+
+    self->allocator = allocator;
+    self->parent    = parent;
+    self->slabs     = nullptr;
+
+    for (ae_usize_t i = 0; i < AE_POOL_ALLOCATOR_CLASS_COUNT; ++i)
+    {
+        self->classes[i].free_list = nullptr;
+        self->classes[i].cursor    = nullptr;
+        self->classes[i].limit     = nullptr;
+
+        self->stats.classes[i].block_size   = ae_pool_allocator_class_size(i);
+        self->stats.classes[i].in_use       = 0;
+        self->stats.classes[i].cached       = 0;
+        self->stats.classes[i].total_allocs = 0;
+    }
+
+    self->stats.slab_count         = 0;
+    self->stats.large_in_use       = 0;
+    self->stats.large_total_allocs = 0;
+}
+
+const ae_memory_allocator_t *
+ae_pool_allocator_get_allocator(const ae_pool_allocator_t *self)
+{
+    ae_runtime_assert(self, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+    return &self->allocator;
+}
+
+const ae_pool_allocator_stats_t *
+ae_pool_allocator_get_stats(const ae_pool_allocator_t *self)
+{
+    ae_runtime_assert(self, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+    return &self->stats;
+}
+
+void
+ae_pool_allocator_clear(ae_pool_allocator_t *self)
+{
+    ae_runtime_assert(self, AE_RUNTIME_ERROR_NULL_POINTER, );
+
+    while (self->slabs)
+    {
+        ae_pool_allocator_slab_t *slab = self->slabs;
+
+        self->slabs = slab->next;
+        ae_memory_allocator_align_free(self->parent, slab);
+    }
+
+    ae_pool_allocator_init(self, self->parent);
+}
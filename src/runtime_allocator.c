@@ -2,6 +2,149 @@
 /* Дополнительные модули */
 #include <ae/memory_allocator_initializer.h>
 
+#ifdef AE_LIBRARY_OPTION_RUNTIME_ALLOCATOR_INIT_STDLIB
+#    include <ae/str_raw.h>
+#    include <stdlib.h>
+#    include <stddef.h>
+#    if defined(_WIN32)
+#        include <malloc.h>
+#    endif // _WIN32
+
+/**
+ * @brief Выделяет память функцией `malloc`; контекст не используется.
+ */
+static void *
+ae_runtime_allocator_stdlib_alloc(void *context, ae_usize_t size)
+{
+    (void)context;
+    return malloc(size);
+}
+
+/**
+ * @brief Изменяет размер блока функцией `realloc`; контекст не используется.
+ *
+ * `realloc` продлевает блок на месте, когда за ним есть свободная память;
+ * glibc перемещает крупные блоки, выделенные через `mmap`, без копирования (`mremap`).
+ */
+static void *
+ae_runtime_allocator_stdlib_realloc(void      *context,
+                                    void      *ptr,
+                                    ae_usize_t old_size,
+                                    ae_usize_t new_size)
+{
+    (void)context;
+    (void)old_size;
+    return realloc(ptr, new_size);
+}
+
+/**
+ * @brief Освобождает память функцией `free`; контекст не используется.
+ */
+static void
+ae_runtime_allocator_stdlib_free(void *context, void *ptr)
+{
+    (void)context;
+    free(ptr);
+}
+
+#    if defined(_WIN32)
+/**
+ * @brief Выделяет выровненную память функцией `_aligned_malloc`.
+ */
+static void *
+ae_runtime_allocator_stdlib_align_alloc(void *context, ae_usize_t size, ae_usize_t alignment)
+{
+    (void)context;
+    return _aligned_malloc(size, alignment);
+}
+
+/**
+ * @brief Освобождает выровненную память функцией `_aligned_free`.
+ */
+static void
+ae_runtime_allocator_stdlib_align_free(void *context, void *ptr)
+{
+    (void)context;
+    _aligned_free(ptr);
+}
+
+/**
+ * @brief Изменяет размер выровненного блока функцией `_aligned_realloc`.
+ */
+static void *
+ae_runtime_allocator_stdlib_align_realloc(void      *context,
+                                          void      *ptr,
+                                          ae_usize_t old_size,
+                                          ae_usize_t new_size,
+                                          ae_usize_t alignment)
+{
+    (void)context;
+    (void)old_size;
+    return _aligned_realloc(ptr, new_size, alignment);
+}
+#    else
+/**
+ * @brief Выделяет выровненную память.
+ *
+ * Выравнивание, которое `malloc` гарантирует для любого типа, не требует
+ * отдельной функции; для большего выравнивания используется `posix_memalign`,
+ * возвращающий неиспользованный запас в кучу. Оба способа освобождаются `free`.
+ */
+static void *
+ae_runtime_allocator_stdlib_align_alloc(void *context, ae_usize_t size, ae_usize_t alignment)
+{
+    (void)context;
+
+    if (alignment <= _Alignof(max_align_t))
+    {
+        return malloc(size);
+    }
+
+    void *ptr = nullptr;
+    return (posix_memalign(&ptr, alignment, size) == 0) ? ptr : nullptr;
+}
+
+/**
+ * @brief Освобождает выровненную память функцией `free`.
+ */
+static void
+ae_runtime_allocator_stdlib_align_free(void *context, void *ptr)
+{
+    (void)context;
+    free(ptr);
+}
+
+/**
+ * @brief Изменяет размер выровненного блока.
+ *
+ * При выравнивании не больше гарантированного `malloc` используется `realloc`,
+ * который может продлить блок на месте. Для большего выравнивания `realloc`
+ * не сохраняет его, поэтому блок копируется во вновь выделенный.
+ */
+static void *
+ae_runtime_allocator_stdlib_align_realloc(void      *context,
+                                          void      *ptr,
+                                          ae_usize_t old_size,
+                                          ae_usize_t new_size,
+                                          ae_usize_t alignment)
+{
+    if (alignment <= _Alignof(max_align_t))
+    {
+        return realloc(ptr, new_size);
+    }
+
+    void *new_ptr = ae_runtime_allocator_stdlib_align_alloc(context, new_size, alignment);
+
+    if (new_ptr)
+    {
+        ae_str_raw_copy(new_ptr, new_size, ptr, old_size);
+        free(ptr);
+    }
+    return new_ptr;
+}
+#    endif // _WIN32
+#endif // AE_LIBRARY_OPTION_RUNTIME_ALLOCATOR_INIT_STDLIB
+
 /**
  * @brief Определяет локальный для потока распределитель памяти времени выполнения,
  *        при необходимости инициализируемый с помощью функций стандартной библиотеки.
@@ -13,8 +156,11 @@
  * определена ли `AE_LIBRARY_OPTION_RUNTIME_ALLOCATOR_INIT_STDLIB`:
  *
  * - Если `AE_LIBRARY_OPTION_RUNTIME_ALLOCATOR_INIT_STDLIB` определена,
- *   распределитель инициализируется с использованием функции `malloc`
- *   стандартной библиотеки для выделения памяти и `free` для освобождения памяти.
+ *   распределитель инициализируется обертками над функциями стандартной библиотеки:
+ *   `malloc` для выделения, `realloc` для изменения размера и `free`
+ *   для освобождения памяти. Выровненная память выделяется собственными
+ *   средствами платформы (`posix_memalign` или `_aligned_malloc`) без запаса
+ *   на сохранение невыравненного указателя.
  *
  * - Если `AE_LIBRARY_OPTION_RUNTIME_ALLOCATOR_INIT_STDLIB` не определена,
  *   функции выделения и освобождения памяти инициализируются значением `nullptr`.
@@ -27,10 +173,17 @@
  *        `m_runtime_allocator`.
  */
 #ifdef AE_LIBRARY_OPTION_RUNTIME_ALLOCATOR_INIT_STDLIB
-#    include <stdlib.h>
-
 AE_ATTRIBUTE(THREAD_LOCAL)
-ae_memory_allocator_t m_runtime_allocator = ae_memory_allocator_initializer(malloc, free);
+ae_memory_allocator_t m_runtime_allocator =
+    ae_memory_allocator_initializer(ae_runtime_allocator_stdlib_alloc,
+                                    ae_runtime_allocator_stdlib_free,
+                                    nullptr,
+                                    ae_runtime_allocator_stdlib_realloc,
+                                    nullptr,
+                                    ae_runtime_allocator_stdlib_align_alloc,
+                                    ae_runtime_allocator_stdlib_align_free,
+                                    ae_runtime_allocator_stdlib_align_realloc,
+                                    nullptr);
 #else
 AE_ATTRIBUTE(THREAD_LOCAL)
 ae_memory_allocator_t m_runtime_allocator = ae_memory_allocator_empty_initializer();
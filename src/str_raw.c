@@ -6,6 +6,9 @@
 #include <ae/runtime_try.h>
 #include <ae/ptr_traits.h>
 #include <ae/memory_raw.h>
+#include <ae/byte_class.h>
+#include <ae/array_size.h>
+#include <ae/nullptr.h>
 #include <ae/ascii_map.h>
 
 /**
@@ -33,19 +36,36 @@ static const ae_char_t m_trim_ascii_chars[] = {AE_ASCII_MAP_SPACE,
                                                AE_ASCII_MAP_VERTICAL_TAB,
                                                AE_ASCII_MAP_NULL_TERMINATOR};
 
+/**
+ * @brief Класс байт, содержащий символы `m_trim_ascii_chars`.
+ *
+ * Заполняется конструктором `ae_str_raw_trim_ascii_class_init` при загрузке библиотеки
+ * и используется функциями обрезки для векторного поиска.
+ */
+ae_byte_class_t m_trim_ascii_class;
+
+/**
+ * @brief Конструктор, заполняющий класс `m_trim_ascii_class`.
+ */
+ae_compiler_constructor(ae_str_raw_trim_ascii_class_init)
+{
+    ae_byte_class_init(&m_trim_ascii_class);
+    ae_byte_class_add_range(&m_trim_ascii_class,
+                            m_trim_ascii_chars,
+                            m_trim_ascii_chars + ae_array_size(m_trim_ascii_chars));
+}
+
 const ae_char_t *
 ae_str_raw_find_char(const ae_char_t *str, ae_usize_t len, ae_char_t value)
 {
     const void *_str_end = ae_ptr_add(void, str, len);
-    const void *_val_end = ae_ptr_add_unsafe(void, &value, AE_CHAR_T_SIZE);
-    return ae_memory_raw_find(str, _str_end, &value, _val_end);
+    return ae_memory_raw_find_byte(str, _str_end, (ae_u8_t)value);
 }
 
 const ae_char_t *
 ae_str_raw_find_of_null_terminator(const ae_char_t *str)
 {
-    const ae_usize_t _len = AE_UINTPTR_T_MAX - ae_ptr_to_addr(str);
-    return ae_str_raw_find_char(str, _len, AE_ASCII_MAP_NULL_TERMINATOR);
+    return ae_memory_raw_find_null_terminator(str, AE_CHAR_T_SIZE);
 }
 
 ae_usize_t
@@ -100,4 +120,114 @@ ae_str_raw_compare_from_end(const ae_char_t *str,
     const void *_str_end = ae_ptr_add_offset(const void, str, str_len);
     const void *_src_end = ae_ptr_add_offset(const void, src, src_len);
     return ae_memory_raw_compare_from_end(str, _str_end, src, _src_end);
-}
\ No newline at end of file
+}
+
+const ae_char_t *
+ae_str_raw_compare_icase(const ae_char_t *str,
+                         ae_usize_t       str_len,
+                         const ae_char_t *src,
+                         ae_usize_t       src_len)
+{
+    const void *_str_end = ae_ptr_add_offset(const void, str, str_len);
+    const void *_src_end = ae_ptr_add_offset(const void, src, src_len);
+    return ae_memory_raw_compare_icase(str, _str_end, src, _src_end);
+}
+
+ae_sint_t
+ae_str_raw_order(const ae_char_t *str,
+                 ae_usize_t       str_len,
+                 const ae_char_t *src,
+                 ae_usize_t       src_len)
+{
+    const void *_str_end = ae_ptr_add_offset(const void, str, str_len);
+    const void *_src_end = ae_ptr_add_offset(const void, src, src_len);
+    return ae_memory_raw_order(str, _str_end, src, _src_end);
+}
+
+bool
+ae_str_raw_is_ascii(const ae_char_t *str, ae_usize_t len)
+{
+    ae_runtime_assert(str, AE_RUNTIME_ERROR_NULL_POINTER, false);
+
+    const void *_str_end = ae_ptr_add_offset(const void, str, len);
+    return ae_memory_raw_is_ascii(str, _str_end);
+}
+
+const ae_char_t *
+ae_str_raw_find_any_char(const ae_char_t *str,
+                         ae_usize_t       len,
+                         const ae_char_t *chars,
+                         ae_usize_t       chars_len)
+{
+    ae_runtime_assert(chars, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+
+    const void *_str_end = ae_ptr_add_offset(const void, str, len);
+
+    switch (chars_len)
+    {
+        case 0:
+            ae_runtime_assert(str, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+            return nullptr;
+        case 1:
+            return ae_memory_raw_find_byte(str, _str_end, (ae_u8_t)chars[0]);
+        case 2:
+            return ae_memory_raw_find_byte2(str, _str_end, (ae_u8_t)chars[0], (ae_u8_t)chars[1]);
+        case 3:
+            return ae_memory_raw_find_byte3(str,
+                                            _str_end,
+                                            (ae_u8_t)chars[0],
+                                            (ae_u8_t)chars[1],
+                                            (ae_u8_t)chars[2]);
+        default:
+        {
+            ae_byte_class_t cls;
+            ae_byte_class_init(&cls);
+            ae_byte_class_add_range(&cls, chars, chars + chars_len);
+            return ae_memory_raw_find_class(str, _str_end, &cls);
+        }
+    }
+}
+
+const ae_char_t *
+ae_str_raw_trim_left(const ae_char_t *str, ae_usize_t len)
+{
+    const void      *_str_end = ae_ptr_add_offset(const void, str, len);
+    const ae_char_t *ptr      = ae_memory_raw_find_not_class(str, _str_end, &m_trim_ascii_class);
+    return ptr ? ptr : _str_end;
+}
+
+const ae_char_t *
+ae_str_raw_trim_right(const ae_char_t *str, ae_usize_t len)
+{
+    const void      *_str_end = ae_ptr_add_offset(const void, str, len);
+    const ae_char_t *ptr =
+        ae_memory_raw_find_not_class_from_end(str, _str_end, &m_trim_ascii_class);
+    return ptr ? ptr + 1 : str;
+}
+
+const ae_char_t *
+ae_str_raw_tokenize(const ae_char_t *str,
+                    ae_usize_t       len,
+                    const ae_char_t *delims,
+                    ae_usize_t       delims_len,
+                    ae_usize_t      *token_len)
+{
+    ae_runtime_assert(str && delims && token_len, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+
+    ae_byte_class_t cls;
+    ae_byte_class_init(&cls);
+    ae_byte_class_add_range(&cls, delims, delims + delims_len);
+
+    const ae_char_t *_str_end = str + len;
+    const ae_char_t *begin    = ae_memory_raw_find_not_class(str, _str_end, &cls);
+    ae_runtime_return_if(!begin, nullptr);
+
+    const ae_char_t *end = ae_memory_raw_find_class(begin, _str_end, &cls);
+    if (!end)
+    {
+        end = _str_end;
+    }
+
+    *token_len = ae_ptr_diff(end, begin);
+    return begin;
+}
@@ -0,0 +1,109 @@
+#include <ae/str_splitter.h>
+/* Дополнительные модули */
+#include <ae/runtime_error_code.h>
+#include <ae/runtime_return_if.h>
+#include <ae/runtime_assert.h>
+#include <ae/memory_raw.h>
+#include <ae/ptr_traits.h>
+#include <ae/bit_scan.h>
+#include <ae/nullptr.h>
+
+/**
+ * @brief Возвращает количество байт от окна @c window до конца строки.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_usize_t
+ae_str_splitter_window_left(const ae_str_splitter_t *self)
+{
+    return ae_ptr_to_addr_diff(self->end, self->window);
+}
+
+/**
+ * @brief Выделяет следующее поле; аргументы должны быть проверены вызывающей стороной.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN bool
+ae_str_splitter_take(ae_str_splitter_t *self, ae_memory_range_t *token)
+{
+    ae_runtime_return_if(self->done, false);
+
+    /* Маска следующего окна строится, только когда разделители текущего исчерпаны. */
+    while (self->mask == 0)
+    {
+        if (ae_str_splitter_window_left(self) <= 64)
+        {
+            token->lower = ae_ptr_cast(void, self->begin);
+            token->upper = ae_ptr_cast(void, self->end);
+            self->begin  = self->end;
+            self->done   = true;
+            return true;
+        }
+
+        self->window += 64;
+        self->mask = ae_memory_raw_match_class(self->window, self->end, &self->cls);
+    }
+
+    const ae_char_t *delim = self->window + ae_bit_scan_forward64(self->mask);
+
+    token->lower = ae_ptr_cast(void, self->begin);
+    token->upper = ae_ptr_cast(void, delim);
+    self->begin  = delim + 1;
+    self->mask &= self->mask - 1;
+    return true;
+}
+
+void
+ae_str_splitter_init(ae_str_splitter_t *self,
+                     const ae_char_t   *str,
+                     ae_usize_t         len,
+                     const ae_char_t   *delims,
+                     ae_usize_t         delims_len)
+{
+    ae_runtime_assert(self && str && delims, AE_RUNTIME_ERROR_NULL_POINTER, );
+
+    ae_byte_class_init(&self->cls);
+    ae_byte_class_add_range(&self->cls, delims, delims + delims_len);
+
+    self->begin = str;
+    self->end   = str + len;
+    self->done  = false;
+
+    /* Без разделителей окна не просматриваются: вся строка является одним полем. */
+    self->window = (delims_len != 0) ? str : self->end;
+    self->mask   = ae_memory_raw_match_class(self->window, self->end, &self->cls);
+}
+
+void
+ae_str_splitter_init_char(ae_str_splitter_t *self,
+                          const ae_char_t   *str,
+                          ae_usize_t         len,
+                          ae_char_t          delim)
+{
+    ae_str_splitter_init(self, str, len, &delim, 1);
+}
+
+bool
+ae_str_splitter_next(ae_str_splitter_t *self, ae_memory_range_t *token)
+{
+    ae_runtime_assert(self && token, AE_RUNTIME_ERROR_NULL_POINTER, false);
+    return ae_str_splitter_take(self, token);
+}
+
+ae_usize_t
+ae_str_splitter_next_batch(ae_str_splitter_t *self, ae_memory_range_t *tokens, ae_usize_t capacity)
+{
+    ae_runtime_assert(self && tokens, AE_RUNTIME_ERROR_NULL_POINTER, 0);
+
+    ae_usize_t count = 0;
+
+    while (count < capacity && ae_str_splitter_take(self, tokens + count))
+    {
+        ++count;
+    }
+    return count;
+}
+
+bool
+ae_str_splitter_is_done(const ae_str_splitter_t *self)
+{
+    ae_runtime_assert(self, AE_RUNTIME_ERROR_NULL_POINTER, true);
+    return self->done;
+}
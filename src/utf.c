@@ -0,0 +1,1468 @@
+#include <ae/utf.h>
+/* Дополнительные модули */
+#include <ae/runtime_error_code.h>
+#include <ae/runtime_return_if.h>
+#include <ae/runtime_assert.h>
+#include <ae/runtime_throw.h>
+#include <ae/runtime_try.h>
+#include <ae/compiler_constructor.h>
+#include <ae/memory_block.h>
+#include <ae/cpu_feature.h>
+#include <ae/bit_scan.h>
+#include <ae/ptr_traits.h>
+#include <ae/nullptr.h>
+
+#if AE_COMPILER_ARCH_X86
+#    include <immintrin.h> // Для SSE2, SSSE3, AVX2 и AVX-512
+#endif                     // AE_COMPILER_ARCH_X86
+
+/**
+ * @brief Ядро поиска первой недопустимой последовательности UTF-8.
+ */
+typedef const ae_u8_t *(ae_utf8_find_invalid_kernel)(const ae_u8_t *data, ae_usize_t size);
+
+/**
+ * @brief Ядро расширения ASCII-символов в элементы UTF-16.
+ *
+ * Преобразует начальные ASCII-символы из @c size байт и возвращает их количество.
+ * Ядро может записать в @c dst до @c size элементов, в том числе после
+ * последнего преобразованного символа.
+ */
+typedef ae_usize_t(ae_utf8_to_utf16_ascii_kernel)(ae_u16_t      *dst,
+                                                   const ae_u8_t *src,
+                                                   ae_usize_t     size);
+
+/**
+ * @brief Ядро расширения ASCII-символов в элементы UTF-32
+ *        (см. `ae_utf8_to_utf16_ascii_kernel`).
+ */
+typedef ae_usize_t(ae_utf8_to_utf32_ascii_kernel)(ae_u32_t      *dst,
+                                                   const ae_u8_t *src,
+                                                   ae_usize_t     size);
+
+/**
+ * @brief Ядро сужения элементов UTF-16, не превышающих `0x7F`, в байты.
+ *
+ * Преобразует начальные ASCII-символы из @c size элементов
+ * и возвращает их количество.
+ */
+typedef ae_usize_t(ae_utf16_to_utf8_ascii_kernel)(ae_u8_t        *dst,
+                                                   const ae_u16_t *src,
+                                                   ae_usize_t      size);
+
+/**
+ * @brief Ядро сужения элементов UTF-32, не превышающих `0x7F`, в байты
+ *        (см. `ae_utf16_to_utf8_ascii_kernel`).
+ */
+typedef ae_usize_t(ae_utf32_to_utf8_ascii_kernel)(ae_u8_t        *dst,
+                                                   const ae_u32_t *src,
+                                                   ae_usize_t      size);
+
+/**
+ * @brief Функция преобразования из одной кодировки в другую.
+ *
+ * Записывает результат, начиная с `*dst`, и сохраняет в `*dst` указатель
+ * на конец записанных данных.
+ *
+ * @return `AE_RUNTIME_ERROR_OK`, `AE_RUNTIME_ERROR_INVALID_ENCODING`
+ *         или `AE_RUNTIME_ERROR_OUT_OF_RANGE`.
+ */
+typedef ae_runtime_error_code_t(ae_utf_convert_fn)(void       **dst,
+                                                   const void  *dst_end,
+                                                   const void  *src,
+                                                   const void  *src_end);
+
+#if AE_CPU_FEATURE_KERNEL_SSE42 || AE_CPU_FEATURE_KERNEL_AVX2 || AE_CPU_FEATURE_KERNEL_AVX512
+/**
+ * @brief Таблицы масок ошибок табличного алгоритма проверки UTF-8.
+ *
+ * Каждый бит маски соответствует классу ошибок в паре соседних байтов:
+ * - `0x01` - начальный байт не продолжен байтом продолжения;
+ * - `0x02` - байт продолжения после ASCII-символа;
+ * - `0x04` - избыточная трехбайтовая форма (`E0 80..9F`);
+ * - `0x08` - значение больше `U+10FFFF` (`F4 90..BF` и `F5..FF`);
+ * - `0x10` - суррогат (`ED A0..BF`);
+ * - `0x20` - избыточная двухбайтовая форма (`C0`, `C1`);
+ * - `0x40` - избыточная четырехбайтовая форма (`F0 80..8F`) и `F5..FF 80..8F`;
+ * - `0x80` - два байта продолжения подряд (допустимо только для третьего
+ *   и четвертого байтов последовательности, что проверяется отдельно).
+ *
+ * Строки таблицы индексируются старшим полубайтом предыдущего байта,
+ * младшим полубайтом предыдущего байта и старшим полубайтом текущего байта.
+ */
+static const ae_u8_t m_utf8_lookup[3][16] = {
+    {0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+     0x80, 0x80, 0x80, 0x80, 0x21, 0x01, 0x15, 0x49},
+    {0xE7, 0xA3, 0x83, 0x83, 0x8B, 0xCB, 0xCB, 0xCB,
+     0xCB, 0xCB, 0xCB, 0xCB, 0xCB, 0xDB, 0xCB, 0xCB},
+    {0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+     0xE6, 0xAE, 0xBA, 0xBA, 0x01, 0x01, 0x01, 0x01},
+};
+
+/**
+ * @brief Наибольшие значения байтов, при которых блок не заканчивается
+ *        незавершенной последовательностью.
+ *
+ * Блок размера @c n сравнивается с последними @c n байтами массива:
+ * последний байт блока не может быть начальным, предпоследний - начальным
+ * байтом трех- или четырехбайтовой последовательности, а третий с конца -
+ * начальным байтом четырехбайтовой последовательности.
+ */
+static const ae_u8_t m_utf8_incomplete_max[64] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xDF, 0xBF,
+};
+#endif // AE_CPU_FEATURE_KERNEL_SSE42 || AE_CPU_FEATURE_KERNEL_AVX2 || AE_CPU_FEATURE_KERNEL_AVX512
+
+/**
+ * @brief Возвращает количество элементов размера @c unit в диапазоне
+ *        или 0, если диапазон пуст.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_usize_t
+ae_utf_range_size(const void *begin, const void *end, ae_usize_t unit)
+{
+    return (end > begin) ? ae_ptr_to_addr_diff(end, begin) / unit : 0;
+}
+
+/**
+ * @brief Проверяет, является ли байт байтом продолжения (`10xxxxxx`).
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN bool
+ae_utf8_is_continuation(ae_u8_t value)
+{
+    return (value & 0xC0) == 0x80;
+}
+
+/**
+ * @brief Декодирует одну последовательность UTF-8.
+ *
+ * @return Длина последовательности или 0, если последовательность недопустима.
+ */
+static ae_usize_t
+ae_utf8_decode(const ae_u8_t *src, ae_usize_t size, ae_u32_t *code_point)
+{
+    const ae_u8_t lead  = src[0];
+    ae_u8_t       lower = 0x80;
+    ae_u8_t       upper = 0xBF;
+    ae_usize_t    length;
+    ae_u32_t      value;
+
+    if (lead < 0x80)
+    {
+        *code_point = lead;
+        return 1;
+    }
+
+    if (lead < 0xC2)
+    {
+        return 0;
+    }
+    else if (lead < 0xE0)
+    {
+        length = 2;
+        value  = lead & 0x1F;
+    }
+    else if (lead < 0xF0)
+    {
+        length = 3;
+        value  = lead & 0x0F;
+        lower  = (lead == 0xE0) ? 0xA0 : 0x80;
+        upper  = (lead == 0xED) ? 0x9F : 0xBF;
+    }
+    else if (lead < 0xF5)
+    {
+        length = 4;
+        value  = lead & 0x07;
+        lower  = (lead == 0xF0) ? 0x90 : 0x80;
+        upper  = (lead == 0xF4) ? 0x8F : 0xBF;
+    }
+    else
+    {
+        return 0;
+    }
+
+    ae_runtime_return_if(size < length, 0);
+    ae_runtime_return_if(src[1] < lower || src[1] > upper, 0);
+
+    value = (value << 6) | (src[1] & 0x3F);
+
+    for (ae_usize_t i = 2; i < length; ++i)
+    {
+        ae_runtime_return_if(!ae_utf8_is_continuation(src[i]), 0);
+        value = (value << 6) | (src[i] & 0x3F);
+    }
+
+    *code_point = value;
+    return length;
+}
+
+/**
+ * @brief Возвращает количество байт UTF-8, необходимое для записи символа.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN ae_usize_t
+ae_utf8_encoded_size(ae_u32_t code_point)
+{
+    return (code_point < 0x80) ? 1 : (code_point < 0x800) ? 2 : (code_point < 0x10000) ? 3 : 4;
+}
+
+/**
+ * @brief Записывает символ в UTF-8 и возвращает количество записанных байт.
+ */
+static ae_usize_t
+ae_utf8_encode(ae_u8_t *dst, ae_u32_t code_point)
+{
+    const ae_usize_t size = ae_utf8_encoded_size(code_point);
+
+    switch (size)
+    {
+        case 1:
+            dst[0] = (ae_u8_t)code_point;
+            break;
+        case 2:
+            dst[0] = (ae_u8_t)(0xC0 | (code_point >> 6));
+            dst[1] = (ae_u8_t)(0x80 | (code_point & 0x3F));
+            break;
+        case 3:
+            dst[0] = (ae_u8_t)(0xE0 | (code_point >> 12));
+            dst[1] = (ae_u8_t)(0x80 | ((code_point >> 6) & 0x3F));
+            dst[2] = (ae_u8_t)(0x80 | (code_point & 0x3F));
+            break;
+        default:
+            dst[0] = (ae_u8_t)(0xF0 | (code_point >> 18));
+            dst[1] = (ae_u8_t)(0x80 | ((code_point >> 12) & 0x3F));
+            dst[2] = (ae_u8_t)(0x80 | ((code_point >> 6) & 0x3F));
+            dst[3] = (ae_u8_t)(0x80 | (code_point & 0x3F));
+            break;
+    }
+    return size;
+}
+
+static const ae_u8_t *
+ae_utf8_find_invalid_generic(const ae_u8_t *data, ae_usize_t size)
+{
+    ae_u32_t code_point;
+
+    for (ae_usize_t pos = 0; pos < size;)
+    {
+        const ae_usize_t length = ae_utf8_decode(data + pos, size - pos, &code_point);
+        ae_runtime_return_if(length == 0, data + pos);
+        pos += length;
+    }
+    return nullptr;
+}
+
+#if AE_CPU_FEATURE_KERNEL_SSE42 || AE_CPU_FEATURE_KERNEL_AVX2 || AE_CPU_FEATURE_KERNEL_AVX512
+/**
+ * @brief Уточняет положение ошибки, обнаруженной векторным ядром в блоке,
+ *        начинающемся с позиции @c pos.
+ *
+ * Все данные до блока корректны, поэтому поиск продолжается универсальным
+ * ядром с начала последовательности, которой принадлежит первый байт блока
+ * (она начинается не более чем на 3 байта раньше).
+ */
+static const ae_u8_t *
+ae_utf8_find_invalid_from(const ae_u8_t *data, ae_usize_t size, ae_usize_t pos)
+{
+    for (ae_usize_t i = 1; i <= 3 && i <= pos; ++i)
+    {
+        if (!ae_utf8_is_continuation(data[pos - i]))
+        {
+            pos -= i;
+            break;
+        }
+    }
+    return ae_utf8_find_invalid_generic(data + pos, size - pos);
+}
+#endif // AE_CPU_FEATURE_KERNEL_SSE42 || AE_CPU_FEATURE_KERNEL_AVX2 || AE_CPU_FEATURE_KERNEL_AVX512
+
+static ae_usize_t
+ae_utf8_to_utf16_ascii_generic(ae_u16_t *dst, const ae_u8_t *src, ae_usize_t size)
+{
+    ae_usize_t pos = 0;
+
+    for (; pos < size && src[pos] < 0x80; ++pos)
+    {
+        dst[pos] = src[pos];
+    }
+    return pos;
+}
+
+static ae_usize_t
+ae_utf8_to_utf32_ascii_generic(ae_u32_t *dst, const ae_u8_t *src, ae_usize_t size)
+{
+    ae_usize_t pos = 0;
+
+    for (; pos < size && src[pos] < 0x80; ++pos)
+    {
+        dst[pos] = src[pos];
+    }
+    return pos;
+}
+
+static ae_usize_t
+ae_utf16_to_utf8_ascii_generic(ae_u8_t *dst, const ae_u16_t *src, ae_usize_t size)
+{
+    ae_usize_t pos = 0;
+
+    for (; pos < size && src[pos] < 0x80; ++pos)
+    {
+        dst[pos] = (ae_u8_t)src[pos];
+    }
+    return pos;
+}
+
+static ae_usize_t
+ae_utf32_to_utf8_ascii_generic(ae_u8_t *dst, const ae_u32_t *src, ae_usize_t size)
+{
+    ae_usize_t pos = 0;
+
+    for (; pos < size && src[pos] < 0x80; ++pos)
+    {
+        dst[pos] = (ae_u8_t)src[pos];
+    }
+    return pos;
+}
+
+/* -------------------------------------------------------------------------------------------- */
+/* Ядра SSE2                                                                                    */
+/* -------------------------------------------------------------------------------------------- */
+
+#if AE_CPU_FEATURE_KERNEL_SSE2
+/**
+ * @brief Расширяет ASCII-символы блоками по 16 байт.
+ *
+ * В блоке, содержащем не-ASCII байт, записываются все 16 элементов,
+ * а преобразованными считаются только символы до этого байта.
+ */
+AE_ATTRIBUTE(TARGET)("sse2")
+static ae_usize_t
+ae_utf8_to_utf16_ascii_sse2(ae_u16_t *dst, const ae_u8_t *src, ae_usize_t size)
+{
+    const __m128i zero = _mm_setzero_si128();
+    ae_usize_t    pos  = 0;
+
+    for (; pos + 16 <= size; pos += 16)
+    {
+        const __m128i  xmm0 = _mm_loadu_si128(ae_ptr_cast(const __m128i, (src + pos)));
+        const ae_u32_t mask = (ae_u32_t)_mm_movemask_epi8(xmm0);
+
+        _mm_storeu_si128(ae_ptr_cast(__m128i, (dst + pos)), _mm_unpacklo_epi8(xmm0, zero));
+        _mm_storeu_si128(ae_ptr_cast(__m128i, (dst + pos + 8)), _mm_unpackhi_epi8(xmm0, zero));
+
+        if (mask != 0)
+        {
+            return pos + ae_bit_scan_forward32(mask);
+        }
+    }
+    return pos + ae_utf8_to_utf16_ascii_generic(dst + pos, src + pos, size - pos);
+}
+
+/**
+ * @brief Расширяет ASCII-символы блоками по 16 байт
+ *        (см. `ae_utf8_to_utf16_ascii_sse2`).
+ */
+AE_ATTRIBUTE(TARGET)("sse2")
+static ae_usize_t
+ae_utf8_to_utf32_ascii_sse2(ae_u32_t *dst, const ae_u8_t *src, ae_usize_t size)
+{
+    const __m128i zero = _mm_setzero_si128();
+    ae_usize_t    pos  = 0;
+
+    for (; pos + 16 <= size; pos += 16)
+    {
+        const __m128i  xmm0 = _mm_loadu_si128(ae_ptr_cast(const __m128i, (src + pos)));
+        const __m128i  lo   = _mm_unpacklo_epi8(xmm0, zero);
+        const __m128i  hi   = _mm_unpackhi_epi8(xmm0, zero);
+        const ae_u32_t mask = (ae_u32_t)_mm_movemask_epi8(xmm0);
+
+        _mm_storeu_si128(ae_ptr_cast(__m128i, (dst + pos)), _mm_unpacklo_epi16(lo, zero));
+        _mm_storeu_si128(ae_ptr_cast(__m128i, (dst + pos + 4)), _mm_unpackhi_epi16(lo, zero));
+        _mm_storeu_si128(ae_ptr_cast(__m128i, (dst + pos + 8)), _mm_unpacklo_epi16(hi, zero));
+        _mm_storeu_si128(ae_ptr_cast(__m128i, (dst + pos + 12)), _mm_unpackhi_epi16(hi, zero));
+
+        if (mask != 0)
+        {
+            return pos + ae_bit_scan_forward32(mask);
+        }
+    }
+    return pos + ae_utf8_to_utf32_ascii_generic(dst + pos, src + pos, size - pos);
+}
+
+/**
+ * @brief Сужает элементы UTF-16 блоками по 16, пока все элементы блока
+ *        являются ASCII-символами.
+ */
+AE_ATTRIBUTE(TARGET)("sse2")
+static ae_usize_t
+ae_utf16_to_utf8_ascii_sse2(ae_u8_t *dst, const ae_u16_t *src, ae_usize_t size)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i high = _mm_set1_epi16((short)0xFF80);
+    ae_usize_t    pos  = 0;
+
+    for (; pos + 16 <= size; pos += 16)
+    {
+        const __m128i xmm0 = _mm_loadu_si128(ae_ptr_cast(const __m128i, (src + pos)));
+        const __m128i xmm1 = _mm_loadu_si128(ae_ptr_cast(const __m128i, (src + pos + 8)));
+        const __m128i bits = _mm_and_si128(_mm_or_si128(xmm0, xmm1), high);
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(bits, zero)) != 0xFFFF)
+        {
+            break;
+        }
+        _mm_storeu_si128(ae_ptr_cast(__m128i, (dst + pos)), _mm_packus_epi16(xmm0, xmm1));
+    }
+    return pos + ae_utf16_to_utf8_ascii_generic(dst + pos, src + pos, size - pos);
+}
+
+/**
+ * @brief Сужает элементы UTF-32 блоками по 16
+ *        (см. `ae_utf16_to_utf8_ascii_sse2`).
+ */
+AE_ATTRIBUTE(TARGET)("sse2")
+static ae_usize_t
+ae_utf32_to_utf8_ascii_sse2(ae_u8_t *dst, const ae_u32_t *src, ae_usize_t size)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i high = _mm_set1_epi32((int)0xFFFFFF80);
+    ae_usize_t    pos  = 0;
+
+    for (; pos + 16 <= size; pos += 16)
+    {
+        const __m128i xmm0 = _mm_loadu_si128(ae_ptr_cast(const __m128i, (src + pos)));
+        const __m128i xmm1 = _mm_loadu_si128(ae_ptr_cast(const __m128i, (src + pos + 4)));
+        const __m128i xmm2 = _mm_loadu_si128(ae_ptr_cast(const __m128i, (src + pos + 8)));
+        const __m128i xmm3 = _mm_loadu_si128(ae_ptr_cast(const __m128i, (src + pos + 12)));
+        const __m128i bits = _mm_and_si128(
+            _mm_or_si128(_mm_or_si128(xmm0, xmm1), _mm_or_si128(xmm2, xmm3)), high);
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(bits, zero)) != 0xFFFF)
+        {
+            break;
+        }
+        _mm_storeu_si128(ae_ptr_cast(__m128i, (dst + pos)),
+                         _mm_packus_epi16(_mm_packs_epi32(xmm0, xmm1),
+                                          _mm_packs_epi32(xmm2, xmm3)));
+    }
+    return pos + ae_utf32_to_utf8_ascii_generic(dst + pos, src + pos, size - pos);
+}
+#endif // AE_CPU_FEATURE_KERNEL_SSE2
+
+/* -------------------------------------------------------------------------------------------- */
+/* Ядра SSSE3                                                                                   */
+/* -------------------------------------------------------------------------------------------- */
+
+#if AE_CPU_FEATURE_KERNEL_SSE42
+/**
+ * @brief Вычисляет маску ошибок UTF-8 для 16 байт @c input,
+ *        которым предшествует блок @c prev.
+ *
+ * Ненулевые байты результата соответствуют недопустимым парам байтов,
+ * а также байтам продолжения, которые должны быть третьим или четвертым
+ * байтом последовательности, но не являются ими (и наоборот).
+ */
+AE_ATTRIBUTE(TARGET)("ssse3")
+static __m128i
+ae_utf8_check_ssse3(__m128i input, __m128i prev)
+{
+    const __m128i low   = _mm_set1_epi8(0x0F);
+    const __m128i prev1 = _mm_alignr_epi8(input, prev, 15);
+    const __m128i prev2 = _mm_alignr_epi8(input, prev, 14);
+    const __m128i prev3 = _mm_alignr_epi8(input, prev, 13);
+
+    const __m128i byte_1_high =
+        _mm_shuffle_epi8(_mm_loadu_si128(ae_ptr_cast(const __m128i, m_utf8_lookup[0])),
+                         _mm_and_si128(_mm_srli_epi16(prev1, 4), low));
+    const __m128i byte_1_low =
+        _mm_shuffle_epi8(_mm_loadu_si128(ae_ptr_cast(const __m128i, m_utf8_lookup[1])),
+                         _mm_and_si128(prev1, low));
+    const __m128i byte_2_high =
+        _mm_shuffle_epi8(_mm_loadu_si128(ae_ptr_cast(const __m128i, m_utf8_lookup[2])),
+                         _mm_and_si128(_mm_srli_epi16(input, 4), low));
+
+    const __m128i special = _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high);
+    const __m128i third   = _mm_subs_epu8(prev2, _mm_set1_epi8(0x60));
+    const __m128i fourth  = _mm_subs_epu8(prev3, _mm_set1_epi8(0x70));
+    const __m128i must23 =
+        _mm_and_si128(_mm_or_si128(third, fourth), _mm_set1_epi8((char)0x80));
+
+    return _mm_xor_si128(must23, special);
+}
+
+/**
+ * @brief Проверяет UTF-8 блоками по 16 байт.
+ *
+ * Остаток меньше 16 байт дополняется нулями (ASCII-символами), поэтому
+ * незавершенная последовательность в конце данных обнаруживается той же
+ * проверкой. Положение ошибки уточняет `ae_utf8_find_invalid_from`.
+ */
+AE_ATTRIBUTE(TARGET)("ssse3")
+static const ae_u8_t *
+ae_utf8_find_invalid_ssse3(const ae_u8_t *data, ae_usize_t size)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i max =
+        _mm_loadu_si128(ae_ptr_cast(const __m128i, (m_utf8_incomplete_max + 48)));
+
+    __m128i    prev       = zero;
+    __m128i    incomplete = zero;
+    ae_usize_t pos        = 0;
+
+    for (; pos < size; pos += 16)
+    {
+        __m128i input;
+
+        if (size - pos >= 16)
+        {
+            input = _mm_loadu_si128(ae_ptr_cast(const __m128i, (data + pos)));
+        }
+        else
+        {
+            ae_u8_t buffer[16] = {0};
+
+            for (ae_usize_t i = 0; i < size - pos; ++i)
+            {
+                buffer[i] = data[pos + i];
+            }
+            input = _mm_loadu_si128(ae_ptr_cast(const __m128i, buffer));
+        }
+
+        const __m128i error = (_mm_movemask_epi8(input) == 0)
+                                  ? incomplete
+                                  : ae_utf8_check_ssse3(input, prev);
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(error, zero)) != 0xFFFF)
+        {
+            return ae_utf8_find_invalid_from(data, size, pos);
+        }
+
+        incomplete = _mm_subs_epu8(input, max);
+        prev       = input;
+    }
+
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(incomplete, zero)) != 0xFFFF)
+    {
+        return ae_utf8_find_invalid_from(data, size, size);
+    }
+    return nullptr;
+}
+#endif // AE_CPU_FEATURE_KERNEL_SSE42
+
+/* -------------------------------------------------------------------------------------------- */
+/* Ядра AVX2                                                                                    */
+/* -------------------------------------------------------------------------------------------- */
+
+#if AE_CPU_FEATURE_KERNEL_AVX2
+/**
+ * @brief Вычисляет маску ошибок UTF-8 для 32 байт (см. `ae_utf8_check_ssse3`).
+ *
+ * Предыдущие байты для обеих 128-битных половин получаются инструкцией
+ * `vpalignr` из регистра, составленного из старшей половины @c prev
+ * и младшей половины @c input.
+ */
+AE_ATTRIBUTE(TARGET)("avx2")
+static __m256i
+ae_utf8_check_avx2(__m256i input, __m256i prev)
+{
+    const __m256i low     = _mm256_set1_epi8(0x0F);
+    const __m256i shifted = _mm256_permute2x128_si256(prev, input, 0x21);
+    const __m256i prev1   = _mm256_alignr_epi8(input, shifted, 15);
+    const __m256i prev2   = _mm256_alignr_epi8(input, shifted, 14);
+    const __m256i prev3   = _mm256_alignr_epi8(input, shifted, 13);
+
+    const __m256i byte_1_high = _mm256_shuffle_epi8(
+        _mm256_broadcastsi128_si256(_mm_loadu_si128(ae_ptr_cast(const __m128i, m_utf8_lookup[0]))),
+        _mm256_and_si256(_mm256_srli_epi16(prev1, 4), low));
+    const __m256i byte_1_low = _mm256_shuffle_epi8(
+        _mm256_broadcastsi128_si256(_mm_loadu_si128(ae_ptr_cast(const __m128i, m_utf8_lookup[1]))),
+        _mm256_and_si256(prev1, low));
+    const __m256i byte_2_high = _mm256_shuffle_epi8(
+        _mm256_broadcastsi128_si256(_mm_loadu_si128(ae_ptr_cast(const __m128i, m_utf8_lookup[2]))),
+        _mm256_and_si256(_mm256_srli_epi16(input, 4), low));
+
+    const __m256i special =
+        _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
+    const __m256i third  = _mm256_subs_epu8(prev2, _mm256_set1_epi8(0x60));
+    const __m256i fourth = _mm256_subs_epu8(prev3, _mm256_set1_epi8(0x70));
+    const __m256i must23 =
+        _mm256_and_si256(_mm256_or_si256(third, fourth), _mm256_set1_epi8((char)0x80));
+
+    return _mm256_xor_si256(must23, special);
+}
+
+/**
+ * @brief Проверяет UTF-8 блоками по 32 байта (см. `ae_utf8_find_invalid_ssse3`).
+ */
+AE_ATTRIBUTE(TARGET)("avx2")
+static const ae_u8_t *
+ae_utf8_find_invalid_avx2(const ae_u8_t *data, ae_usize_t size)
+{
+    const __m256i max =
+        _mm256_loadu_si256(ae_ptr_cast(const __m256i, (m_utf8_incomplete_max + 32)));
+
+    __m256i    prev       = _mm256_setzero_si256();
+    __m256i    incomplete = _mm256_setzero_si256();
+    ae_usize_t pos        = 0;
+
+    for (; pos < size; pos += 32)
+    {
+        __m256i input;
+
+        if (size - pos >= 32)
+        {
+            input = _mm256_loadu_si256(ae_ptr_cast(const __m256i, (data + pos)));
+        }
+        else
+        {
+            ae_u8_t buffer[32] = {0};
+
+            for (ae_usize_t i = 0; i < size - pos; ++i)
+            {
+                buffer[i] = data[pos + i];
+            }
+            input = _mm256_loadu_si256(ae_ptr_cast(const __m256i, buffer));
+        }
+
+        const __m256i error = (_mm256_movemask_epi8(input) == 0)
+                                  ? incomplete
+                                  : ae_utf8_check_avx2(input, prev);
+
+        if (!_mm256_testz_si256(error, error))
+        {
+            return ae_utf8_find_invalid_from(data, size, pos);
+        }
+
+        incomplete = _mm256_subs_epu8(input, max);
+        prev       = input;
+    }
+
+    if (!_mm256_testz_si256(incomplete, incomplete))
+    {
+        return ae_utf8_find_invalid_from(data, size, size);
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Расширяет ASCII-символы блоками по 32 байта
+ *        (см. `ae_utf8_to_utf16_ascii_sse2`).
+ */
+AE_ATTRIBUTE(TARGET)("avx2")
+static ae_usize_t
+ae_utf8_to_utf16_ascii_avx2(ae_u16_t *dst, const ae_u8_t *src, ae_usize_t size)
+{
+    ae_usize_t pos = 0;
+
+    for (; pos + 32 <= size; pos += 32)
+    {
+        const __m256i  ymm0 = _mm256_loadu_si256(ae_ptr_cast(const __m256i, (src + pos)));
+        const ae_u32_t mask = (ae_u32_t)_mm256_movemask_epi8(ymm0);
+
+        _mm256_storeu_si256(ae_ptr_cast(__m256i, (dst + pos)),
+                            _mm256_cvtepu8_epi16(_mm256_castsi256_si128(ymm0)));
+        _mm256_storeu_si256(ae_ptr_cast(__m256i, (dst + pos + 16)),
+                            _mm256_cvtepu8_epi16(_mm256_extracti128_si256(ymm0, 1)));
+
+        if (mask != 0)
+        {
+            return pos + ae_bit_scan_forward32(mask);
+        }
+    }
+    return pos + ae_utf8_to_utf16_ascii_sse2(dst + pos, src + pos, size - pos);
+}
+
+/**
+ * @brief Расширяет ASCII-символы блоками по 32 байта
+ *        (см. `ae_utf8_to_utf16_ascii_sse2`).
+ */
+AE_ATTRIBUTE(TARGET)("avx2")
+static ae_usize_t
+ae_utf8_to_utf32_ascii_avx2(ae_u32_t *dst, const ae_u8_t *src, ae_usize_t size)
+{
+    ae_usize_t pos = 0;
+
+    for (; pos + 32 <= size; pos += 32)
+    {
+        const __m256i  ymm0 = _mm256_loadu_si256(ae_ptr_cast(const __m256i, (src + pos)));
+        const __m128i  lo   = _mm256_castsi256_si128(ymm0);
+        const __m128i  hi   = _mm256_extracti128_si256(ymm0, 1);
+        const ae_u32_t mask = (ae_u32_t)_mm256_movemask_epi8(ymm0);
+
+        _mm256_storeu_si256(ae_ptr_cast(__m256i, (dst + pos)), _mm256_cvtepu8_epi32(lo));
+        _mm256_storeu_si256(ae_ptr_cast(__m256i, (dst + pos + 8)),
+                            _mm256_cvtepu8_epi32(_mm_srli_si128(lo, 8)));
+        _mm256_storeu_si256(ae_ptr_cast(__m256i, (dst + pos + 16)), _mm256_cvtepu8_epi32(hi));
+        _mm256_storeu_si256(ae_ptr_cast(__m256i, (dst + pos + 24)),
+                            _mm256_cvtepu8_epi32(_mm_srli_si128(hi, 8)));
+
+        if (mask != 0)
+        {
+            return pos + ae_bit_scan_forward32(mask);
+        }
+    }
+    return pos + ae_utf8_to_utf32_ascii_sse2(dst + pos, src + pos, size - pos);
+}
+
+/**
+ * @brief Сужает элементы UTF-16 блоками по 32 (см. `ae_utf16_to_utf8_ascii_sse2`).
+ *
+ * Инструкция `vpackuswb` упаковывает 128-битные половины независимо,
+ * поэтому 64-битные части результата переставляются на свои места.
+ */
+AE_ATTRIBUTE(TARGET)("avx2")
+static ae_usize_t
+ae_utf16_to_utf8_ascii_avx2(ae_u8_t *dst, const ae_u16_t *src, ae_usize_t size)
+{
+    const __m256i high = _mm256_set1_epi16((short)0xFF80);
+    ae_usize_t    pos  = 0;
+
+    for (; pos + 32 <= size; pos += 32)
+    {
+        const __m256i ymm0 = _mm256_loadu_si256(ae_ptr_cast(const __m256i, (src + pos)));
+        const __m256i ymm1 = _mm256_loadu_si256(ae_ptr_cast(const __m256i, (src + pos + 16)));
+
+        if (!_mm256_testz_si256(_mm256_or_si256(ymm0, ymm1), high))
+        {
+            break;
+        }
+        _mm256_storeu_si256(ae_ptr_cast(__m256i, (dst + pos)),
+                            _mm256_permute4x64_epi64(_mm256_packus_epi16(ymm0, ymm1), 0xD8));
+    }
+    return pos + ae_utf16_to_utf8_ascii_sse2(dst + pos, src + pos, size - pos);
+}
+
+/**
+ * @brief Сужает элементы UTF-32 блоками по 32 (см. `ae_utf16_to_utf8_ascii_avx2`).
+ */
+AE_ATTRIBUTE(TARGET)("avx2")
+static ae_usize_t
+ae_utf32_to_utf8_ascii_avx2(ae_u8_t *dst, const ae_u32_t *src, ae_usize_t size)
+{
+    const __m256i high  = _mm256_set1_epi32((int)0xFFFFFF80);
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    ae_usize_t    pos   = 0;
+
+    for (; pos + 32 <= size; pos += 32)
+    {
+        const __m256i ymm0 = _mm256_loadu_si256(ae_ptr_cast(const __m256i, (src + pos)));
+        const __m256i ymm1 = _mm256_loadu_si256(ae_ptr_cast(const __m256i, (src + pos + 8)));
+        const __m256i ymm2 = _mm256_loadu_si256(ae_ptr_cast(const __m256i, (src + pos + 16)));
+        const __m256i ymm3 = _mm256_loadu_si256(ae_ptr_cast(const __m256i, (src + pos + 24)));
+        const __m256i bits =
+            _mm256_or_si256(_mm256_or_si256(ymm0, ymm1), _mm256_or_si256(ymm2, ymm3));
+
+        if (!_mm256_testz_si256(bits, high))
+        {
+            break;
+        }
+
+        const __m256i packed = _mm256_packus_epi16(_mm256_packs_epi32(ymm0, ymm1),
+                                                   _mm256_packs_epi32(ymm2, ymm3));
+        _mm256_storeu_si256(ae_ptr_cast(__m256i, (dst + pos)),
+                            _mm256_permutevar8x32_epi32(packed, order));
+    }
+    return pos + ae_utf32_to_utf8_ascii_sse2(dst + pos, src + pos, size - pos);
+}
+#endif // AE_CPU_FEATURE_KERNEL_AVX2
+
+/* -------------------------------------------------------------------------------------------- */
+/* Ядра AVX-512                                                                                 */
+/* -------------------------------------------------------------------------------------------- */
+
+#if AE_CPU_FEATURE_KERNEL_AVX512
+/**
+ * @brief Вычисляет маску ошибок UTF-8 для 64 байт (см. `ae_utf8_check_avx2`).
+ */
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static __m512i
+ae_utf8_check_avx512(__m512i input, __m512i prev)
+{
+    const __m512i low     = _mm512_set1_epi8(0x0F);
+    const __m512i index   = _mm512_setr_epi64(6, 7, 8, 9, 10, 11, 12, 13);
+    const __m512i shifted = _mm512_permutex2var_epi64(prev, index, input);
+    const __m512i prev1   = _mm512_alignr_epi8(input, shifted, 15);
+    const __m512i prev2   = _mm512_alignr_epi8(input, shifted, 14);
+    const __m512i prev3   = _mm512_alignr_epi8(input, shifted, 13);
+
+    const __m512i byte_1_high = _mm512_shuffle_epi8(
+        _mm512_broadcast_i32x4(_mm_loadu_si128(ae_ptr_cast(const __m128i, m_utf8_lookup[0]))),
+        _mm512_and_si512(_mm512_srli_epi16(prev1, 4), low));
+    const __m512i byte_1_low = _mm512_shuffle_epi8(
+        _mm512_broadcast_i32x4(_mm_loadu_si128(ae_ptr_cast(const __m128i, m_utf8_lookup[1]))),
+        _mm512_and_si512(prev1, low));
+    const __m512i byte_2_high = _mm512_shuffle_epi8(
+        _mm512_broadcast_i32x4(_mm_loadu_si128(ae_ptr_cast(const __m128i, m_utf8_lookup[2]))),
+        _mm512_and_si512(_mm512_srli_epi16(input, 4), low));
+
+    const __m512i special =
+        _mm512_and_si512(_mm512_and_si512(byte_1_high, byte_1_low), byte_2_high);
+    const __m512i third  = _mm512_subs_epu8(prev2, _mm512_set1_epi8(0x60));
+    const __m512i fourth = _mm512_subs_epu8(prev3, _mm512_set1_epi8(0x70));
+    const __m512i must23 =
+        _mm512_and_si512(_mm512_or_si512(third, fourth), _mm512_set1_epi8((char)0x80));
+
+    return _mm512_xor_si512(must23, special);
+}
+
+/**
+ * @brief Проверяет UTF-8 блоками по 64 байта (см. `ae_utf8_find_invalid_ssse3`).
+ *
+ * Остаток меньше 64 байт загружается под маской с заполнением нулями.
+ */
+AE_ATTRIBUTE(TARGET)("avx512f,avx512bw")
+static const ae_u8_t *
+ae_utf8_find_invalid_avx512(const ae_u8_t *data, ae_usize_t size)
+{
+    const __m512i max = _mm512_loadu_si512(ae_ptr_cast(const void, m_utf8_incomplete_max));
+
+    __m512i    prev       = _mm512_setzero_si512();
+    __m512i    incomplete = _mm512_setzero_si512();
+    ae_usize_t pos        = 0;
+
+    for (; pos < size; pos += 64)
+    {
+        const ae_usize_t left  = size - pos;
+        const __mmask64  mask  = (~(ae_u64_t)0) >> ((left < 64) ? 64 - left : 0);
+        const __m512i    input = _mm512_maskz_loadu_epi8(mask, data + pos);
+
+        const __m512i error = (_mm512_movepi8_mask(input) == 0)
+                                  ? incomplete
+                                  : ae_utf8_check_avx512(input, prev);
+
+        if (_mm512_test_epi8_mask(error, error) != 0)
+        {
+            return ae_utf8_find_invalid_from(data, size, pos);
+        }
+
+        incomplete = _mm512_subs_epu8(input, max);
+        prev       = input;
+    }
+
+    if (_mm512_test_epi8_mask(incomplete, incomplete) != 0)
+    {
+        return ae_utf8_find_invalid_from(data, size, size);
+    }
+    return nullptr;
+}
+#endif // AE_CPU_FEATURE_KERNEL_AVX512
+
+/**
+ * @brief Ядро проверки UTF-8, выбранное для текущего процессора.
+ */
+ae_utf8_find_invalid_kernel *m_utf8_find_invalid_kernel = ae_utf8_find_invalid_generic;
+
+/**
+ * @brief Ядро расширения ASCII-символов в UTF-16, выбранное для текущего процессора.
+ */
+ae_utf8_to_utf16_ascii_kernel *m_utf8_to_utf16_ascii_kernel = ae_utf8_to_utf16_ascii_generic;
+
+/**
+ * @brief Ядро расширения ASCII-символов в UTF-32, выбранное для текущего процессора.
+ */
+ae_utf8_to_utf32_ascii_kernel *m_utf8_to_utf32_ascii_kernel = ae_utf8_to_utf32_ascii_generic;
+
+/**
+ * @brief Ядро сужения ASCII-символов UTF-16, выбранное для текущего процессора.
+ */
+ae_utf16_to_utf8_ascii_kernel *m_utf16_to_utf8_ascii_kernel = ae_utf16_to_utf8_ascii_generic;
+
+/**
+ * @brief Ядро сужения ASCII-символов UTF-32, выбранное для текущего процессора.
+ */
+ae_utf32_to_utf8_ascii_kernel *m_utf32_to_utf8_ascii_kernel = ae_utf32_to_utf8_ascii_generic;
+
+void
+ae_utf_dispatch(ae_u32_t features)
+{
+    ae_utf8_find_invalid_kernel   *find_invalid  = ae_utf8_find_invalid_generic;
+    ae_utf8_to_utf16_ascii_kernel *utf8_to_utf16 = ae_utf8_to_utf16_ascii_generic;
+    ae_utf8_to_utf32_ascii_kernel *utf8_to_utf32 = ae_utf8_to_utf32_ascii_generic;
+    ae_utf16_to_utf8_ascii_kernel *utf16_to_utf8 = ae_utf16_to_utf8_ascii_generic;
+    ae_utf32_to_utf8_ascii_kernel *utf32_to_utf8 = ae_utf32_to_utf8_ascii_generic;
+
+    features &= ae_cpu_feature_get();
+
+#if AE_CPU_FEATURE_KERNEL_SSE2
+    if (features & AE_CPU_FEATURE_SSE2)
+    {
+        utf8_to_utf16 = ae_utf8_to_utf16_ascii_sse2;
+        utf8_to_utf32 = ae_utf8_to_utf32_ascii_sse2;
+        utf16_to_utf8 = ae_utf16_to_utf8_ascii_sse2;
+        utf32_to_utf8 = ae_utf32_to_utf8_ascii_sse2;
+    }
+#endif
+
+#if AE_CPU_FEATURE_KERNEL_SSE42
+    if (features & AE_CPU_FEATURE_SSSE3)
+    {
+        find_invalid = ae_utf8_find_invalid_ssse3;
+    }
+#endif
+
+#if AE_CPU_FEATURE_KERNEL_AVX2
+    if ((features & AE_CPU_FEATURE_AVX2) && (features & AE_CPU_FEATURE_SSE2))
+    {
+        find_invalid  = ae_utf8_find_invalid_avx2;
+        utf8_to_utf16 = ae_utf8_to_utf16_ascii_avx2;
+        utf8_to_utf32 = ae_utf8_to_utf32_ascii_avx2;
+        utf16_to_utf8 = ae_utf16_to_utf8_ascii_avx2;
+        utf32_to_utf8 = ae_utf32_to_utf8_ascii_avx2;
+    }
+#endif
+
+#if AE_CPU_FEATURE_KERNEL_AVX512
+    if ((features & AE_CPU_FEATURE_AVX512F) && (features & AE_CPU_FEATURE_AVX512BW))
+    {
+        find_invalid = ae_utf8_find_invalid_avx512;
+    }
+#endif
+
+    m_utf8_find_invalid_kernel   = find_invalid;
+    m_utf8_to_utf16_ascii_kernel = utf8_to_utf16;
+    m_utf8_to_utf32_ascii_kernel = utf8_to_utf32;
+    m_utf16_to_utf8_ascii_kernel = utf16_to_utf8;
+    m_utf32_to_utf8_ascii_kernel = utf32_to_utf8;
+}
+
+/**
+ * @brief Конструктор, выбирающий ядра модуля при загрузке библиотеки.
+ */
+ae_compiler_constructor(ae_utf_dispatch_init)
+{
+    ae_utf_dispatch(AE_CPU_FEATURE_ALL);
+}
+
+/**
+ * @brief Преобразует UTF-8 в UTF-16 (см. `ae_utf_convert_fn`).
+ */
+static ae_runtime_error_code_t
+ae_utf8_to_utf16_convert(void **dst, const void *dst_end, const void *src, const void *src_end)
+{
+    ae_u16_t        *out      = ae_ptr_cast(ae_u16_t, *dst);
+    const ae_u8_t   *in       = ae_ptr_cast(const ae_u8_t, src);
+    const ae_usize_t out_size = ae_utf_range_size(out, dst_end, sizeof(ae_u16_t));
+    const ae_usize_t in_size  = ae_utf_range_size(in, src_end, sizeof(ae_u8_t));
+
+    ae_runtime_error_code_t code      = AE_RUNTIME_ERROR_OK;
+    ae_usize_t              out_pos   = 0;
+    ae_usize_t              in_pos    = 0;
+    ae_usize_t              ascii_pos = 0;
+
+    while (in_pos < in_size)
+    {
+        const ae_usize_t out_left = out_size - out_pos;
+        const ae_usize_t in_left  = in_size - in_pos;
+
+        if (in[in_pos] < 0x80 && out_left != 0 && in_pos >= ascii_pos)
+        {
+            const ae_usize_t size = (in_left < out_left) ? in_left : out_left;
+            const ae_usize_t done = m_utf8_to_utf16_ascii_kernel(out + out_pos, in + in_pos, size);
+
+            out_pos += done;
+            in_pos += done;
+
+            if (done < 16)
+            {
+                ascii_pos = in_pos + 16;
+            }
+            continue;
+        }
+
+        ae_u32_t         code_point;
+        const ae_usize_t length = ae_utf8_decode(in + in_pos, in_left, &code_point);
+
+        if (length == 0)
+        {
+            code = AE_RUNTIME_ERROR_INVALID_ENCODING;
+            break;
+        }
+
+        if (out_left < ((code_point < 0x10000) ? 1 : 2))
+        {
+            code = AE_RUNTIME_ERROR_OUT_OF_RANGE;
+            break;
+        }
+
+        if (code_point < 0x10000)
+        {
+            out[out_pos++] = (ae_u16_t)code_point;
+        }
+        else
+        {
+            code_point -= 0x10000;
+            out[out_pos++] = (ae_u16_t)(0xD800 | (code_point >> 10));
+            out[out_pos++] = (ae_u16_t)(0xDC00 | (code_point & 0x3FF));
+        }
+        in_pos += length;
+    }
+
+    *dst = out + out_pos;
+    return code;
+}
+
+/**
+ * @brief Преобразует UTF-8 в UTF-32 (см. `ae_utf_convert_fn`).
+ */
+static ae_runtime_error_code_t
+ae_utf8_to_utf32_convert(void **dst, const void *dst_end, const void *src, const void *src_end)
+{
+    ae_u32_t        *out      = ae_ptr_cast(ae_u32_t, *dst);
+    const ae_u8_t   *in       = ae_ptr_cast(const ae_u8_t, src);
+    const ae_usize_t out_size = ae_utf_range_size(out, dst_end, sizeof(ae_u32_t));
+    const ae_usize_t in_size  = ae_utf_range_size(in, src_end, sizeof(ae_u8_t));
+
+    ae_runtime_error_code_t code      = AE_RUNTIME_ERROR_OK;
+    ae_usize_t              out_pos   = 0;
+    ae_usize_t              in_pos    = 0;
+    ae_usize_t              ascii_pos = 0;
+
+    while (in_pos < in_size)
+    {
+        const ae_usize_t out_left = out_size - out_pos;
+        const ae_usize_t in_left  = in_size - in_pos;
+
+        if (in[in_pos] < 0x80 && out_left != 0 && in_pos >= ascii_pos)
+        {
+            const ae_usize_t size = (in_left < out_left) ? in_left : out_left;
+            const ae_usize_t done = m_utf8_to_utf32_ascii_kernel(out + out_pos, in + in_pos, size);
+
+            out_pos += done;
+            in_pos += done;
+
+            if (done < 16)
+            {
+                ascii_pos = in_pos + 16;
+            }
+            continue;
+        }
+
+        ae_u32_t         code_point;
+        const ae_usize_t length = ae_utf8_decode(in + in_pos, in_left, &code_point);
+
+        if (length == 0)
+        {
+            code = AE_RUNTIME_ERROR_INVALID_ENCODING;
+            break;
+        }
+
+        if (out_left == 0)
+        {
+            code = AE_RUNTIME_ERROR_OUT_OF_RANGE;
+            break;
+        }
+
+        out[out_pos++] = code_point;
+        in_pos += length;
+    }
+
+    *dst = out + out_pos;
+    return code;
+}
+
+/**
+ * @brief Преобразует UTF-16 в UTF-8 (см. `ae_utf_convert_fn`).
+ */
+static ae_runtime_error_code_t
+ae_utf16_to_utf8_convert(void **dst, const void *dst_end, const void *src, const void *src_end)
+{
+    ae_u8_t         *out      = ae_ptr_cast(ae_u8_t, *dst);
+    const ae_u16_t  *in       = ae_ptr_cast(const ae_u16_t, src);
+    const ae_usize_t out_size = ae_utf_range_size(out, dst_end, sizeof(ae_u8_t));
+    const ae_usize_t in_size  = ae_utf_range_size(in, src_end, sizeof(ae_u16_t));
+
+    ae_runtime_error_code_t code      = AE_RUNTIME_ERROR_OK;
+    ae_usize_t              out_pos   = 0;
+    ae_usize_t              in_pos    = 0;
+    ae_usize_t              ascii_pos = 0;
+
+    while (in_pos < in_size)
+    {
+        const ae_usize_t out_left   = out_size - out_pos;
+        const ae_usize_t in_left    = in_size - in_pos;
+        ae_u32_t         code_point = in[in_pos];
+        ae_usize_t       length     = 1;
+
+        if (code_point < 0x80 && out_left != 0 && in_pos >= ascii_pos)
+        {
+            const ae_usize_t size = (in_left < out_left) ? in_left : out_left;
+            const ae_usize_t done = m_utf16_to_utf8_ascii_kernel(out + out_pos, in + in_pos, size);
+
+            out_pos += done;
+            in_pos += done;
+
+            if (done < 16)
+            {
+                ascii_pos = in_pos + 16;
+            }
+            continue;
+        }
+
+        if ((code_point & 0xF800) == 0xD800)
+        {
+            const bool is_pair = code_point < 0xDC00 && in_left >= 2 &&
+                                 (in[in_pos + 1] & 0xFC00) == 0xDC00;
+            if (!is_pair)
+            {
+                code = AE_RUNTIME_ERROR_INVALID_ENCODING;
+                break;
+            }
+
+            code_point = 0x10000 + (((code_point & 0x3FF) << 10) | (in[in_pos + 1] & 0x3FF));
+            length     = 2;
+        }
+
+        if (out_left < ae_utf8_encoded_size(code_point))
+        {
+            code = AE_RUNTIME_ERROR_OUT_OF_RANGE;
+            break;
+        }
+
+        out_pos += ae_utf8_encode(out + out_pos, code_point);
+        in_pos += length;
+    }
+
+    *dst = out + out_pos;
+    return code;
+}
+
+/**
+ * @brief Преобразует UTF-32 в UTF-8 (см. `ae_utf_convert_fn`).
+ */
+static ae_runtime_error_code_t
+ae_utf32_to_utf8_convert(void **dst, const void *dst_end, const void *src, const void *src_end)
+{
+    ae_u8_t         *out      = ae_ptr_cast(ae_u8_t, *dst);
+    const ae_u32_t  *in       = ae_ptr_cast(const ae_u32_t, src);
+    const ae_usize_t out_size = ae_utf_range_size(out, dst_end, sizeof(ae_u8_t));
+    const ae_usize_t in_size  = ae_utf_range_size(in, src_end, sizeof(ae_u32_t));
+
+    ae_runtime_error_code_t code      = AE_RUNTIME_ERROR_OK;
+    ae_usize_t              out_pos   = 0;
+    ae_usize_t              in_pos    = 0;
+    ae_usize_t              ascii_pos = 0;
+
+    while (in_pos < in_size)
+    {
+        const ae_usize_t out_left   = out_size - out_pos;
+        const ae_u32_t   code_point = in[in_pos];
+
+        if (code_point < 0x80 && out_left != 0 && in_pos >= ascii_pos)
+        {
+            const ae_usize_t in_left = in_size - in_pos;
+            const ae_usize_t size    = (in_left < out_left) ? in_left : out_left;
+            const ae_usize_t done = m_utf32_to_utf8_ascii_kernel(out + out_pos, in + in_pos, size);
+
+            out_pos += done;
+            in_pos += done;
+
+            if (done < 16)
+            {
+                ascii_pos = in_pos + 16;
+            }
+            continue;
+        }
+
+        if (code_point > 0x10FFFF || (code_point & 0xFFFFF800) == 0xD800)
+        {
+            code = AE_RUNTIME_ERROR_INVALID_ENCODING;
+            break;
+        }
+
+        if (out_left < ae_utf8_encoded_size(code_point))
+        {
+            code = AE_RUNTIME_ERROR_OUT_OF_RANGE;
+            break;
+        }
+
+        out_pos += ae_utf8_encode(out + out_pos, code_point);
+        in_pos += 1;
+    }
+
+    *dst = out + out_pos;
+    return code;
+}
+
+/**
+ * @brief Преобразует данные в буфер вызывающей стороны.
+ *
+ * @return Указатель на конец записанных данных или NULL при ошибке.
+ */
+static void *
+ae_utf_convert(ae_utf_convert_fn *convert,
+               void              *dst,
+               const void        *dst_end,
+               const void        *src,
+               const void        *src_end)
+{
+    ae_runtime_assert(dst && src, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+
+    const ae_runtime_error_code_t code = convert(&dst, dst_end, src, src_end);
+    ae_runtime_assert(code == AE_RUNTIME_ERROR_OK, code, nullptr);
+
+    return dst;
+}
+
+/**
+ * @brief Преобразует данные и дописывает их в динамический блок.
+ *
+ * @param count Наибольшее количество элементов результата,
+ *              под которое резервируется место в блоке.
+ */
+static bool
+ae_utf_convert_dynamic_block(ae_utf_convert_fn  *convert,
+                             ae_dynamic_block_t *self,
+                             ae_usize_t          element_size,
+                             ae_usize_t          count,
+                             const void         *src,
+                             const void         *src_end)
+{
+    ae_runtime_assert(src, AE_RUNTIME_ERROR_NULL_POINTER, false);
+    ae_runtime_assert(ae_memory_block_get_element_size(self) == element_size,
+                      AE_RUNTIME_ERROR_DIFFERENT_ELEMENT_SIZE,
+                      false);
+    ae_runtime_return_if(src == src_end, true);
+
+    ae_runtime_try
+    {
+        ae_dynamic_block_reserve(self, count);
+
+        void       *begin   = ae_dynamic_block_get_end(self);
+        void       *dst     = begin;
+        const void *dst_end = ae_ptr_add_offset_unsafe(void, begin, count * element_size);
+
+        const ae_runtime_error_code_t code = convert(&dst, dst_end, src, src_end);
+        ae_runtime_assert(code == AE_RUNTIME_ERROR_OK, code, false);
+
+        self->number_of_elements += ae_ptr_to_addr_diff(dst, begin) / element_size;
+        ae_runtime_try_return(true);
+    }
+    ae_runtime_raise(false);
+}
+
+const ae_char_t *
+ae_utf8_find_invalid(const ae_char_t *begin, const ae_char_t *end)
+{
+    ae_runtime_assert(begin, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+
+    const ae_u8_t *data = ae_ptr_cast(const ae_u8_t, begin);
+    const ae_u8_t *found =
+        m_utf8_find_invalid_kernel(data, ae_utf_range_size(begin, end, sizeof(ae_char_t)));
+
+    return ae_ptr_cast(const ae_char_t, found);
+}
+
+bool
+ae_utf8_is_valid(const ae_char_t *begin, const ae_char_t *end)
+{
+    ae_runtime_assert(begin, AE_RUNTIME_ERROR_NULL_POINTER, false);
+
+    return ae_utf8_find_invalid(begin, end) == nullptr;
+}
+
+ae_usize_t
+ae_utf8_to_utf16_length(const ae_char_t *begin, const ae_char_t *end)
+{
+    ae_runtime_assert(begin, AE_RUNTIME_ERROR_NULL_POINTER, 0);
+
+    const ae_u8_t   *data   = ae_ptr_cast(const ae_u8_t, begin);
+    const ae_usize_t size   = ae_utf_range_size(begin, end, sizeof(ae_char_t));
+    ae_usize_t       length = 0;
+
+    for (ae_usize_t i = 0; i < size; ++i)
+    {
+        length += !ae_utf8_is_continuation(data[i]) + (data[i] >= 0xF0);
+    }
+    return length;
+}
+
+ae_usize_t
+ae_utf8_to_utf32_length(const ae_char_t *begin, const ae_char_t *end)
+{
+    ae_runtime_assert(begin, AE_RUNTIME_ERROR_NULL_POINTER, 0);
+
+    const ae_u8_t   *data   = ae_ptr_cast(const ae_u8_t, begin);
+    const ae_usize_t size   = ae_utf_range_size(begin, end, sizeof(ae_char_t));
+    ae_usize_t       length = 0;
+
+    for (ae_usize_t i = 0; i < size; ++i)
+    {
+        length += !ae_utf8_is_continuation(data[i]);
+    }
+    return length;
+}
+
+ae_usize_t
+ae_utf16_to_utf8_length(const ae_u16_t *begin, const ae_u16_t *end)
+{
+    ae_runtime_assert(begin, AE_RUNTIME_ERROR_NULL_POINTER, 0);
+
+    const ae_usize_t size   = ae_utf_range_size(begin, end, sizeof(ae_u16_t));
+    ae_usize_t       length = 0;
+
+    for (ae_usize_t i = 0; i < size; ++i)
+    {
+        // Каждый элемент суррогатной пары дает 2 из 4 байт символа
+        const ae_u16_t value = begin[i];
+        length += (value < 0x80) ? 1 : (value < 0x800 || (value & 0xF800) == 0xD800) ? 2 : 3;
+    }
+    return length;
+}
+
+ae_usize_t
+ae_utf32_to_utf8_length(const ae_u32_t *begin, const ae_u32_t *end)
+{
+    ae_runtime_assert(begin, AE_RUNTIME_ERROR_NULL_POINTER, 0);
+
+    const ae_usize_t size   = ae_utf_range_size(begin, end, sizeof(ae_u32_t));
+    ae_usize_t       length = 0;
+
+    for (ae_usize_t i = 0; i < size; ++i)
+    {
+        length += ae_utf8_encoded_size(begin[i]);
+    }
+    return length;
+}
+
+ae_u16_t *
+ae_utf8_to_utf16(ae_u16_t        *dst,
+                 const ae_u16_t  *dst_end,
+                 const ae_char_t *src,
+                 const ae_char_t *src_end)
+{
+    return ae_utf_convert(ae_utf8_to_utf16_convert, dst, dst_end, src, src_end);
+}
+
+ae_u32_t *
+ae_utf8_to_utf32(ae_u32_t        *dst,
+                 const ae_u32_t  *dst_end,
+                 const ae_char_t *src,
+                 const ae_char_t *src_end)
+{
+    return ae_utf_convert(ae_utf8_to_utf32_convert, dst, dst_end, src, src_end);
+}
+
+ae_char_t *
+ae_utf16_to_utf8(ae_char_t       *dst,
+                 const ae_char_t *dst_end,
+                 const ae_u16_t  *src,
+                 const ae_u16_t  *src_end)
+{
+    return ae_utf_convert(ae_utf16_to_utf8_convert, dst, dst_end, src, src_end);
+}
+
+ae_char_t *
+ae_utf32_to_utf8(ae_char_t       *dst,
+                 const ae_char_t *dst_end,
+                 const ae_u32_t  *src,
+                 const ae_u32_t  *src_end)
+{
+    return ae_utf_convert(ae_utf32_to_utf8_convert, dst, dst_end, src, src_end);
+}
+
+bool
+ae_utf8_to_utf16_dynamic_block(ae_dynamic_block_t *self,
+                               const ae_char_t    *src,
+                               const ae_char_t    *src_end)
+{
+    // Количество элементов UTF-16 не превышает количества байт UTF-8
+    const ae_usize_t count = ae_utf_range_size(src, src_end, sizeof(ae_char_t));
+    return ae_utf_convert_dynamic_block(
+        ae_utf8_to_utf16_convert, self, sizeof(ae_u16_t), count, src, src_end);
+}
+
+bool
+ae_utf8_to_utf32_dynamic_block(ae_dynamic_block_t *self,
+                               const ae_char_t    *src,
+                               const ae_char_t    *src_end)
+{
+    const ae_usize_t count = ae_utf8_to_utf32_length(src, src_end);
+    return ae_utf_convert_dynamic_block(
+        ae_utf8_to_utf32_convert, self, sizeof(ae_u32_t), count, src, src_end);
+}
+
+bool
+ae_utf16_to_utf8_dynamic_block(ae_dynamic_block_t *self,
+                               const ae_u16_t     *src,
+                               const ae_u16_t     *src_end)
+{
+    const ae_usize_t count = ae_utf16_to_utf8_length(src, src_end);
+    return ae_utf_convert_dynamic_block(
+        ae_utf16_to_utf8_convert, self, sizeof(ae_char_t), count, src, src_end);
+}
+
+bool
+ae_utf32_to_utf8_dynamic_block(ae_dynamic_block_t *self,
+                               const ae_u32_t     *src,
+                               const ae_u32_t     *src_end)
+{
+    const ae_usize_t count = ae_utf32_to_utf8_length(src, src_end);
+    return ae_utf_convert_dynamic_block(
+        ae_utf32_to_utf8_convert, self, sizeof(ae_char_t), count, src, src_end);
+}
+
+ae_usize_t
+ae_utf8_to_wstr_length(const ae_char_t *begin, const ae_char_t *end)
+{
+    return (sizeof(ae_wchar_t) == sizeof(ae_u16_t)) ? ae_utf8_to_utf16_length(begin, end)
+                                                    : ae_utf8_to_utf32_length(begin, end);
+}
+
+ae_usize_t
+ae_wstr_to_utf8_length(const ae_wchar_t *begin, const ae_wchar_t *end)
+{
+    if (sizeof(ae_wchar_t) == sizeof(ae_u16_t))
+    {
+        return ae_utf16_to_utf8_length(ae_ptr_cast(const ae_u16_t, begin),
+                                       ae_ptr_cast(const ae_u16_t, end));
+    }
+    return ae_utf32_to_utf8_length(ae_ptr_cast(const ae_u32_t, begin),
+                                   ae_ptr_cast(const ae_u32_t, end));
+}
+
+ae_wchar_t *
+ae_utf8_to_wstr(ae_wchar_t       *dst,
+                const ae_wchar_t *dst_end,
+                const ae_char_t  *src,
+                const ae_char_t  *src_end)
+{
+    ae_utf_convert_fn *convert = (sizeof(ae_wchar_t) == sizeof(ae_u16_t))
+                                     ? ae_utf8_to_utf16_convert
+                                     : ae_utf8_to_utf32_convert;
+    return ae_utf_convert(convert, dst, dst_end, src, src_end);
+}
+
+ae_char_t *
+ae_wstr_to_utf8(ae_char_t        *dst,
+                const ae_char_t  *dst_end,
+                const ae_wchar_t *src,
+                const ae_wchar_t *src_end)
+{
+    ae_utf_convert_fn *convert = (sizeof(ae_wchar_t) == sizeof(ae_u16_t))
+                                     ? ae_utf16_to_utf8_convert
+                                     : ae_utf32_to_utf8_convert;
+    return ae_utf_convert(convert, dst, dst_end, src, src_end);
+}
+
+bool
+ae_utf8_to_wstr_dynamic_block(ae_dynamic_block_t *self,
+                              const ae_char_t    *src,
+                              const ae_char_t    *src_end)
+{
+    return (sizeof(ae_wchar_t) == sizeof(ae_u16_t))
+               ? ae_utf8_to_utf16_dynamic_block(self, src, src_end)
+               : ae_utf8_to_utf32_dynamic_block(self, src, src_end);
+}
+
+bool
+ae_wstr_to_utf8_dynamic_block(ae_dynamic_block_t *self,
+                              const ae_wchar_t   *src,
+                              const ae_wchar_t   *src_end)
+{
+    const ae_usize_t   count   = ae_wstr_to_utf8_length(src, src_end);
+    ae_utf_convert_fn *convert = (sizeof(ae_wchar_t) == sizeof(ae_u16_t))
+                                     ? ae_utf16_to_utf8_convert
+                                     : ae_utf32_to_utf8_convert;
+    return ae_utf_convert_dynamic_block(convert, self, sizeof(ae_char_t), count, src, src_end);
+}
@@ -0,0 +1,455 @@
+#include <ae/worker_pool.h>
+/* Дополнительные модули */
+#include <ae/runtime_error_code.h>
+#include <ae/runtime_return_if.h>
+#include <ae/runtime_assert.h>
+#include <ae/compiler_constructor.h>
+#include <ae/compiler_destructor.h>
+#include <ae/nullptr.h>
+
+#ifdef AE_LIBRARY_OPTION_WORKER_POOL
+#    if defined(_WIN32)
+#        include <windows.h>
+
+/** @brief Мьютекс пула. */
+typedef SRWLOCK ae_worker_pool_mutex_t;
+
+/** @brief Условная переменная пула. */
+typedef CONDITION_VARIABLE ae_worker_pool_cond_t;
+
+/** @brief Дескриптор рабочего потока. */
+typedef HANDLE ae_worker_pool_thread_t;
+#    else
+#        include <pthread.h>
+#        include <unistd.h>
+
+/** @brief Мьютекс пула. */
+typedef pthread_mutex_t ae_worker_pool_mutex_t;
+
+/** @brief Условная переменная пула. */
+typedef pthread_cond_t ae_worker_pool_cond_t;
+
+/** @brief Дескриптор рабочего потока. */
+typedef pthread_t ae_worker_pool_thread_t;
+#    endif // _WIN32
+
+/**
+ * @brief Мьютекс, защищающий состояние пула и текущего задания.
+ */
+ae_worker_pool_mutex_t m_worker_pool_mutex;
+
+/**
+ * @brief Мьютекс, упорядочивающий одновременные вызовы `ae_worker_pool_run`.
+ */
+ae_worker_pool_mutex_t m_worker_pool_run_mutex;
+
+/**
+ * @brief Условная переменная, на которой рабочие потоки ожидают новое задание.
+ */
+ae_worker_pool_cond_t m_worker_pool_job_cond;
+
+/**
+ * @brief Условная переменная, на которой вызывающий поток ожидает завершения задания.
+ */
+ae_worker_pool_cond_t m_worker_pool_done_cond;
+
+/**
+ * @brief Рабочие потоки пула.
+ */
+ae_worker_pool_thread_t m_worker_pool_threads[AE_WORKER_POOL_MAX_SIZE];
+
+/**
+ * @brief Количество запущенных рабочих потоков.
+ */
+ae_usize_t m_worker_pool_thread_count = 0;
+
+/**
+ * @brief Запрошенное число участников пула (0 - число по умолчанию).
+ */
+ae_usize_t m_worker_pool_size = 0;
+
+/**
+ * @brief Номер текущего задания; увеличивается при каждом вызове `ae_worker_pool_run`.
+ */
+ae_usize_t m_worker_pool_generation = 0;
+
+/**
+ * @brief Функция задачи текущего задания.
+ */
+ae_worker_pool_task_t m_worker_pool_task = nullptr;
+
+/**
+ * @brief Контекст текущего задания.
+ */
+void *m_worker_pool_context = nullptr;
+
+/**
+ * @brief Количество задач текущего задания.
+ */
+ae_usize_t m_worker_pool_count = 0;
+
+/**
+ * @brief Номер следующей выдаваемой задачи.
+ */
+ae_usize_t m_worker_pool_next = 0;
+
+/**
+ * @brief Количество участников, выполняющих текущее задание.
+ */
+ae_usize_t m_worker_pool_busy = 0;
+
+/**
+ * @brief Признак того, что выдача задач текущего задания прекращена.
+ */
+bool m_worker_pool_stopped = false;
+
+/**
+ * @brief Признак того, что рабочие потоки должны завершиться.
+ */
+bool m_worker_pool_shutdown = false;
+
+/**
+ * @brief Признак того, что текущий поток выполняет задачу пула.
+ *
+ * Переменная локальна для потока независимо от опции
+ * `AE_LIBRARY_OPTION_THREAD_LOCAL_VARIABLES`: вложенный вызов `ae_worker_pool_run`
+ * из задачи выполняется вызывающим потоком, так как ожидание пула внутри задачи
+ * привело бы к взаимной блокировке.
+ */
+AE_COMPILER(ATTRIBUTE_THREAD_LOCAL)
+bool m_worker_pool_inside = false;
+
+#    if defined(_WIN32)
+static void
+ae_worker_pool_mutex_init(ae_worker_pool_mutex_t *mutex)
+{
+    InitializeSRWLock(mutex);
+}
+
+static void
+ae_worker_pool_mutex_lock(ae_worker_pool_mutex_t *mutex)
+{
+    AcquireSRWLockExclusive(mutex);
+}
+
+static void
+ae_worker_pool_mutex_unlock(ae_worker_pool_mutex_t *mutex)
+{
+    ReleaseSRWLockExclusive(mutex);
+}
+
+static void
+ae_worker_pool_cond_init(ae_worker_pool_cond_t *cond)
+{
+    InitializeConditionVariable(cond);
+}
+
+static void
+ae_worker_pool_cond_wait(ae_worker_pool_cond_t *cond, ae_worker_pool_mutex_t *mutex)
+{
+    SleepConditionVariableSRW(cond, mutex, INFINITE, 0);
+}
+
+static void
+ae_worker_pool_cond_broadcast(ae_worker_pool_cond_t *cond)
+{
+    WakeAllConditionVariable(cond);
+}
+
+static ae_usize_t
+ae_worker_pool_cpu_count()
+{
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (ae_usize_t)info.dwNumberOfProcessors;
+}
+#    else
+static void
+ae_worker_pool_mutex_init(ae_worker_pool_mutex_t *mutex)
+{
+    pthread_mutex_init(mutex, nullptr);
+}
+
+static void
+ae_worker_pool_mutex_lock(ae_worker_pool_mutex_t *mutex)
+{
+    pthread_mutex_lock(mutex);
+}
+
+static void
+ae_worker_pool_mutex_unlock(ae_worker_pool_mutex_t *mutex)
+{
+    pthread_mutex_unlock(mutex);
+}
+
+static void
+ae_worker_pool_cond_init(ae_worker_pool_cond_t *cond)
+{
+    pthread_cond_init(cond, nullptr);
+}
+
+static void
+ae_worker_pool_cond_wait(ae_worker_pool_cond_t *cond, ae_worker_pool_mutex_t *mutex)
+{
+    pthread_cond_wait(cond, mutex);
+}
+
+static void
+ae_worker_pool_cond_broadcast(ae_worker_pool_cond_t *cond)
+{
+    pthread_cond_broadcast(cond);
+}
+
+static ae_usize_t
+ae_worker_pool_cpu_count()
+{
+    const long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return (count > 0) ? (ae_usize_t)count : 1;
+}
+#    endif // _WIN32
+
+/**
+ * @brief Выполняет задачи текущего задания, пока они не закончатся.
+ *
+ * Вызывается с захваченным `m_worker_pool_mutex`, который освобождается
+ * на время выполнения каждой задачи.
+ */
+static void
+ae_worker_pool_execute()
+{
+    m_worker_pool_busy++;
+    m_worker_pool_inside = true;
+
+    while (!m_worker_pool_stopped && m_worker_pool_next < m_worker_pool_count)
+    {
+        const ae_usize_t            index   = m_worker_pool_next++;
+        const ae_worker_pool_task_t task    = m_worker_pool_task;
+        void                       *context = m_worker_pool_context;
+
+        ae_worker_pool_mutex_unlock(&m_worker_pool_mutex);
+        const bool proceed = task(context, index);
+        ae_worker_pool_mutex_lock(&m_worker_pool_mutex);
+
+        if (!proceed)
+        {
+            m_worker_pool_stopped = true;
+        }
+    }
+
+    m_worker_pool_inside = false;
+    if (--m_worker_pool_busy == 0)
+    {
+        ae_worker_pool_cond_broadcast(&m_worker_pool_done_cond);
+    }
+}
+
+/**
+ * @brief Основной цикл рабочего потока.
+ *
+ * Поток ожидает смены номера задания и участвует в его выполнении.
+ * Если поток проснулся после завершения задания, задач для него
+ * уже не остается, и он снова переходит к ожиданию.
+ */
+static void
+ae_worker_pool_worker()
+{
+    ae_usize_t generation = 0;
+
+    ae_worker_pool_mutex_lock(&m_worker_pool_mutex);
+    while (!m_worker_pool_shutdown)
+    {
+        if (generation == m_worker_pool_generation)
+        {
+            ae_worker_pool_cond_wait(&m_worker_pool_job_cond, &m_worker_pool_mutex);
+            continue;
+        }
+
+        generation = m_worker_pool_generation;
+        ae_worker_pool_execute();
+    }
+    ae_worker_pool_mutex_unlock(&m_worker_pool_mutex);
+}
+
+#    if defined(_WIN32)
+static DWORD WINAPI
+ae_worker_pool_thread_main(LPVOID arg)
+{
+    (void)arg;
+    ae_worker_pool_worker();
+    return 0;
+}
+
+static bool
+ae_worker_pool_thread_start(ae_worker_pool_thread_t *thread)
+{
+    *thread = CreateThread(nullptr, 0, ae_worker_pool_thread_main, nullptr, 0, nullptr);
+    return *thread != nullptr;
+}
+
+static void
+ae_worker_pool_thread_join(ae_worker_pool_thread_t thread)
+{
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+}
+#    else
+static void *
+ae_worker_pool_thread_main(void *arg)
+{
+    (void)arg;
+    ae_worker_pool_worker();
+    return nullptr;
+}
+
+static bool
+ae_worker_pool_thread_start(ae_worker_pool_thread_t *thread)
+{
+    return pthread_create(thread, nullptr, ae_worker_pool_thread_main, nullptr) == 0;
+}
+
+static void
+ae_worker_pool_thread_join(ae_worker_pool_thread_t thread)
+{
+    pthread_join(thread, nullptr);
+}
+#    endif // _WIN32
+
+/**
+ * @brief Запускает рабочие потоки, если они еще не запущены.
+ *
+ * Вызывается с захваченным `m_worker_pool_run_mutex`. Если поток создать
+ * не удалось, пул продолжает работу с уже созданными потоками.
+ */
+static void
+ae_worker_pool_start()
+{
+    ae_runtime_return_if(m_worker_pool_thread_count != 0, );
+
+    const ae_usize_t size = ae_worker_pool_get_size();
+
+    while (m_worker_pool_thread_count + 1 < size &&
+           ae_worker_pool_thread_start(&m_worker_pool_threads[m_worker_pool_thread_count]))
+    {
+        m_worker_pool_thread_count++;
+    }
+}
+
+/**
+ * @brief Завершает рабочие потоки пула.
+ *
+ * Вызывается с захваченным `m_worker_pool_run_mutex`.
+ */
+static void
+ae_worker_pool_stop()
+{
+    ae_worker_pool_mutex_lock(&m_worker_pool_mutex);
+    m_worker_pool_shutdown = true;
+    ae_worker_pool_cond_broadcast(&m_worker_pool_job_cond);
+    ae_worker_pool_mutex_unlock(&m_worker_pool_mutex);
+
+    for (ae_usize_t i = 0; i < m_worker_pool_thread_count; ++i)
+    {
+        ae_worker_pool_thread_join(m_worker_pool_threads[i]);
+    }
+
+    m_worker_pool_thread_count = 0;
+    m_worker_pool_shutdown     = false;
+}
+
+/**
+ * @brief Конструктор, инициализирующий примитивы синхронизации пула.
+ */
+ae_compiler_constructor(ae_worker_pool_init)
+{
+    ae_worker_pool_mutex_init(&m_worker_pool_mutex);
+    ae_worker_pool_mutex_init(&m_worker_pool_run_mutex);
+    ae_worker_pool_cond_init(&m_worker_pool_job_cond);
+    ae_worker_pool_cond_init(&m_worker_pool_done_cond);
+}
+
+/**
+ * @brief Деструктор, завершающий рабочие потоки при выгрузке библиотеки.
+ */
+ae_compiler_destructor(ae_worker_pool_free)
+{
+    ae_worker_pool_mutex_lock(&m_worker_pool_run_mutex);
+    ae_worker_pool_stop();
+    ae_worker_pool_mutex_unlock(&m_worker_pool_run_mutex);
+}
+
+void
+ae_worker_pool_run(ae_worker_pool_task_t task, void *context, ae_usize_t count)
+{
+    ae_runtime_assert(task, AE_RUNTIME_ERROR_NULL_POINTER, );
+
+    /* Одна задача и вложенный вызов из задачи выполняются без обращения к рабочим потокам. */
+    if (count == 1 || m_worker_pool_inside || ae_worker_pool_get_size() == 1)
+    {
+        for (ae_usize_t i = 0; i < count && task(context, i); ++i)
+        {
+        }
+        return;
+    }
+
+    ae_worker_pool_mutex_lock(&m_worker_pool_run_mutex);
+    ae_worker_pool_start();
+
+    ae_worker_pool_mutex_lock(&m_worker_pool_mutex);
+    m_worker_pool_task    = task;
+    m_worker_pool_context = context;
+    m_worker_pool_count   = count;
+    m_worker_pool_next    = 0;
+    m_worker_pool_stopped = false;
+    m_worker_pool_generation++;
+    ae_worker_pool_cond_broadcast(&m_worker_pool_job_cond);
+
+    ae_worker_pool_execute();
+    while (m_worker_pool_busy != 0)
+    {
+        ae_worker_pool_cond_wait(&m_worker_pool_done_cond, &m_worker_pool_mutex);
+    }
+    ae_worker_pool_mutex_unlock(&m_worker_pool_mutex);
+
+    ae_worker_pool_mutex_unlock(&m_worker_pool_run_mutex);
+}
+
+void
+ae_worker_pool_set_size(ae_usize_t size)
+{
+    ae_worker_pool_mutex_lock(&m_worker_pool_run_mutex);
+    ae_worker_pool_stop();
+    m_worker_pool_size = (size < AE_WORKER_POOL_MAX_SIZE) ? size : AE_WORKER_POOL_MAX_SIZE;
+    ae_worker_pool_mutex_unlock(&m_worker_pool_run_mutex);
+}
+
+ae_usize_t
+ae_worker_pool_get_size()
+{
+    ae_runtime_return_if(m_worker_pool_size != 0, m_worker_pool_size);
+
+    const ae_usize_t count = ae_worker_pool_cpu_count();
+    return (count < AE_WORKER_POOL_MAX_SIZE) ? count : AE_WORKER_POOL_MAX_SIZE;
+}
+#else
+void
+ae_worker_pool_run(ae_worker_pool_task_t task, void *context, ae_usize_t count)
+{
+    ae_runtime_assert(task, AE_RUNTIME_ERROR_NULL_POINTER, );
+
+    for (ae_usize_t i = 0; i < count && task(context, i); ++i)
+    {
+    }
+}
+
+void
+ae_worker_pool_set_size(ae_usize_t size)
+{
+    (void)size;
+}
+
+ae_usize_t
+ae_worker_pool_get_size()
+{
+    return 1;
+}
+#endif // AE_LIBRARY_OPTION_WORKER_POOL
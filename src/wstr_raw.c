@@ -6,22 +6,32 @@
 #include <ae/wstr_traits.h>
 #include <ae/ascii_map.h>
 #include <ae/memory_raw.h>
+#include <ae/nullptr.h>
+
+/**
+ * @brief Ищет широкий символ в диапазоне поиском элемента размера `ae_wchar_t`.
+ */
+static AE_COMPILER_ATTRIBUTE_BUILTIN const ae_wchar_t *
+ae_wstr_raw_find_unit(const ae_wchar_t *begin, const ae_wchar_t *end, ae_wchar_t value)
+{
+#if AE_WCHAR_T_SIZE == 2
+    return ae_memory_raw_find_u16(begin, end, (ae_u16_t)value);
+#else
+    return ae_memory_raw_find_u32(begin, end, (ae_u32_t)value);
+#endif
+}
 
 const ae_wchar_t *
 ae_wstr_raw_find_char(const ae_wchar_t *str, ae_usize_t len, ae_wchar_t value)
 {
-    const void *_str_end = ae_ptr_add(const void, str, len *AE_WCHAR_T_SIZE);
-    const void *_val_end = ae_ptr_add_unsafe(const void, &value, AE_WCHAR_T_SIZE);
-
-    const ae_wchar_t *ptr = ae_memory_raw_find(str, _str_end, &value, _val_end);
-    return ae_ptr_align_up(ae_wchar_t, ptr, str, AE_WCHAR_T_SIZE);
+    ae_runtime_assert(str, AE_RUNTIME_ERROR_NULL_POINTER, nullptr);
+    return ae_wstr_raw_find_unit(str, str + len, value);
 }
 
 const ae_wchar_t *
 ae_wstr_raw_find_of_null_terminator(const ae_wchar_t *str)
 {
-    const ae_usize_t len = AE_UINTPTR_T_MAX - ae_ptr_to_addr(str);
-    return ae_wstr_raw_find_char(str, len, ae_wstr_args(AE_ASCII_MAP_NULL_TERMINATOR));
+    return ae_memory_raw_find_null_terminator(str, AE_WCHAR_T_SIZE);
 }
 
 ae_usize_t